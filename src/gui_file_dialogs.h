@@ -35,7 +35,9 @@
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
-//...
+#if !defined(GUI_FILE_DIALOG_MULTI_MAX_LENGTH)
+    #define GUI_FILE_DIALOG_MULTI_MAX_LENGTH   16384    // Max length for multiple files selection (DIALOG_OPEN_FILE_MULTI)
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -68,6 +70,7 @@ extern "C" {            // Prevents name mangling of functions
 // NOTE 1: fileName parameters is used to display and store selected file name
 // NOTE 2: Value returned is the operation result, on custom dialogs represents button option pressed
 // NOTE 3: filters and message are used for buttons and dialog messages on DIALOG_MESSAGE and DIALOG_TEXTINPUT
+// NOTE 4: On DIALOG_OPEN_FILE_MULTI, fileName size must be GUI_FILE_DIALOG_MULTI_MAX_LENGTH, files separated by '|'
 int GuiFileDialog(int dialogType, const char *title, char *fileName, const char *filters, const char *message);
 
 #ifdef __cplusplus
@@ -147,7 +150,13 @@ int GuiFileDialog(int dialogType, const char *title, char *fileName, const char
 
     if (tempFileName != NULL) 
     {
-        strcpy(fileName, tempFileName);
+        if (dialogType == DIALOG_OPEN_FILE_MULTI)
+        {
+            strncpy(fileName, tempFileName, GUI_FILE_DIALOG_MULTI_MAX_LENGTH - 1);
+            fileName[GUI_FILE_DIALOG_MULTI_MAX_LENGTH - 1] = '\0';
+        }
+        else strcpy(fileName, tempFileName);
+
         result = 1;
     }
     else result = 0;
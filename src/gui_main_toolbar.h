@@ -57,6 +57,9 @@ typedef struct {
     // Editor options
     int soundSlotActive;
     int prevSoundSlotActive;
+    int soundSlotCount;
+    bool soundSlotEditMode;
+    bool btnAddSlotPressed;
 
     // Tool options
     //...
@@ -142,6 +145,9 @@ GuiMainToolbarState InitGuiMainToolbar(void)
     // Edit options
     state.soundSlotActive = 0;
     state.prevSoundSlotActive = 0;
+    state.soundSlotCount = 1;
+    state.soundSlotEditMode = false;
+    state.btnAddSlotPressed = false;
 
     // Tool options
     //...
@@ -186,10 +192,11 @@ void GuiMainToolbar(GuiMainToolbarState *state)
     // Edit options
     GuiLabel((Rectangle){ state->anchorEdit.x + 8, state->anchorEdit.y + 8, 80, 24 }, "Slot:");
 
-    int tooglePadding = GuiGetStyle(TOGGLE, GROUP_PADDING);
-    GuiSetStyle(TOGGLE, GROUP_PADDING, 2);
-    state->soundSlotActive = GuiToggleGroup((Rectangle){ state->anchorEdit.x + 12 + 32, state->anchorEdit.y + 8, 16, 24 }, "1;2;3;4;5", state->soundSlotActive);
-    GuiSetStyle(TOGGLE, GROUP_PADDING, tooglePadding);
+    // NOTE: Slots are displayed 1-based, soundSlotActive is 0-based
+    int soundSlotNumber = state->soundSlotActive + 1;
+    if (GuiSpinner((Rectangle){ state->anchorEdit.x + 12 + 32, state->anchorEdit.y + 8, 64, 24 }, NULL, &soundSlotNumber, 1, state->soundSlotCount, state->soundSlotEditMode)) state->soundSlotEditMode = !state->soundSlotEditMode;
+    state->soundSlotActive = soundSlotNumber - 1;
+    state->btnAddSlotPressed = GuiButton((Rectangle){ state->anchorEdit.x + 12 + 32 + 64 + 4, state->anchorEdit.y + 8, 24, 24 }, "#197#");
 
     // Tool options
     //...
@@ -0,0 +1,426 @@
+/*******************************************************************************************
+*
+*   Render Cache - Persistent on-disk cache of generated waves, keyed by wave parameters
+*
+*   MODULE USAGE:
+*       #define RENDER_CACHE_IMPLEMENTATION
+*       #include "render_cache.h"
+*
+*       INIT: RenderCache cache = LoadRenderCache(NULL, RENDER_CACHE_DEFAULT_SIZE);   // Default cache directory
+*       LOAD: Wave wave = LoadRenderCacheWave(&cache, params, 44100, 16, 1);   // Empty wave if not cached
+*       SAVE: SaveRenderCacheWave(&cache, params, wave);
+*       TRIM: TrimRenderCache(&cache);          // Least recently used entries removed while over max size
+*
+*   Entries are identified by a hash of canonical wave parameters (CanonicalizeWaveParams()), wave format
+*   (sample rate, sample size and channels) and generation version (RFXGEN_GENERATION_VERSION), canonical
+*   parameters and format are also stored on entry and compared on load, hash collisions are never loaded.
+*   Parameters generating the same wave (not used values or values under generation precision) share entry
+*
+*   Default cache directory:
+*       Linux/BSD:  $XDG_CACHE_HOME/rfxgen (or $HOME/.cache/rfxgen)
+*       macOS:      $HOME/Library/Caches/rfxgen
+*       Windows:    %LOCALAPPDATA%\rfxgen\cache
+*
+*   NOTE: Functions are thread-safe and several processes can share a cache directory: entries
+*   are written to a temporal file and renamed (never read partially written), entry loaded
+*   updates its modification time (least recently used order), entries removed while being
+*   loaded by other processes are just not found. Not valid entries are considered not found
+*
+*   DEPENDENCIES:
+*       raylib 4.2              - Wave type, RL_MALLOC()
+*       rfxgen.h                - WaveParams type, RFXGEN_GENERATION_VERSION, CanonicalizeWaveParams(), GetWaveParamsHash()
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2022 raylib technologies (@raylibtech).
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#ifndef RENDER_CACHE_H
+#define RENDER_CACHE_H
+
+#include <stdbool.h>
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define RENDER_CACHE_DEFAULT_SIZE   (256*1024*1024)     // Default cache max size in bytes
+#define RENDER_CACHE_TRIM_RATIO     0.8                 // Cache size after trimming, ratio of max size
+#define RENDER_CACHE_EXTENSION      ".rfxc"             // Cache entries file extension
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Render cache, directory shared between processes
+// NOTE: Cache is not modified once loaded, it can be used from any thread
+typedef struct RenderCache {
+    char path[512];             // Cache directory path
+    long long maxSize;          // Cache max size in bytes, trimmed over it (0 for no limit)
+    bool ready;                 // Cache directory available
+} RenderCache;
+
+#ifdef __cplusplus
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+RenderCache LoadRenderCache(const char *path, long long maxSize);   // Load render cache, directory created if required (NULL for default directory)
+Wave LoadRenderCacheWave(const RenderCache *cache, WaveParams params, int sampleRate, int sampleSize, int channels);    // Load cached wave, empty wave if not found
+bool SaveRenderCacheWave(const RenderCache *cache, WaveParams params, Wave wave);   // Save wave generated from parameters into cache
+int TrimRenderCache(const RenderCache *cache);                      // Trim cache over max size, least recently used entries removed first, returns entries removed
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RENDER_CACHE_H
+
+/***********************************************************************************
+*
+*   RENDER_CACHE IMPLEMENTATION
+*
+************************************************************************************/
+#if defined(RENDER_CACHE_IMPLEMENTATION)
+
+#include <stdlib.h>         // Required for: getenv(), qsort()
+#include <stdio.h>          // Required for: FILE, fopen(), fread(), fwrite(), fclose(), remove(), rename(), snprintf()
+#include <string.h>         // Required for: memcmp(), memcpy(), strlen(), strcmp()
+#include <time.h>           // Required for: time()
+#include <sys/stat.h>       // Required for: stat()
+
+#if defined(_WIN32)
+    #include <direct.h>     // Required for: _mkdir()
+    #include <io.h>         // Required for: _findfirst(), _findnext(), _findclose()
+    #include <process.h>    // Required for: _getpid()
+    #include <sys/utime.h>  // Required for: _utime()
+
+    #define RENDER_CACHE_MKDIR(path)        _mkdir(path)
+    #define RENDER_CACHE_GETPID()           _getpid()
+    #define RENDER_CACHE_TOUCH(path)        _utime(path, NULL)
+#else
+    #include <dirent.h>     // Required for: opendir(), readdir(), closedir()
+    #include <unistd.h>     // Required for: getpid()
+    #include <utime.h>      // Required for: utime()
+
+    #define RENDER_CACHE_MKDIR(path)        mkdir(path, 0755)
+    #define RENDER_CACHE_GETPID()           getpid()
+    #define RENDER_CACHE_TOUCH(path)        utime(path, NULL)
+#endif
+
+#define RENDER_CACHE_TEMP_MAX_AGE   3600    // Temporal files older than it (seconds) are removed on trim (interrupted writes)
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Render cache entry header, followed by wave data
+typedef struct RenderCacheHeader {
+    char id[4];                 // Entry identifier: "rFXC"
+    int version;                // Entry layout version
+    int generationVersion;      // Wave generation version (RFXGEN_GENERATION_VERSION)
+    WaveParams params;          // Canonical wave parameters used to generate wave
+    unsigned int frameCount;    // Wave frames count
+    unsigned int sampleRate;    // Wave sample rate
+    unsigned int sampleSize;    // Wave sample size in bits
+    unsigned int channels;      // Wave channels
+} RenderCacheHeader;
+
+// Render cache file, used on trimming
+typedef struct RenderCacheFile {
+    char name[64];              // File name (no directory)
+    long long size;             // File size in bytes
+    long long time;             // File modification time (last used)
+} RenderCacheFile;
+
+//----------------------------------------------------------------------------------
+// Internal Module Functions Definition
+//----------------------------------------------------------------------------------
+// Get cache entry file name for parameters and wave format (600 chars)
+// NOTE: Parameters hash is computed from canonical parameters, generation version included
+static void GetRenderCacheFileName(const RenderCache *cache, WaveParams params, int sampleRate, int sampleSize, int channels, char *fileName)
+{
+    // Key hash (FNV-1a 64 bit): every value changing wave data
+    int format[3] = { sampleRate, sampleSize, channels };
+    unsigned long long hash = GetWaveParamsHash(params);
+
+    for (int i = 0; i < (int)sizeof(format); i++) hash = (hash ^ ((const unsigned char *)format)[i])*0x100000001b3ULL;
+
+    snprintf(fileName, 600, "%s/%016llx%s", cache->path, hash, RENDER_CACHE_EXTENSION);
+}
+
+// Make directory and its parent directories, if not exist
+static bool MakeRenderCacheDirectory(const char *path)
+{
+    char dirPath[512] = { 0 };
+    snprintf(dirPath, 512, "%s", path);
+
+    for (char *c = dirPath + 1; ; c++)
+    {
+        if ((*c == '/') || (*c == '\\') || (*c == '\0'))
+        {
+            char separator = *c;
+            *c = '\0';
+
+            // NOTE: Existing paths fail, directory checked at the end
+            if (c[-1] != ':') RENDER_CACHE_MKDIR(dirPath);
+
+            *c = separator;
+            if (separator == '\0') break;
+        }
+    }
+
+    struct stat dirStat = { 0 };
+    return ((stat(dirPath, &dirStat) == 0) && ((dirStat.st_mode & S_IFMT) == S_IFDIR));
+}
+
+// Compare cache files time, used to sort files by last use
+static int CompareRenderCacheFile(const void *a, const void *b)
+{
+    long long timeA = ((const RenderCacheFile *)a)->time;
+    long long timeB = ((const RenderCacheFile *)b)->time;
+
+    return (timeA > timeB) - (timeA < timeB);
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Load render cache, directory created if required (NULL for default directory)
+RenderCache LoadRenderCache(const char *path, long long maxSize)
+{
+    RenderCache cache = { 0 };
+    cache.maxSize = maxSize;
+
+    if (path != NULL) strncpy(cache.path, path, 511);
+    else
+    {
+    #if defined(_WIN32)
+        const char *localAppData = getenv("LOCALAPPDATA");
+        if (localAppData != NULL) snprintf(cache.path, 512, "%s\\rfxgen\\cache", localAppData);
+    #elif defined(__APPLE__)
+        const char *home = getenv("HOME");
+        if (home != NULL) snprintf(cache.path, 512, "%s/Library/Caches/rfxgen", home);
+    #else
+        const char *cacheHome = getenv("XDG_CACHE_HOME");
+        const char *home = getenv("HOME");
+
+        // NOTE: XDG base directories must be absolute paths, relative ones are ignored
+        if ((cacheHome != NULL) && (cacheHome[0] == '/')) snprintf(cache.path, 512, "%s/rfxgen", cacheHome);
+        else if (home != NULL) snprintf(cache.path, 512, "%s/.cache/rfxgen", home);
+    #endif
+    }
+
+    // Trailing separators removed, entries file names appended
+    int length = (int)strlen(cache.path);
+    while ((length > 1) && ((cache.path[length - 1] == '/') || (cache.path[length - 1] == '\\'))) cache.path[--length] = '\0';
+
+    cache.ready = (length > 0) && MakeRenderCacheDirectory(cache.path);
+
+    return cache;
+}
+
+// Load cached wave, empty wave if not found
+// NOTE: Wave data allocated with RL_MALLOC(), it must be unloaded with UnloadWave()
+Wave LoadRenderCacheWave(const RenderCache *cache, WaveParams params, int sampleRate, int sampleSize, int channels)
+{
+    Wave wave = { 0 };
+
+    if ((cache == NULL) || !cache->ready) return wave;
+
+    params = CanonicalizeWaveParams(params);
+
+    char fileName[600] = { 0 };
+    GetRenderCacheFileName(cache, params, sampleRate, sampleSize, channels, fileName);
+
+    FILE *file = fopen(fileName, "rb");
+
+    if (file != NULL)
+    {
+        RenderCacheHeader header = { 0 };
+
+        if ((fread(&header, sizeof(RenderCacheHeader), 1, file) == 1) &&
+            (memcmp(header.id, "rFXC", 4) == 0) && (header.version == 2) &&
+            (header.generationVersion == RFXGEN_GENERATION_VERSION) &&
+            (memcmp(&header.params, &params, sizeof(WaveParams)) == 0) &&
+            (header.sampleRate == (unsigned int)sampleRate) && (header.sampleSize == (unsigned int)sampleSize) &&
+            (header.channels == (unsigned int)channels) && (header.frameCount > 0))
+        {
+            size_t dataSize = (size_t)header.frameCount*header.channels*header.sampleSize/8;
+            void *data = RL_MALLOC(dataSize);
+
+            // NOTE: Truncated entries are not valid (file system errors), entries are never partially written
+            if (fread(data, 1, dataSize, file) == dataSize)
+            {
+                wave.frameCount = header.frameCount;
+                wave.sampleRate = header.sampleRate;
+                wave.sampleSize = header.sampleSize;
+                wave.channels = header.channels;
+                wave.data = data;
+            }
+            else RL_FREE(data);
+        }
+
+        fclose(file);
+
+        // Entry used, modification time updated for least recently used trimming
+        if (wave.data != NULL) RENDER_CACHE_TOUCH(fileName);
+    }
+
+    return wave;
+}
+
+// Save wave generated from parameters into cache
+// NOTE: Entry written to a temporal file (unique per process and wave) and renamed,
+// entry already saved by another process is kept
+bool SaveRenderCacheWave(const RenderCache *cache, WaveParams params, Wave wave)
+{
+    if ((cache == NULL) || !cache->ready || (wave.data == NULL) || (wave.frameCount == 0)) return false;
+
+    params = CanonicalizeWaveParams(params);
+
+    char fileName[600] = { 0 };
+    GetRenderCacheFileName(cache, params, wave.sampleRate, wave.sampleSize, wave.channels, fileName);
+
+    char tempFileName[640] = { 0 };
+    snprintf(tempFileName, 640, "%s.%d.%p.tmp", fileName, (int)RENDER_CACHE_GETPID(), wave.data);
+
+    RenderCacheHeader header = { .id = { 'r', 'F', 'X', 'C' }, .version = 2, .generationVersion = RFXGEN_GENERATION_VERSION };
+    header.params = params;
+    header.frameCount = wave.frameCount;
+    header.sampleRate = wave.sampleRate;
+    header.sampleSize = wave.sampleSize;
+    header.channels = wave.channels;
+
+    size_t dataSize = (size_t)wave.frameCount*wave.channels*wave.sampleSize/8;
+    bool success = false;
+
+    FILE *file = fopen(tempFileName, "wb");
+
+    if (file != NULL)
+    {
+        success = (fwrite(&header, sizeof(RenderCacheHeader), 1, file) == 1) && (fwrite(wave.data, 1, dataSize, file) == dataSize);
+        success = (fclose(file) == 0) && success;
+
+        // NOTE: Rename fails on Windows if entry exists (saved by another process), same data
+        if (success) success = (rename(tempFileName, fileName) == 0);
+        if (!success) remove(tempFileName);
+    }
+
+    return success;
+}
+
+// Trim cache over max size, least recently used entries removed first, returns entries removed
+// NOTE: Cache is trimmed to RENDER_CACHE_TRIM_RATIO of max size, avoiding trimming on every save
+int TrimRenderCache(const RenderCache *cache)
+{
+    if ((cache == NULL) || !cache->ready || (cache->maxSize <= 0)) return 0;
+
+    int count = 0;
+    int capacity = 1024;
+    RenderCacheFile *files = (RenderCacheFile *)RL_MALLOC(capacity*sizeof(RenderCacheFile));
+    long long totalSize = 0;
+    long long now = (long long)time(NULL);
+    int removedCount = 0;
+
+    // Cache files list: entries and temporal files
+#if defined(_WIN32)
+    char pattern[600] = { 0 };
+    snprintf(pattern, 600, "%s\\*", cache->path);
+
+    struct _finddata_t fileData = { 0 };
+    intptr_t handle = _findfirst(pattern, &fileData);
+
+    for (int result = (handle != -1)? 0 : -1; result == 0; result = _findnext(handle, &fileData))
+    {
+        const char *name = fileData.name;
+        char fileName[600] = { 0 };
+        snprintf(fileName, 600, "%s/%.63s", cache->path, name);
+
+        long long size = (long long)fileData.size;
+        long long fileTime = (long long)fileData.time_write;
+#else
+    DIR *dir = opendir(cache->path);
+    struct dirent *entry = NULL;
+
+    while ((dir != NULL) && ((entry = readdir(dir)) != NULL))
+    {
+        const char *name = entry->d_name;
+        char fileName[600] = { 0 };
+        snprintf(fileName, 600, "%s/%.63s", cache->path, name);
+
+        struct stat fileStat = { 0 };
+        if (stat(fileName, &fileStat) != 0) continue;       // Removed by another process
+
+        long long size = (long long)fileStat.st_size;
+        long long fileTime = (long long)fileStat.st_mtime;
+#endif
+        int length = (int)strlen(name);
+
+        if ((length > 4) && (length < 64) && (strcmp(name + length - 4, ".tmp") == 0))
+        {
+            // Temporal files only removed once surely abandoned, they could be being written
+            if ((now - fileTime) > RENDER_CACHE_TEMP_MAX_AGE) remove(fileName);
+        }
+        else if ((length > 5) && (length < 64) && (strcmp(name + length - 5, RENDER_CACHE_EXTENSION) == 0))
+        {
+            if (count == capacity)
+            {
+                capacity *= 2;
+                files = (RenderCacheFile *)RL_REALLOC(files, capacity*sizeof(RenderCacheFile));
+            }
+
+            strcpy(files[count].name, name);
+            files[count].size = size;
+            files[count].time = fileTime;
+            totalSize += size;
+            count++;
+        }
+    }
+
+#if defined(_WIN32)
+    if (handle != -1) _findclose(handle);
+#else
+    if (dir != NULL) closedir(dir);
+#endif
+
+    // Least recently used entries removed until cache is under trimmed size
+    if (totalSize > cache->maxSize)
+    {
+        long long trimSize = (long long)(cache->maxSize*RENDER_CACHE_TRIM_RATIO);
+
+        qsort(files, count, sizeof(RenderCacheFile), CompareRenderCacheFile);
+
+        for (int i = 0; (i < count) && (totalSize > trimSize); i++)
+        {
+            char fileName[600] = { 0 };
+            snprintf(fileName, 600, "%s/%s", cache->path, files[i].name);
+
+            // NOTE: Entries could be already removed by another process trimming the cache
+            if (remove(fileName) == 0) removedCount++;
+            totalSize -= files[i].size;
+        }
+    }
+
+    RL_FREE(files);
+
+    return removedCount;
+}
+
+#endif // RENDER_CACHE_IMPLEMENTATION
@@ -8,6 +8,29 @@
 *       Use custom raygui generated modal dialogs instead of native OS ones
 *       NOTE: Avoids including tinyfiledialogs depencency library
 *
+*   #define SUPPORT_PROFILING
+*       Enable timings instrumentation and performance HUD (F4), enabled by default on _DEBUG builds
+*       NOTE: Instrumentation is compiled out if not defined, optimized builds: make PROFILING=TRUE
+*
+*   #define CONTINUOUS_RENDERING
+*       Process and render GUI frames continuously at 60 fps, by default frames are only
+*       processed on input events when idle (no sound playing or wave regeneration pending)
+*
+*   #define SOUND_CACHE_MAX_SIZE
+*       Memory budget for sound slots cached waves and sounds (bytes), least recently used slots
+*       are unloaded over budget and regenerated when selected; 64 MB by default
+*
+*   #define COMMAND_LINE_ONLY
+*       Compile only command line functionality: no window, OpenGL, raygui or file dialogs,
+*       only raylib audio module is linked and audio device is only initialized to --play
+*       NOTE: Required raylib core functions are provided, process startup is faster (no GL/X11 loading)
+*
+*   #define SUPPORT_AUDIO_STREAMING
+*       Command line audio output converted and written by blocks: audio files transcoding (.wav, .ogg, .mp3)
+*       and .rfx waves written to stdout as generated, enabled by default on COMMAND_LINE_ONLY builds
+*       NOTE: Requires raylib sources (audio decoders and miniaudio headers: -Iraylib/src), full wave is
+*       loaded and converted in memory if not defined
+*
 *   VERSIONS HISTORY:
 *       3.0  (30-Sep-2022) Updated to raylib 4.2 and raygui 3.2
 *                          UI redesigned to follow raylibtech UI conventions
@@ -57,8 +80,16 @@
 *       gcc -o rfxgen rfxgen.c external/tinyfiledialogs.c -s -Iexternal -no-pie -D_DEFAULT_SOURCE /
 *           -lraylib -lGL -lm -lpthread -ldl -lrt -lX11
 *
+*   COMPILATION (Linux - GCC, command line only, audio streaming supported):
+*       gcc -o rfxgen-cli rfxgen.c raylib/src/raudio.c raylib/src/utils.c -s -O2 -Iraylib/src /
+*           -D_GNU_SOURCE -DPLATFORM_DESKTOP -DCOMMAND_LINE_ONLY -lm -lpthread -ldl
+*
 *   NOTE: On PLATFORM_ANDROID and PLATFORM_WEB file dialogs are not available
 *
+*   BENCHMARKS:
+*       make bench      - Sound generation microbenchmarks (rfxgen_bench.c), see rfxgen.h
+*       make bench-startup  - Process startup time of rfxgen and rfxgen-cli (make rfxgen-cli)
+*
 *   DEVELOPERS:
 *       Ramon Santamaria (@raysan5):   Developer, supervisor, updater and maintainer.
 *
@@ -91,6 +122,13 @@
 #define TOOL_RELEASE_DATE       "Oct.2022"
 #define TOOL_LOGO_COLOR         0x5197d4ff
 
+#if defined(COMMAND_LINE_ONLY) && !defined(PLATFORM_DESKTOP)
+    #define PLATFORM_DESKTOP            // Command line usage is only available on desktop
+#endif
+#if defined(COMMAND_LINE_ONLY) && !defined(SUPPORT_AUDIO_STREAMING)
+    #define SUPPORT_AUDIO_STREAMING     // Command line build compiles raylib audio module from sources
+#endif
+
 #include "raylib.h"
 
 #if defined(PLATFORM_WEB)
@@ -98,6 +136,7 @@
     #include <emscripten/emscripten.h>  // Emscripten library - LLVM to JavaScript compiler
 #endif
 
+#if !defined(COMMAND_LINE_ONLY)
 #define RAYGUI_IMPLEMENTATION
 #include "raygui.h"                     // Required for: IMGUI controls
 
@@ -111,13 +150,28 @@
 
 #define GUI_MAIN_TOOLBAR_IMPLEMENTATION
 #include "gui_main_toolbar.h"           // GUI: Main toolbar
+#endif
+
+#define WORKER_POOL_IMPLEMENTATION
+#include "worker_pool.h"                // Background tasks processing on worker threads
 
+#define RFXGEN_IMPLEMENTATION
+#if defined(SUPPORT_PROFILING) || defined(_DEBUG)
+    #define RFXGEN_SUPPORT_PROFILING    // Wave generation stages instrumentation (--profile)
+#endif
+#include "rfxgen.h"                     // Sound effects generation: wave parameters, presets and wave generation
+
+#define RENDER_CACHE_IMPLEMENTATION
+#include "render_cache.h"               // Render cache: generated waves stored on disk, reused between runs and processes
+
+#if !defined(COMMAND_LINE_ONLY)
 // raygui embedded styles
 #include "styles/style_jungle.h"        // raygui style: jungle
 #include "styles/style_candy.h"         // raygui style: candy
 #include "styles/style_lavanda.h"       // raygui style: lavanda
 #include "styles/style_cyber.h"         // raygui style: cyber
 #include "styles/style_terminal.h"      // raygui style: terminal
+#endif
 
 #include <math.h>                       // Required for: sinf(), powf()
 #include <time.h>                       // Required for: clock()
@@ -125,13 +179,44 @@
 #include <string.h>                     // Required for: strcmp()
 #include <stdio.h>                      // Required for: FILE, fopen(), fread(), fwrite(), ftell(), fseek() fclose()
                                         // NOTE: Used on functions: LoadSound(), SaveSound(), WriteWAV()
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+    #include <xmmintrin.h>              // Required for: SSE intrinsics, used on LoadWavePeaks()
+    #define WAVE_PEAKS_SSE
+#endif
+#if defined(COMMAND_LINE_ONLY)
+    #include <stdarg.h>                 // Required for: va_list, va_start(), va_end(), vsnprintf() [TextFormat()]
+#endif
+#if defined(SUPPORT_AUDIO_STREAMING)
+    // Audio decoders included with raylib audio module, only declarations (implementation linked with raylib)
+    // NOTE: Headers are not included in src/external, raylib sources required (-Iraylib/src)
+    // NOTE: Used on command line audio files streaming transcoding: TranscodeAudioFile()
+    #include "external/dr_wav.h"        // Required for: drwav_init_file(), drwav_read_pcm_frames_s16(), drwav_uninit()
+    #define STB_VORBIS_HEADER_ONLY
+    #include "external/stb_vorbis.h"    // Required for: stb_vorbis_open_filename(), stb_vorbis_get_samples_short_interleaved()
+    #include "external/dr_mp3.h"        // Required for: drmp3_init_file(), drmp3_read_pcm_frames_f32(), drmp3_uninit()
+    // NOTE: Used on streaming conversion (AudioEncoder), same frames conversion than WaveFormat()
+    #include "external/miniaudio.h"     // Required for: ma_data_converter_init(), ma_data_converter_process_pcm_frames()
+#endif
 #if defined(_WIN32)
-    #include <conio.h>                  // Required for: kbhit() [Windows only, no stardard library]
+    #include <conio.h>                  // Required for: kbhit(), getch() [Windows only, no stardard library]
+    #include <io.h>                     // Required for: _setmode(), _fileno() [CLI player stdin binary mode]
+    #include <fcntl.h>                  // Required for: _O_BINARY
 #else
-    // Provide kbhit() function in non-Windows platforms
-    #include <termios.h>
-    #include <unistd.h>
-    #include <fcntl.h>
+    #include <termios.h>                // Required for: tcgetattr(), tcsetattr() [CLI player terminal input mode]
+    #include <unistd.h>                 // Required for: read(), isatty(), dup(), dup2()
+    #include <poll.h>                   // Required for: poll() [CLI player input wait, serve mode]
+    #include <fcntl.h>                  // Required for: fcntl(), O_NONBLOCK [serve mode]
+    #include <errno.h>                  // Required for: errno, EINTR, EAGAIN [serve mode]
+    #include <signal.h>                 // Required for: sigaction(), signal() [serve mode]
+    #include <sys/socket.h>             // Required for: socket(), bind(), listen(), accept(), send(), recv() [serve mode]
+    #include <sys/un.h>                 // Required for: struct sockaddr_un [serve mode]
+    #include <dirent.h>                 // Required for: opendir(), readdir(), closedir() [watch mode]
+#endif
+#if defined(__linux__)
+    #include <sys/inotify.h>            // Required for: inotify_init1(), inotify_add_watch() [watch mode]
+#endif
+#if defined(PLATFORM_DESKTOP)
+    #include <sys/stat.h>               // Required for: stat(), S_ISSOCK() [serve mode, incremental conversion]
 #endif
 
 //----------------------------------------------------------------------------------
@@ -140,6 +225,27 @@
 #if (!defined(_DEBUG) && (defined(WIN32) || defined(_WIN32) || defined(__WIN32) && !defined(__CYGWIN__)))
 bool __stdcall FreeConsole(void);       // Close console from code (kernel32.lib)
 #endif
+#if defined(_WIN32)
+int __stdcall QueryPerformanceCounter(long long *count);            // High resolution counter (kernel32.lib)
+int __stdcall QueryPerformanceFrequency(long long *frequency);      // High resolution counter frequency (kernel32.lib)
+void __stdcall Sleep(unsigned long milliseconds);                   // Suspend thread execution (kernel32.lib)
+#endif
+
+// Timings instrumentation, compiled out if not required
+#if defined(_DEBUG) && !defined(SUPPORT_PROFILING)
+    #define SUPPORT_PROFILING
+#endif
+#if defined(SUPPORT_PROFILING)
+  #define PROFILE_TIME(var) double var = GetProfilerTime()
+  #define PROFILE_SAMPLE(stat, startTime) AddProfileSample(stat, GetProfilerTime() - (startTime))
+#else
+  #define PROFILE_TIME(var)
+  #define PROFILE_SAMPLE(stat, startTime)
+#endif
+
+#define PROFILE_HISTORY_SIZE   120                  // Profile samples kept per stat (rolling window)
+#define PROFILE_HISTOGRAM_BINS  16                  // Profile histogram bins, log2 scale from 1 us
+#define PROFILE_GENERATION_RUNS 32                  // Wave generations measured on command line profiling (--profile)
 
 // Simple log system to avoid printf() calls if required
 // NOTE: Avoiding those calls, also avoids const strings memory usage
@@ -150,61 +256,327 @@ bool __stdcall FreeConsole(void);       // Close console from code (kernel32.lib
   #define LOG(...)
 #endif
 
-#define MAX_WAVE_SLOTS       5          // Number of wave slots for generation
+#define SOUND_SLOTS_DEFAULT      5                  // Number of sound slots available on startup
+#if !defined(SOUND_CACHE_MAX_SIZE)
+    #define SOUND_CACHE_MAX_SIZE (64*1024*1024)     // Memory budget for cached waves and sounds (bytes)
+#endif
+#define SOUND_DEVICE_CHANNELS    2                  // Audio device channels, used to estimate sounds memory
+#define MAX_OPEN_FILES         256                  // Max files to be opened at once (drag & drop, command line, dialog)
+
+#define WAVE_HEADER_SIZE        44                  // Wave file header size (.wav), RIFF/WAVE with format and data chunks
+#define TRANSCODE_BLOCK_FRAMES 4096                 // Audio frames decoded, converted and encoded per block on transcoding
+
+// Serve mode protocol (--serve <socket>), UNIX domain stream socket, little-endian values
+// NOTE: Requests could be pipelined, responses are sent in requests order per connection
+//   Request:  command (4 bytes: "RNDR" render, "STAT" stats), sample rate (u32), sample size (u16), channels (u16),
+//             output format (u32: 0-wav, 1-raw), render requests: .rfx file data (RFX_FILE_SIZE bytes)
+//   Response: status (u32: 0-success, 1-error), data size (u32), data: .wav/raw data, stats JSON or error message
+#define SERVE_REQUEST_HEADER_SIZE   16          // Serve mode request header size (bytes)
+#define SERVE_RESPONSE_HEADER_SIZE   8          // Serve mode response header size (bytes)
+#define SERVE_MAX_CONNECTIONS       64          // Serve mode max client connections at once
+#define SERVE_MAX_PENDING           64          // Serve mode max requests in progress (all connections), requests not read over it
+#define SERVE_LATENCY_HISTORY     4096          // Serve mode latencies kept for stats (ring buffer)
 
-// Float random number generation
-#define frnd(range) ((float)GetRandomValue(0, 10000)/10000.0f*range)
+#define MANIFEST_MAX_COLUMNS    64                  // Conversion manifest max columns (.csv)
+#define WATCH_COALESCE_TIME   0.02                  // Watch mode wait after last file change before conversion (seconds), rapid saves coalesced
+#define CACHE_TRIM_TIME       60.0                  // Serve and watch modes min time between render cache trims (seconds), trimmed when idle
+#define CACHE_TRIM_INTERVAL     64                  // Single file conversions render cache trimming, once every interval generated waves (average)
+
+#define CONVERSION_STATE_HEADER  "# rfxgen conversion state v2"    // Incremental conversion state file first line
+
+#define PLAYER_UPDATE_TIME      50                  // CLI player max input wait, progress update period (milliseconds)
+#define PLAYER_DRAIN_TIME      0.1                  // CLI player wait after last frame provided to audio device (seconds)
+#define PLAYER_TIMEOUT_MARGIN  1.0                  // CLI player wait over wave length if device does not play (seconds)
+
+#define WAVE_PEAKS_BLOCK_SIZE    8                  // Wave samples reduced per block on peaks base level
+#define WAVE_PEAKS_MAX_LEVELS   20                  // Wave peaks max levels, enough for 10 seconds waves
+#define WAVE_VIEW_MAX_ZOOM      64                  // Wave view max zoom level
+
+#define EVENTS_WAITING_EXTRA_FRAMES  2              // Frames processed after an input event before waiting again
+
+#define SPECTROGRAM_FFT_SIZE   256                  // Spectrogram FFT size (samples per column)
+#define SPECTROGRAM_WIDTH      516                  // Spectrogram columns, one per wave view pixel
+#define SPECTROGRAM_HEIGHT     (SPECTROGRAM_FFT_SIZE/2)  // Spectrogram rows, one per frequency bin
+#define SPECTROGRAM_MIN_DB   -90.0f                 // Spectrogram min level displayed (dBFS)
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// Wave parameters type (96 bytes)
-typedef struct WaveParams {
-
-    // Random seed used to generate the wave
-    int randSeed;
-
-    // Wave type (square, sawtooth, sine, noise)
-    int waveTypeValue;
-
-    // Wave envelope parameters
-    float attackTimeValue;
-    float sustainTimeValue;
-    float sustainPunchValue;
-    float decayTimeValue;
-
-    // Frequency parameters
-    float startFrequencyValue;
-    float minFrequencyValue;
-    float slideValue;
-    float deltaSlideValue;
-    float vibratoDepthValue;
-    float vibratoSpeedValue;
-    //float vibratoPhaseDelayValue;
-
-    // Tone change parameters
-    float changeAmountValue;
-    float changeSpeedValue;
-
-    // Square wave parameters
-    float squareDutyValue;
-    float dutySweepValue;
-
-    // Repeat parameters
-    float repeatSpeedValue;
-
-    // Phaser parameters
-    float phaserOffsetValue;
-    float phaserSweepValue;
-
-    // Filter parameters
-    float lpfCutoffValue;
-    float lpfCutoffSweepValue;
-    float lpfResonanceValue;
-    float hpfCutoffValue;
-    float hpfCutoffSweepValue;
-
-} WaveParams;
+// Profile stat types
+typedef enum {
+    PROFILE_FRAME = 0,          // Frame processing time (CPU), input to draw submission
+    PROFILE_GENERATE_WAVE,      // Wave generation time: GenerateWave()
+    PROFILE_SOUND_UPLOAD,       // Sound loading time: LoadSoundFromWave()
+    PROFILE_CHANGE_LATENCY,     // Parameters change latency: slider released to sound played
+    PROFILE_STAT_COUNT
+} ProfileStatType;
+
+// Profile stat type, rolling history of timing samples
+typedef struct ProfileStat {
+    const char *name;                       // Stat name
+    float samples[PROFILE_HISTORY_SIZE];    // Samples history in ms (ring buffer)
+    int sampleCount;                        // Samples available in history
+    int index;                              // Next sample index in history
+} ProfileStat;
+
+// Wave peaks type, min/max samples pyramid at multiple resolutions
+// NOTE: Level 0 reduces WAVE_PEAKS_BLOCK_SIZE samples per block, every next level halves blocks
+typedef struct WavePeaks {
+    int levelCount;                         // Number of resolution levels
+    int blockCount[WAVE_PEAKS_MAX_LEVELS];  // Number of blocks per level
+    float *min[WAVE_PEAKS_MAX_LEVELS];      // Min sample value per block (level data)
+    float *max[WAVE_PEAKS_MAX_LEVELS];      // Max sample value per block (level data)
+    float *data;                            // Min/max data buffer, all levels
+} WavePeaks;
+
+// FFT plan type, real input FFT computed as a half size complex FFT
+typedef struct FFTPlan {
+    int size;                   // Real input size (power of 2)
+    int bits;                   // Complex FFT size bits: log2(size/2)
+    float *twiddleRe;           // Complex FFT twiddles, real part
+    float *twiddleIm;           // Complex FFT twiddles, imaginary part
+    float *splitRe;             // Real split twiddles, real part
+    float *splitIm;             // Real split twiddles, imaginary part
+    float *re;                  // Work buffer, real part
+    float *im;                  // Work buffer, imaginary part
+    float *data;                // Plan data buffer, all float arrays
+    int *bitReverse;            // Bit-reversed indices
+} FFTPlan;
+
+// Spectrogram task type, computed on a worker thread
+// NOTE: Wave samples are copied, slot wave could be evicted or regenerated while computing
+typedef struct SpectrogramTask {
+    WorkerTask task;            // Worker task
+    unsigned int waveId;        // Wave id spectrogram is computed for
+    float *samples;             // Wave samples copy (32bit float mono)
+    int frameCount;             // Wave samples count
+    unsigned char levels[SPECTROGRAM_WIDTH*SPECTROGRAM_HEIGHT];   // Spectrogram levels result
+} SpectrogramTask;
+
+// Sound slot load task type, wave parameters loading and wave generation on a worker thread
+typedef struct SoundSlotLoadTask {
+    WorkerTask task;            // Worker task
+    int slotIndex;              // Sound slot to be loaded
+    char fileName[512];         // Wave parameters file name (.rfx)
+    WaveParams params;          // Loaded wave parameters (result)
+    Wave wave;                  // Generated wave (result)
+    WavePeaks peaks;            // Generated wave peaks (result)
+    struct SoundSlotLoadTask *next;     // Next load task in progress
+} SoundSlotLoadTask;
+
+// Conversion stages, measured on command line batch conversion
+typedef enum {
+    CONVERSION_STAGE_LOAD = 0,      // Wave parameters loading (.rfx)
+    CONVERSION_STAGE_GENERATE,      // Wave generation
+    CONVERSION_STAGE_FORMAT,        // Wave format conversion
+    CONVERSION_STAGE_ENCODE,        // Wave encoding (.wav)
+    CONVERSION_STAGE_WRITE,         // Output file writing
+    CONVERSION_STAGE_COUNT
+} ConversionStage;
+
+// Conversion manifest columns, wave parameters overrides columns follow
+typedef enum {
+    MANIFEST_COLUMN_UNKNOWN = -1,   // Column not recognized, ignored
+    MANIFEST_COLUMN_SOURCE = 0,     // Source: .rfx file or Gen*() preset name
+    MANIFEST_COLUMN_SEED,           // Preset random seed
+    MANIFEST_COLUMN_OUTPUT,         // Output file (.wav or .raw)
+    MANIFEST_COLUMN_SAMPLE_RATE,    // Output sample rate
+    MANIFEST_COLUMN_SAMPLE_SIZE,    // Output sample size
+    MANIFEST_COLUMN_CHANNELS,       // Output channels
+    MANIFEST_COLUMN_PARAM           // Wave parameter override, one column per value: MANIFEST_COLUMN_PARAM + value index
+} ManifestColumn;
+
+#if defined(SUPPORT_AUDIO_STREAMING)
+// Audio decoder types, decoders included with raylib audio module
+typedef enum {
+    AUDIO_DECODER_WAV = 0,      // dr_wav
+    AUDIO_DECODER_OGG,          // stb_vorbis
+    AUDIO_DECODER_MP3           // dr_mp3
+} AudioDecoderType;
+
+// Audio decoder type, audio file frames decoded by blocks
+// NOTE: Frames are decoded with the sample size LoadWave() uses: 16 bit (.wav, .ogg) or 32bit float (.mp3)
+typedef struct AudioDecoder {
+    AudioDecoderType type;      // Decoder type
+    void *context;              // Decoder context (drwav, stb_vorbis, drmp3), NULL if not loaded
+    unsigned int sampleRate;    // Decoded frames sample rate
+    unsigned int sampleSize;    // Decoded frames sample size: 16 or 32 (float)
+    unsigned int channels;      // Decoded frames channels
+} AudioDecoder;
+
+// Audio encoder type, frames converted and written to file by blocks (.wav or raw data)
+// NOTE: Conversion state (resampler) is kept between blocks by the frames converter
+typedef struct AudioEncoder {
+    FILE *file;                 // Output file (not owned)
+    bool waveHeader;            // Wave file header written (.wav)
+    unsigned int inFrameSize;   // Input frame size in bytes
+    int sampleRate;             // Output sample rate
+    int sampleSize;             // Output sample size
+    int channels;               // Output channels
+    ma_data_converter *converter;   // Frames converter: channels, sample rate and sample size (miniaudio)
+    unsigned char *outData;     // Converted frames, any sample size fits 32 bit
+    unsigned int outCapacity;   // Output frames capacity per block
+    unsigned int frameCount;    // Frames written
+    bool success;               // All frames written
+} AudioEncoder;
+#endif
+
+// Serve mode request type, rendered on a worker thread
+typedef struct ServeRequest {
+    WorkerTask task;            // Worker task (render requests)
+    bool stats;                 // Stats request, response data generated when sent
+    WaveParams params;          // Wave parameters
+    int sampleRate;             // Output sample rate
+    int sampleSize;             // Output sample size
+    int channels;               // Output channels
+    bool waveHeader;            // Output format: .wav data (true) or raw data
+    double receiveTime;         // Request received time, latency measured to response sent
+    unsigned int status;        // Response status: 0-success, 1-error (result)
+    unsigned char *data;        // Response data (result)
+    unsigned int dataSize;      // Response data size (result)
+    unsigned int bytesSent;     // Response bytes sent, header included
+    volatile bool rendered;     // Render task finished, task state is set done right after
+    struct ServeRequest *next;  // Next request on connection
+} ServeRequest;
+
+// Serve mode connection type, requests waiting response in order
+typedef struct ServeConnection {
+    int socket;                 // Client socket, -1 if connection lost (requests discarded once rendered)
+    unsigned char input[SERVE_REQUEST_HEADER_SIZE + RFX_FILE_SIZE];   // Request being received
+    int inputSize;              // Request bytes received
+    bool inputClosed;           // Client input closed, connection closed once responses are sent
+    ServeRequest *first;        // First request waiting response
+    ServeRequest *last;         // Last request waiting response
+} ServeConnection;
+
+// Serve mode stats, latencies ring buffer
+typedef struct ServeStats {
+    double startTime;                           // Serve mode start time
+    long long requestCount;                     // Render requests responded
+    long long errorCount;                       // Render requests responded with error
+    float latency[SERVE_LATENCY_HISTORY];       // Latency history: request received to response sent (seconds)
+    double sentTime[SERVE_LATENCY_HISTORY];     // Response sent time history
+    int historyCount;                           // Samples available in history
+    int historyIndex;                           // Next sample index in history
+} ServeStats;
+
+// Conversion record type, output file state on incremental conversion
+typedef struct ConversionRecord {
+    unsigned long long inputHash;   // Input hash: wave parameters, output format and generation version
+    unsigned long long outputHash;  // Output file data hash
+    long long outputSize;           // Output file size
+    long long outputTime;           // Output file modification time
+    char *fileName;                 // Output file name
+} ConversionRecord;
+
+// Conversion state type, records of previous conversions sorted by output file name
+typedef struct ConversionState {
+    ConversionRecord *records;      // Conversion records
+    int count;                      // Conversion records count
+} ConversionState;
+
+// Conversion work queue type, jobs shared by processes on a directory, claimed with atomic rename
+typedef struct ConversionQueue {
+    char path[512];             // Queue directory: jobs, claimed, done and failed directories
+    char claimId[128];          // Process claim identifier: host name and process id
+} ConversionQueue;
+
+// Conversion task type, command line conversion of one file on a worker thread
+typedef struct ConversionTask {
+    WorkerTask task;            // Worker task
+    WorkerPool *pool;           // Worker pool, used to record queue depth
+    const char *inFileName;     // Input file name (.rfx), source description if parameters provided
+    const char *outFileName;    // Output file name (.wav), NULL to use input file name
+    const char *outDirectory;   // Output directory, NULL to use input file directory
+    int sampleRate;             // Output sample rate
+    int sampleSize;             // Output sample size
+    int channels;               // Output channels
+    bool rawOutput;             // Output raw data, no .wav header
+    bool paramsProvided;        // Wave parameters provided (presets), input file not loaded
+    WaveParams params;          // Wave parameters provided
+    WaveParams overrides;       // Wave parameters values overridden after loading
+    unsigned int overrideMask;  // Wave parameters values overridden, one bit per value
+    const ConversionState *state;   // Previous conversions state (incremental), NULL to always convert
+    bool atomicWrite;           // Output written to temporal file and renamed, readers never see partial files
+    unsigned long long jobHash; // Job hash: input file name (or manifest entry output), selects shard and names queue job
+    const ConversionQueue *queue;   // Work queue, job claimed before conversion (NULL if not queued)
+    bool claimed;               // Job claimed on work queue, converted by this process (result)
+    bool cached;                // Output wave loaded from render cache, not generated (result)
+    ConversionRecord record;    // Output record, file name allocated (result)
+    const char *rebuildReason;  // Conversion reason, up to date outputs are not converted (result)
+    double stageTime[CONVERSION_STAGE_COUNT + 1];   // Stages start time, last one is conversion end time (result)
+    int queueDepth;             // Tasks waiting in queue on conversion start (result)
+    int bytesWritten;           // Bytes written to output file (result)
+    bool success;               // Conversion succeeded (result)
+} ConversionTask;
+
+// Watched directory type
+typedef struct WatchDirectory {
+    int descriptor;             // Watch descriptor (inotify)
+    char *path;                 // Directory path
+} WatchDirectory;
+
+// Watched file type, changed or converting .rfx file
+typedef struct WatchFile {
+    char *inFileName;           // Input file name (.rfx)
+    char *outFileName;          // Output file name (.wav)
+    bool changed;               // File changed since last conversion started, conversion pending
+    double changeTime;          // First change time pending conversion
+    double lastChangeTime;      // Last change time, conversion waits WATCH_COALESCE_TIME after it
+    double conversionChangeTime;    // First change time of conversion in progress, latency reported
+    ConversionTask *conversion; // Conversion in progress, NULL if not converting
+} WatchFile;
+
+// Watch mode state: watched directories and changed files
+typedef struct WatchState {
+    int notifyDescriptor;       // File system events descriptor (inotify)
+    const char *rootPath;       // Watched directory tree root
+    const char *outDirectory;   // Output directory, NULL to write outputs to input files directory
+    int sampleRate;             // Output sample rate
+    int sampleSize;             // Output sample size
+    int channels;               // Output channels
+    WatchDirectory *directories;    // Watched directories
+    int directoryCount;         // Watched directories count
+    int directoryCapacity;      // Watched directories allocated
+    WatchFile *files;           // Changed or converting files
+    int fileCount;              // Changed or converting files count
+    int fileCapacity;           // Changed or converting files allocated
+} WatchState;
+
+// Sound slot type
+// NOTE: Only wave parameters stay resident, wave and sound are cached data,
+// they are regenerated on demand if evicted from the cache
+typedef struct SoundSlot {
+    WaveParams params;          // Wave parameters for generation
+    bool generated;             // Slot wave has been generated (not an empty slot)
+
+    bool cached;                // Wave and sound are loaded
+    Wave wave;                  // Generated wave data (cached)
+    Sound sound;                // Sound loaded into audio device (cached)
+    WavePeaks peaks;            // Wave min/max peaks for drawing (cached)
+    Texture2D spectrogram;      // Wave spectrogram texture (cached)
+    unsigned int spectrogramWaveId;     // Wave id of spectrogram texture, 0 if not available
+    SpectrogramTask *spectrogramTask;   // Spectrogram computing task, NULL if not in progress
+    SoundSlotLoadTask *loadTask;        // Slot loading task, NULL if not loading
+    unsigned int cacheSize;     // Memory used by cached data (bytes)
+    unsigned int waveId;        // Generated wave id, changes every time wave is generated
+    unsigned int lastUsed;      // Last use tick, required for LRU eviction
+} SoundSlot;
+
+// Sound slots list type, growable
+typedef struct SoundSlots {
+    SoundSlot *slots;           // Sound slots array
+    int count;                  // Number of sound slots
+    int capacity;               // Number of sound slots allocated
+
+    unsigned int cacheBudget;   // Memory budget for cached waves and sounds (bytes)
+    unsigned int cacheSize;     // Memory currently used by cached waves and sounds (bytes)
+    unsigned int tick;          // Use counter, required for LRU eviction
+    unsigned int waveCounter;   // Generated waves counter, used to assign wave ids
+
+    SoundSlotLoadTask *loadTasks;   // Load tasks in progress (including discarded ones)
+    int loadingCount;               // Number of slots waiting for load tasks
+} SoundSlots;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -213,21 +585,34 @@ static const char *toolName = TOOL_NAME;
 static const char *toolVersion = TOOL_VERSION;
 static const char *toolDescription = TOOL_DESCRIPTION;
 
-#define HELP_LINES_COUNT    16
+static RenderCache renderCache = { 0 };     // Render cache, not ready if disabled (only loaded on desktop)
+
+#if !defined(COMMAND_LINE_ONLY)
+#if defined(SUPPORT_PROFILING)
+    #define HELP_LINES_COUNT    20
+#else
+    #define HELP_LINES_COUNT    19
+#endif
 
 // Tool help info
 static const char *helpLines[HELP_LINES_COUNT] = {
     "F1 - Show Help window",
     "F2 - Show About window",
     "F3 - Show User window",
+#if defined(SUPPORT_PROFILING)
+    "F4 - Toggle performance HUD",
+#endif
     "LCTRL + N - Reset sound slot",
+    "LCTRL + A - Add new sound slot",
     "LCTRL + O - Open sound file (.rfx)",
     "LCTRL + S - Save sound file (.rfx)",
     "LCTRL + E - Export wave file",
     "-Tool Controls",
-    "1-2-3-4-5 - Select current sound slot",
+    "1..9 - Select current sound slot",
     "SPACE - Play current sound slot",
     "P - Toggle autoplay on params change",
+    "MOUSE WHEEL - Zoom wave view",
+    "V - Toggle wave/spectrogram view",
     "-Tool Visuals",
     "LEFT | RIGHT - Select visual style",
     "F - Toggle double screen size",
@@ -237,6 +622,32 @@ static const char *helpLines[HELP_LINES_COUNT] = {
 
 static float volumeValue = 0.6f;        // Master volume
 
+#if defined(SUPPORT_PROFILING)
+// Profile stats, updated from main thread
+static ProfileStat profileStats[PROFILE_STAT_COUNT] = {
+    { .name = "Frame (CPU)" },
+    { .name = "GenerateWave()" },
+    { .name = "Sound upload" },
+    { .name = "Change latency" }
+};
+#endif
+#endif  // !COMMAND_LINE_ONLY
+
+#if defined(PLATFORM_DESKTOP)
+// CLI player frames source, frames are provided to audio device from its thread (audio stream callback)
+// NOTE: Frames counter and finished state are only written from audio thread, main thread reads them to show progress
+static Wave playerWave = { 0 };                 // Wave played (32bit float), generator used if no data
+static WaveGenerator playerGenerator = { 0 };   // Wave generator, frames generated on audio stream requests
+static unsigned int playerFrameCount = 0;       // Frames to play (max frames count if generated)
+static volatile unsigned int playerFramesPlayed = 0;
+static volatile bool playerFinished = false;
+#endif
+#if defined(PLATFORM_DESKTOP) && !defined(_WIN32)
+// Serve and watch modes wake pipe, written by worker threads on request rendered and signal handler on exit
+static int wakePipe[2] = { -1, -1 };
+static volatile sig_atomic_t exitRequested = 0;
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Declaration
 //----------------------------------------------------------------------------------
@@ -245,34 +656,113 @@ static void ShowCommandLineInfo(void);                      // Show command line
 static void ProcessCommandLine(int argc, char *argv[]);     // Process command line input
 #endif
 
-// Load/Save/Export data functions
-static WaveParams LoadWaveParams(const char *fileName);                 // Load wave parameters from file
-static void SaveWaveParams(WaveParams params, const char *fileName);    // Save wave parameters to file
-static void ResetWaveParams(WaveParams *params);                        // Reset wave parameters
-static Wave GenerateWave(WaveParams params);                            // Generate wave data from parameters
-
-// Sound generation functions
-static WaveParams GenPickupCoin(void);      // Generate sound: Pickup/Coin
-static WaveParams GenLaserShoot(void);      // Generate sound: Laser shoot
-static WaveParams GenExplosion(void);       // Generate sound: Explosion
-static WaveParams GenPowerup(void);         // Generate sound: Powerup
-static WaveParams GenHitHurt(void);         // Generate sound: Hit/Hurt
-static WaveParams GenJump(void);            // Generate sound: Jump
-static WaveParams GenBlipSelect(void);      // Generate sound: Blip/Select
-static WaveParams GenRandomize(void);       // Generate random sound
-static void WaveMutate(WaveParams *params); // Mutate current sound
+#if !defined(COMMAND_LINE_ONLY)
+// Sound slots functions
+static SoundSlots LoadSoundSlots(int count, unsigned int cacheBudget);  // Load sound slots list with a cache memory budget
+static void UnloadSoundSlots(SoundSlots *slots);                        // Unload sound slots list and cached data
+static int AddSoundSlot(SoundSlots *slots);                             // Add a new sound slot, returns slot index
+static SoundSlot *GetSoundSlot(SoundSlots *slots, int index);           // Get sound slot, wave and sound regenerated on demand
+static void RegenerateSoundSlot(SoundSlots *slots, int index);          // Regenerate sound slot wave and sound from parameters
+static void ResetSoundSlot(SoundSlots *slots, int index);               // Reset sound slot to empty (no wave generated)
+static void UnloadSoundSlotCache(SoundSlots *slots, int index);         // Unload sound slot cached wave and sound
+static void LoadSoundSlotWave(SoundSlots *slots, int index, Wave wave, WavePeaks peaks); // Load generated wave into sound slot cache
+static int LoadSoundSlotsFromFiles(SoundSlots *slots, int index, const char **fileNames, int fileCount, WorkerPool *pool); // Load wave parameters files into consecutive slots (async)
+static void UpdateSoundSlotsLoading(SoundSlots *slots, WorkerPool *pool); // Update sound slots loading, finished slots are loaded
+static void SoundSlotLoadTaskFunc(void *data);  // Sound slot load task function, processed on a worker thread
+static void UpdateSoundSlotSpectrogram(SoundSlots *slots, int index, WorkerPool *pool); // Update sound slot spectrogram, computed on a worker thread
+
+// Spectrogram functions
+static FFTPlan LoadFFTPlan(int size);               // Load FFT plan for real input of provided size (power of 2, >= 4)
+static void UnloadFFTPlan(FFTPlan *plan);           // Unload FFT plan
+static void ComputeFFT(FFTPlan *plan, const float *input, float *outRe, float *outIm); // Compute FFT of real input
+static void SpectrogramTaskFunc(void *data);        // Spectrogram task function, processed on a worker thread
 
 // Auxiliar functions
-static void DrawWave(Wave *wave, Rectangle bounds, Color color);    // Draw wave data using lines
+static WavePeaks LoadWavePeaks(Wave wave);     // Load wave min/max peaks pyramid (32bit float mono wave)
+static void UnloadWavePeaks(WavePeaks *peaks);  // Unload wave peaks data
+static void DrawWave(Wave *wave, WavePeaks *peaks, Rectangle bounds, int viewFrame, int viewFrameCount, Color color); // Draw wave data using min/max peaks
 static int GuiHelpWindow(Rectangle bounds, const char *title, const char **helpLines, int helpLinesCount); // Draw help window with the provided lines
+static int SplitFileNames(char *text, char separator, const char **fileNames, int maxCount);  // Split file names list in place
+#endif  // !COMMAND_LINE_ONLY
+
+// Render cache functions
+static Wave GenerateWaveCached(WaveParams params, int sampleRate, int sampleSize, int channels, bool *cached);  // Generate wave with provided format, render cache checked first and updated
+
+// Profiling functions
+static double GetProfilerTime(void);                        // Get profiler time in seconds, high resolution monotonic clock
+#if defined(SUPPORT_PROFILING)
+#if !defined(COMMAND_LINE_ONLY)
+static void AddProfileSample(int stat, double seconds);     // Add profile sample to stat rolling history
+static void DrawProfilerHUD(Rectangle bounds, SoundSlots *slots);   // Draw profiler HUD: timings rolling histograms and slots memory
+#endif
+static void ProfileGenerateWave(WaveParams params);         // Profile wave generation stages, results are logged
+#endif
 
 #if defined(PLATFORM_DESKTOP)
-static void WaitTimePlayer(int ms);             // Simple time wait in milliseconds for the CLI player
-static void PlayWaveCLI(Wave wave);             // Play provided wave through CLI
+// Batch conversion functions
+static void ConversionTaskFunc(void *data);                 // Conversion task function, processed on a worker thread
+static unsigned char *ExportWaveToMemory(Wave wave, int *fileSize);     // Export wave data to memory as .wav file data
+static void SetWaveHeader(unsigned char *header, Wave wave);  // Set wave file header (.wav), wave data not required
+static void WriteJSONString(FILE *file, const char *text);  // Write text as JSON string, escaping required characters
+static int CompareConversionEndTime(const void *a, const void *b);      // Compare conversion tasks end time
+static bool SaveConversionTrace(const char *fileName, ConversionTask *tasks, int taskCount, int threadCount, double startTime, double endTime); // Save conversion trace as trace events JSON file
+static ConversionTask *LoadConversionManifest(const char *fileName, const char *outDirectory, int sampleRate, int sampleSize, int channels, int *taskCount); // Load conversion tasks from manifest file (.csv)
+static void UnloadConversionManifest(ConversionTask *tasks, int taskCount);  // Unload conversion tasks loaded from manifest
+static int SplitManifestLine(char *line, char **fields, int maxFields);     // Split manifest line into trimmed fields, line modified
+static ConversionState LoadConversionState(const char *fileName);           // Load incremental conversion state file, empty state if not found
+static void UnloadConversionState(ConversionState state);                   // Unload incremental conversion state
+static bool SaveConversionState(const char *fileName, ConversionState state, ConversionTask *tasks, int taskCount);    // Save conversion state: tasks records and previous records not converted
+static const ConversionRecord *GetConversionRecord(const ConversionState *state, const char *fileName);  // Get conversion record for output file, NULL if not found
+static bool IsConversionOutputValid(ConversionRecord *record);              // Check if output file matches record, modification time updated
+static int CompareConversionRecord(const void *a, const void *b);           // Compare conversion records file name, used to sort records
+static unsigned long long GetDataHash(unsigned long long hash, const void *data, int size);  // Get data hash (FNV-1a 64 bit), chained from previous hash
+static bool MergeConversionStates(const char *fileName, const char **stateFileNames, int stateCount);  // Merge conversion state files (shards), latest record kept per output
+static unsigned long long GetConversionJobHash(const ConversionTask *task, const char *outDirectory, bool manifestEntry);  // Get conversion job hash, same on every process
+static bool LoadConversionQueue(const char *path, ConversionQueue *queue, ConversionTask *tasks, int taskCount);    // Load conversion work queue, jobs created by first process
+static void QueuedConversionTaskFunc(void *data);           // Queued conversion task function: job claimed (atomic rename), converted and moved to done/failed
+static int GetConversionQueueCount(const ConversionQueue *queue, const char *dirName);  // Get conversion work queue jobs count on directory
+
+#if defined(SUPPORT_AUDIO_STREAMING)
+// Audio files transcoding functions
+static AudioDecoder LoadAudioDecoder(const char *fileName);                 // Load audio decoder for file (.wav, .ogg, .mp3)
+static unsigned int ReadAudioDecoderFrames(AudioDecoder decoder, void *frames, unsigned int frameCount);    // Read audio decoder frames (decoder sample size)
+static void UnloadAudioDecoder(AudioDecoder decoder);                       // Unload audio decoder
+static AudioEncoder LoadAudioEncoder(FILE *file, bool waveHeader, unsigned int inSampleRate, unsigned int inSampleSize, unsigned int inChannels, int sampleRate, int sampleSize, int channels); // Load audio encoder, header written
+static void WriteAudioEncoderFrames(AudioEncoder *encoder, const void *frames, unsigned int frameCount);   // Convert and write frames block (input sample size)
+static bool UnloadAudioEncoder(AudioEncoder *encoder);                      // Unload audio encoder, header sizes updated if file is seekable
+static bool TranscodeAudioFile(const char *inFileName, FILE *outFile, bool waveHeader, int sampleRate, int sampleSize, int channels); // Transcode audio file by blocks (.wav or raw data)
+static bool StreamWaveParams(WaveParams params, FILE *outFile, bool waveHeader, int sampleRate, int sampleSize, int channels);    // Generate wave by blocks, written as generated (.wav or raw data)
+#endif
+static WaveParams LoadWaveParamsFromStdin(void);                            // Load wave parameters from stdin (.rfx data)
+static FILE *LoadStdoutStream(void);                                        // Load stdout binary stream, console output redirected to stderr
+
+// Serve mode functions
+static bool RunServe(const char *socketPath, int jobCount);                 // Run serve mode: render requests on UNIX domain socket until SIGINT/SIGTERM
 #if !defined(_WIN32)
-static int kbhit(void);                         // Check if a key has been pressed
-static char getch(void) { return getchar(); }   // Get pressed character
+static void ServeTaskFunc(void *data);                                      // Serve render task function, processed on a worker thread
+static void ExitSignalHandler(int signal);                                  // Serve and watch modes signal handler, exit requested
+static bool IsServeRequestReady(WorkerPool *pool, ServeRequest *request); // Check if serve request response is ready to be sent
+static void SetServeRequestError(ServeRequest *request, const char *message);  // Set serve request error response
+static bool ReadServeRequests(ServeConnection *connection, WorkerPool *pool, int *pendingCount, double time);   // Read connection requests, returns false on connection error
+static bool SendServeResponses(ServeConnection *connection, WorkerPool *pool, ServeStats *stats, int *pendingCount, int connectionCount);    // Send connection ready responses, returns false on connection error
+static unsigned char *LoadServeStats(ServeStats *stats, int pendingCount, int connectionCount, int threadCount, unsigned int *dataSize);  // Load stats JSON text
+static int CompareFloat(const void *a, const void *b);                      // Compare float values, used to sort latencies
+#endif
+
+// Watch mode functions
+static bool RunWatch(const char *dirPath, const char *outDirectory, int sampleRate, int sampleSize, int channels, int jobCount);  // Run watch mode: changed .rfx files converted until SIGINT/SIGTERM
+#if defined(__linux__)
+static void AddWatchDirectory(WatchState *watch, const char *dirPath, double time);     // Add directory watch recursively, out of date files marked changed
+static void SetWatchFileChanged(WatchState *watch, const char *fileName, double time);  // Set watched file changed, conversion pending
+static void GetWatchOutputFileName(WatchState *watch, const char *fileName, char *outFileName);   // Get watched file output file name (512 chars)
+static bool MakeOutputDirectories(const char *fileName);                    // Make output file parent directories, if not exist
 #endif
+
+static void PlayerAudioCallback(void *bufferData, unsigned int frames);  // CLI player audio stream callback, wave frames provided to device
+static void WaitPlayerCLI(int sampleRate);      // Wait while CLI player is playing, until finished or ENTER/ESCAPE pressed
+static void RunPlayerCLI(int sampleRate, int channels);  // Run CLI player, frames source (player wave or generator) must be set
+static void PlayWaveCLI(Wave wave);             // Play provided wave through CLI
+static void PlayWaveParamsCLI(WaveParams params);  // Play provided wave parameters through CLI, wave generated while playing
 #endif  // PLATFORM_DESKTOP
 
 //------------------------------------------------------------------------------------
@@ -280,25 +770,38 @@ static char getch(void) { return getchar(); }   // Get pressed character
 //------------------------------------------------------------------------------------
 int main(int argc, char *argv[])
 {
-    char inFileName[512] = { 0 };       // Input file name (required in case of drag & drop over executable)
-    char outFileName[512] = { 0 };      // Output file name (required for file save/export)
-
 #if !defined(_DEBUG)
     SetTraceLogLevel(LOG_NONE);         // Disable raylib trace log messsages
 #endif
+#if defined(COMMAND_LINE_ONLY)
+    // Command-line only usage mode, usage info shown if no arguments provided
+    //--------------------------------------------------------------------------------------
+    ProcessCommandLine(argc, argv);
+#else
+    char inFileName[512] = { 0 };       // Input file name (required in case of drag & drop over executable)
+    char outFileName[512] = { 0 };      // Output file name (required for file save/export)
+    const char *inFileNames[MAX_OPEN_FILES] = { 0 };    // Input file names (multiple files dropped over executable)
+    int inFileCount = 0;
+
 #if defined(PLATFORM_DESKTOP)
     // Command-line usage mode
     //--------------------------------------------------------------------------------------
     if (argc > 1)
     {
-        if ((argc == 2) &&
+        // Check if all arguments are .rfx files (files dropped over executable?)
+        bool rfxFilesOnly = (argc - 1) <= MAX_OPEN_FILES;
+        for (int i = 1; (i < argc) && rfxFilesOnly; i++) rfxFilesOnly = IsFileExtension(argv[i], ".rfx");
+
+        if (rfxFilesOnly)
+        {
+            // Read input filenames to open with gui interface, one sound slot per file
+            for (int i = 1; i < argc; i++) inFileNames[inFileCount++] = argv[i];
+        }
+        else if ((argc == 2) &&
             (strcmp(argv[1], "-h") != 0) &&
             (strcmp(argv[1], "--help") != 0))       // One argument (file dropped over executable?)
         {
-            if (IsFileExtension(argv[1], ".rfx"))   // || IsFileExtension(argv[1], ".sfs"))
-            {
-                strcpy(inFileName, argv[1]);        // Read input filename to open with gui interface
-            }
+            // Not supported file, just open gui interface
         }
         else
         {
@@ -324,6 +827,7 @@ int main(int argc, char *argv[])
     SetExitKey(0);
 
     InitAudioDevice();
+    SetMasterVolume(volumeValue);       // Slot sounds are loaded at full volume, master volume applies slider value
 
     // GUI: Main Layout
     //-----------------------------------------------------------------------------------
@@ -332,6 +836,9 @@ int main(int argc, char *argv[])
 
     bool helpWindowActive = false;      // Show window: help info 
     bool userWindowActive = false;      // Show window: user registration
+#if defined(SUPPORT_PROFILING)
+    bool profilerHUDActive = false;     // Show performance HUD
+#endif
     //-----------------------------------------------------------------------------------
 
     // GUI: About Window
@@ -373,55 +880,50 @@ int main(int argc, char *argv[])
 
     // Wave and Sound Initialization
     //-----------------------------------------------------------------------------------
-    WaveParams params[MAX_WAVE_SLOTS] = { 0 }; // Wave parameters for generation
-    Wave wave[MAX_WAVE_SLOTS] = { 0 };
-    Sound sound[MAX_WAVE_SLOTS] = { 0 };
-
-    for (int i = 0; i < MAX_WAVE_SLOTS; i++)
-    {
-        // Reset generation parameters
-        // NOTE: Random seed for generation is set
-        ResetWaveParams(&params[i]);
+    // NOTE: Slots start empty, waves and sounds are generated on demand and cached
+    // within the memory budget, least recently used slots are evicted when required
+    SoundSlots soundSlots = LoadSoundSlots(SOUND_SLOTS_DEFAULT, SOUND_CACHE_MAX_SIZE);
 
-        // Default wave values
-        wave[i].sampleRate = 44100;
-        wave[i].sampleSize = 32;        // 32 bit -> float
-        wave[i].channels = 1;           // 1 channel -> mono
-        wave[i].frameCount = 10*wave[i].sampleRate;    // Max frame count for 10 seconds
-        wave[i].data = (float *)RL_CALLOC(wave[i].frameCount, sizeof(float));
+    // NOTE: Files loading and spectrograms are processed on background worker threads,
+    // never delaying sound playing, one thread per processor is used
+    WorkerPool *workerPool = LoadWorkerPool(0);
 
-        sound[i] = LoadSoundFromWave(wave[i]);
-    }
+#if defined(PLATFORM_DESKTOP)
+    // NOTE: Render cache shared with command line conversions, loaded files are not generated again
+    renderCache = LoadRenderCache(NULL, RENDER_CACHE_DEFAULT_SIZE);
+#endif
     //-----------------------------------------------------------------------------------
 
-    // Check if a wave parameters file has been provided on command line
-    if (inFileName[0] != '\0')
+    // Check if wave parameters files have been provided on command line
+    // NOTE: Sounds are loaded into consecutive slots in background, first one is played once loaded
+    if (inFileCount > 0)
     {
-        // Clean everything (just in case)
-        UnloadWave(wave[0]);
-        UnloadSound(sound[0]);
+        LoadSoundSlotsFromFiles(&soundSlots, 0, inFileNames, inFileCount, workerPool);
 
-        params[0] = LoadWaveParams(inFileName); // Load wave parameters from .rfx
-        wave[0] = GenerateWave(params[0]);      // Generate wave from parameters
-        sound[0] = LoadSoundFromWave(wave[0]);  // Load sound from new wave
-
-        PlaySound(sound[0]);                    // Play generated sound
+        if (inFileCount == 1) SetWindowTitle(TextFormat("%s v%s - %s", toolName, toolVersion, GetFileName(inFileNames[0])));
+        else SetWindowTitle(TextFormat("%s v%s - %i files", toolName, toolVersion, inFileCount));
     }
 
+    char openFileNames[GUI_FILE_DIALOG_MULTI_MAX_LENGTH] = { 0 };  // Open file dialog, multiple files selection
+
     bool regenerate = false;                    // Wave regeneration required
     
     float prevVolumeValue = volumeValue;
-    int prevWaveTypeValue[MAX_WAVE_SLOTS] = { params[0].waveTypeValue };
+    int prevWaveTypeValue = soundSlots.slots[0].params.waveTypeValue;
     
     Rectangle waveRec = { 12, 484, 516, 64 };       // Wave drawing rectangle box
     Rectangle slidersRec = { 256, 82, 226, 392 };   // Area defining sliders to allow sound replay when mouse-released
 
-    // Set default sound volume
-    for (int i = 0; i < MAX_WAVE_SLOTS; i++) SetSoundVolume(sound[i], volumeValue);
-
     // Render texture to draw wave at x2, it will be scaled down with bilinear filtering (cheapre than MSAA x4)
+    // NOTE: Wave is only redrawn into texture when wave, view or style changes
     RenderTexture2D waveTarget = LoadRenderTexture((int)waveRec.width*2, (int)waveRec.height*2);
     SetTextureFilter(waveTarget.texture, TEXTURE_FILTER_BILINEAR);
+    bool waveTargetDirty = true;            // Wave texture requires redrawing
+    unsigned int waveTargetWaveId = 0;      // Wave id drawn into texture
+
+    float waveViewZoom = 1.0f;              // Wave view zoom level (x1 shows the full wave)
+    float waveViewOffset = 0.0f;            // Wave view start position, normalized [0..1]
+    bool spectrogramViewActive = false;     // Show wave spectrogram instead of wave samples
 
     // Render texture to draw full screen, enables screen scaling
     // NOTE: If screen is scaled, mouse input should be scaled proportionally
@@ -429,6 +931,13 @@ int main(int argc, char *argv[])
     SetTextureFilter(screenTarget.texture, TEXTURE_FILTER_POINT);
 
     SetTargetFPS(60);       // Set our game to run at 60 frames-per-second
+
+#if !defined(CONTINUOUS_RENDERING)
+    // Events waiting: when idle, wait for input events instead of processing frames at 60 fps
+    // NOTE: Waiting happens on EndDrawing(), on next frame input events are available
+    bool eventWaiting = false;                                  // Events waiting enabled for current frame end
+    int activeFramesCounter = EVENTS_WAITING_EXTRA_FRAMES;      // Frames to process before waiting for events
+#endif
     //--------------------------------------------------------------------------------------
 
     // Main game loop
@@ -438,19 +947,29 @@ int main(int argc, char *argv[])
         // it contains the call to emscripten_sleep() for PLATFORM_WEB
         if (WindowShouldClose()) closeWindow = true;
 
+        PROFILE_TIME(frameStartTime);       // Frame processing start, after input events polling
+
         // Dropped files logic
         //----------------------------------------------------------------------------------
         if (IsFileDropped())
         {
             FilePathList droppedFiles = LoadDroppedFiles();
 
-            // Support loading .rfx files (wave parameters)
-            if (IsFileExtension(droppedFiles.paths[0], ".rfx")) // || IsFileExtension(droppedFiles.paths[0], ".sfs"))
+            // Support loading .rfx files (wave parameters), multiple files are loaded into consecutive slots
+            const char *rfxFileNames[MAX_OPEN_FILES] = { 0 };
+            int rfxFileCount = 0;
+
+            for (unsigned int i = 0; (i < droppedFiles.count) && (rfxFileCount < MAX_OPEN_FILES); i++)
+            {
+                if (IsFileExtension(droppedFiles.paths[i], ".rfx")) rfxFileNames[rfxFileCount++] = droppedFiles.paths[i];
+            }
+
+            if (rfxFileCount > 0)
             {
-                params[mainToolbarState.soundSlotActive] = LoadWaveParams(droppedFiles.paths[0]);
-                regenerate = true;
+                LoadSoundSlotsFromFiles(&soundSlots, mainToolbarState.soundSlotActive, rfxFileNames, rfxFileCount, workerPool);
 
-                SetWindowTitle(TextFormat("%s v%s - %s", toolName, toolVersion, GetFileName(droppedFiles.paths[0])));
+                if (rfxFileCount == 1) SetWindowTitle(TextFormat("%s v%s - %s", toolName, toolVersion, GetFileName(rfxFileNames[0])));
+                else SetWindowTitle(TextFormat("%s v%s - %i files", toolName, toolVersion, rfxFileCount));
             }
             else if (IsFileExtension(droppedFiles.paths[0], ".rgs")) GuiLoadStyle(droppedFiles.paths[0]);
 
@@ -460,7 +979,7 @@ int main(int argc, char *argv[])
 
         // Keyboard shortcuts
         //------------------------------------------------------------------------------------
-        if (IsKeyPressed(KEY_SPACE)) PlaySound(sound[mainToolbarState.soundSlotActive]);  // Play current sound
+        if (IsKeyPressed(KEY_SPACE)) PlaySound(GetSoundSlot(&soundSlots, mainToolbarState.soundSlotActive)->sound);  // Play current sound
 
         // Show dialog: save sound (.rfx)
         if (IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_S)) showSaveFileDialog = true;
@@ -471,12 +990,18 @@ int main(int argc, char *argv[])
         // Show dialog: export wave (.wav, .raw, .h)
         if (IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_E)) exportWindowActive = true;
 
+        // Add new sound slot
+        if (IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_A)) mainToolbarState.btnAddSlotPressed = true;
+
         // Select current sound slot
-        if (IsKeyPressed(KEY_ONE)) mainToolbarState.soundSlotActive = 0;
-        else if (IsKeyPressed(KEY_TWO)) mainToolbarState.soundSlotActive = 1;
-        else if (IsKeyPressed(KEY_THREE)) mainToolbarState.soundSlotActive = 2;
-        else if (IsKeyPressed(KEY_FOUR)) mainToolbarState.soundSlotActive = 3;
-        else if (IsKeyPressed(KEY_FIVE)) mainToolbarState.soundSlotActive = 4;
+        // NOTE: Avoid slot selection while slot number is being edited on toolbar
+        if (!mainToolbarState.soundSlotEditMode)
+        {
+            for (int i = 0; (i < 9) && (i < soundSlots.count); i++)
+            {
+                if (IsKeyPressed(KEY_ONE + i)) mainToolbarState.soundSlotActive = i;
+            }
+        }
 
         // Select visual style
         if (IsKeyPressed(KEY_LEFT)) mainToolbarState.visualStyleActive--;
@@ -491,6 +1016,9 @@ int main(int argc, char *argv[])
         // Toggle play on change option
         if (IsKeyPressed(KEY_P)) playOnChange = !playOnChange;
 
+        // Toggle wave/spectrogram view
+        if (IsKeyPressed(KEY_V)) spectrogramViewActive = !spectrogramViewActive;
+
         // Toggle window help
         if (IsKeyPressed(KEY_F1)) helpWindowActive = !helpWindowActive;
 
@@ -500,6 +1028,11 @@ int main(int argc, char *argv[])
         // Toggle window registered user
         //if (IsKeyPressed(KEY_F3)) userWindowActive = !userWindowActive;
 
+#if defined(SUPPORT_PROFILING)
+        // Toggle performance HUD
+        if (IsKeyPressed(KEY_F4)) profilerHUDActive = !profilerHUDActive;
+#endif
+
         // Show closing window on ESC
         if (IsKeyPressed(KEY_ESCAPE))
         {
@@ -519,19 +1052,18 @@ int main(int argc, char *argv[])
         // Main toolbar logic
         //----------------------------------------------------------------------------------
         // File options logic
-        if (mainToolbarState.btnNewFilePressed)
-        {
-            // Reload current slot
-            UnloadSound(sound[mainToolbarState.soundSlotActive]);
-            UnloadWave(wave[mainToolbarState.soundSlotActive]);
-            
-            wave[mainToolbarState.soundSlotActive].data = (float *)RL_CALLOC(wave[mainToolbarState.soundSlotActive].frameCount, sizeof(float));
-            sound[mainToolbarState.soundSlotActive] = LoadSoundFromWave(wave[mainToolbarState.soundSlotActive]);
-        }
+        if (mainToolbarState.btnNewFilePressed) ResetSoundSlot(&soundSlots, mainToolbarState.soundSlotActive);   // Reset current slot
         else if (mainToolbarState.btnLoadFilePressed) showLoadFileDialog = true;
         else if (mainToolbarState.btnSaveFilePressed) showSaveFileDialog = true;
         else if (mainToolbarState.btnExportFilePressed) exportWindowActive = true;
 
+        // Edit options logic
+        if (mainToolbarState.btnAddSlotPressed)
+        {
+            mainToolbarState.soundSlotActive = AddSoundSlot(&soundSlots);
+            mainToolbarState.btnAddSlotPressed = false;
+        }
+
         if (mainToolbarState.visualStyleActive != mainToolbarState.prevVisualStyleActive)
         {
             GuiLoadStyleDefault();
@@ -549,6 +1081,7 @@ int main(int argc, char *argv[])
             GuiSetStyle(LABEL, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
 
             mainToolbarState.prevVisualStyleActive = mainToolbarState.visualStyleActive;
+            waveTargetDirty = true;
         }
 
         // Help options logic
@@ -567,8 +1100,10 @@ int main(int argc, char *argv[])
         }
 
         // Check wave type combobox selection to regenerate wave
-        if (params[mainToolbarState.soundSlotActive].waveTypeValue != prevWaveTypeValue[mainToolbarState.soundSlotActive]) regenerate = true;
-        prevWaveTypeValue[mainToolbarState.soundSlotActive] = params[mainToolbarState.soundSlotActive].waveTypeValue;
+        // NOTE: On slot change, previous wave type is just updated
+        if ((mainToolbarState.soundSlotActive == mainToolbarState.prevSoundSlotActive) &&
+            (soundSlots.slots[mainToolbarState.soundSlotActive].params.waveTypeValue != prevWaveTypeValue)) regenerate = true;
+        prevWaveTypeValue = soundSlots.slots[mainToolbarState.soundSlotActive].params.waveTypeValue;
         
         // Avoid wave regeneration when some window is active
         if (!windowAboutState.windowActive && 
@@ -584,22 +1119,55 @@ int main(int argc, char *argv[])
             // CASE2: Mouse is moving sliders and mouse is released (checks against slidersRec)
             if (regenerate || ((CheckCollisionPointRec(GetMousePosition(), slidersRec)) && (IsMouseButtonReleased(MOUSE_LEFT_BUTTON))))
             {
-                UnloadWave(wave[mainToolbarState.soundSlotActive]);
-                UnloadSound(sound[mainToolbarState.soundSlotActive]);
-                
-                wave[mainToolbarState.soundSlotActive] = GenerateWave(params[mainToolbarState.soundSlotActive]);        // Generate new wave from parameters
-                sound[mainToolbarState.soundSlotActive] = LoadSoundFromWave(wave[mainToolbarState.soundSlotActive]);    // Reload sound from new wave
+                RegenerateSoundSlot(&soundSlots, mainToolbarState.soundSlotActive);     // Generate new wave and sound from parameters
 
-                if ((regenerate || playOnChange) && !GuiIsLocked()) PlaySound(sound[mainToolbarState.soundSlotActive]);
+                if ((regenerate || playOnChange) && !GuiIsLocked())
+                {
+                    PlaySound(soundSlots.slots[mainToolbarState.soundSlotActive].sound);
+                    PROFILE_SAMPLE(PROFILE_CHANGE_LATENCY, frameStartTime);
+                }
 
                 regenerate = false;
             }
         }
 
+        // Wave view zoom logic, zoom centered on mouse position
+        if (!windowAboutState.windowActive && !helpWindowActive && !exportWindowActive && !exitWindowActive)
+        {
+            float wheelMove = GetMouseWheelMove();
+
+            if ((wheelMove != 0.0f) && CheckCollisionPointRec(GetMousePosition(), waveRec))
+            {
+                float mouseRatio = (GetMousePosition().x - waveRec.x)/waveRec.width;
+                float mousePosition = waveViewOffset + mouseRatio/waveViewZoom;
+
+                waveViewZoom *= (wheelMove > 0.0f)? 2.0f : 0.5f;
+                if (waveViewZoom < 1.0f) waveViewZoom = 1.0f;
+                else if (waveViewZoom > WAVE_VIEW_MAX_ZOOM) waveViewZoom = WAVE_VIEW_MAX_ZOOM;
+
+                waveViewOffset = mousePosition - mouseRatio/waveViewZoom;
+                if (waveViewOffset > (1.0f - 1.0f/waveViewZoom)) waveViewOffset = 1.0f - 1.0f/waveViewZoom;
+                if (waveViewOffset < 0.0f) waveViewOffset = 0.0f;
+
+                waveTargetDirty = true;
+            }
+        }
+
+        // Update sound slots loading, play current slot sound once loaded
+        if (soundSlots.loadingCount > 0)
+        {
+            bool currentSlotLoading = (soundSlots.slots[mainToolbarState.soundSlotActive].loadTask != NULL);
+
+            UpdateSoundSlotsLoading(&soundSlots, workerPool);
+
+            if (currentSlotLoading && (soundSlots.slots[mainToolbarState.soundSlotActive].loadTask == NULL) &&
+                soundSlots.slots[mainToolbarState.soundSlotActive].generated) PlaySound(GetSoundSlot(&soundSlots, mainToolbarState.soundSlotActive)->sound);
+        }
+
         // Check slot change to play next one selected
         if (mainToolbarState.soundSlotActive != mainToolbarState.prevSoundSlotActive)
         {
-            PlaySound(sound[mainToolbarState.soundSlotActive]);
+            PlaySound(GetSoundSlot(&soundSlots, mainToolbarState.soundSlotActive)->sound);
             mainToolbarState.prevSoundSlotActive = mainToolbarState.soundSlotActive;
         }
 
@@ -637,11 +1205,27 @@ int main(int argc, char *argv[])
 
         // Draw
         //----------------------------------------------------------------------------------
-        // Render wave data to texture
-        BeginTextureMode(waveTarget);
-            ClearBackground(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));
-            DrawWave(&wave[mainToolbarState.soundSlotActive], (Rectangle){ 0, 0, (float)waveTarget.texture.width, (float)waveTarget.texture.height }, GetColor(GuiGetStyle(DEFAULT, TEXT_COLOR_PRESSED)));
-        EndTextureMode();
+        // Get current sound slot, wave and sound are regenerated if evicted from cache
+        SoundSlot *currentSlot = GetSoundSlot(&soundSlots, mainToolbarState.soundSlotActive);
+
+        // Update current slot spectrogram, computed in background after every wave generation
+        UpdateSoundSlotSpectrogram(&soundSlots, mainToolbarState.soundSlotActive, workerPool);
+
+        // Render wave data to texture, only if wave or view changed
+        if (waveTargetDirty || (currentSlot->waveId != waveTargetWaveId))
+        {
+            int viewFrame = (int)(waveViewOffset*currentSlot->wave.frameCount);
+            int viewFrameCount = (int)(currentSlot->wave.frameCount/waveViewZoom);
+
+            BeginTextureMode(waveTarget);
+                ClearBackground(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));
+                DrawWave(&currentSlot->wave, &currentSlot->peaks, (Rectangle){ 0, 0, (float)waveTarget.texture.width, (float)waveTarget.texture.height },
+                         viewFrame, viewFrameCount, GetColor(GuiGetStyle(DEFAULT, TEXT_COLOR_PRESSED)));
+            EndTextureMode();
+
+            waveTargetWaveId = currentSlot->waveId;
+            waveTargetDirty = false;
+        }
 
         // Render all screen to texture (for scaling)
         BeginTextureMode(screenTarget);
@@ -649,6 +1233,7 @@ int main(int argc, char *argv[])
 
             // GUI: Main toolbar panel
             //----------------------------------------------------------------------------------
+            mainToolbarState.soundSlotCount = soundSlots.count;
             GuiMainToolbar(&mainToolbarState);
             //----------------------------------------------------------------------------------
 
@@ -658,15 +1243,15 @@ int main(int argc, char *argv[])
             int prevTextPadding = GuiGetStyle(BUTTON, TEXT_PADDING);
             GuiSetStyle(BUTTON, TEXT_PADDING, 3);
             GuiSetStyle(BUTTON, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
-            if (GuiButton((Rectangle){ 12, 48, 108, 24 }, "#131#Play Sound")) PlaySound(sound[mainToolbarState.soundSlotActive]);
-
-            if (GuiButton((Rectangle){ 12, 88, 108, 24 }, "#146#Pickup/Coin")) { params[mainToolbarState.soundSlotActive] = GenPickupCoin(); regenerate = true; }
-            if (GuiButton((Rectangle){ 12, 116, 108, 24 }, "#145#Laser/Shoot")) { params[mainToolbarState.soundSlotActive] = GenLaserShoot(); regenerate = true; }
-            if (GuiButton((Rectangle){ 12, 144, 108, 24 }, "#147#Explosion")) { params[mainToolbarState.soundSlotActive] = GenExplosion(); regenerate = true; }
-            if (GuiButton((Rectangle){ 12, 172, 108, 24 }, "#148#PowerUp")) { params[mainToolbarState.soundSlotActive] = GenPowerup(); regenerate = true; }
-            if (GuiButton((Rectangle){ 12, 200, 108, 24 }, "#152#Hit/Hurt")) { params[mainToolbarState.soundSlotActive] = GenHitHurt(); regenerate = true; }
-            if (GuiButton((Rectangle){ 12, 228, 108, 24 }, "#150#Jump")) { params[mainToolbarState.soundSlotActive] = GenJump(); regenerate = true; }
-            if (GuiButton((Rectangle){ 12, 256, 108, 24 }, "#144#Blip/Select")) { params[mainToolbarState.soundSlotActive] = GenBlipSelect(); regenerate = true; }
+            if (GuiButton((Rectangle){ 12, 48, 108, 24 }, "#131#Play Sound")) PlaySound(currentSlot->sound);
+
+            if (GuiButton((Rectangle){ 12, 88, 108, 24 }, "#146#Pickup/Coin")) { soundSlots.slots[mainToolbarState.soundSlotActive].params = GenPickupCoin(); regenerate = true; }
+            if (GuiButton((Rectangle){ 12, 116, 108, 24 }, "#145#Laser/Shoot")) { soundSlots.slots[mainToolbarState.soundSlotActive].params = GenLaserShoot(); regenerate = true; }
+            if (GuiButton((Rectangle){ 12, 144, 108, 24 }, "#147#Explosion")) { soundSlots.slots[mainToolbarState.soundSlotActive].params = GenExplosion(); regenerate = true; }
+            if (GuiButton((Rectangle){ 12, 172, 108, 24 }, "#148#PowerUp")) { soundSlots.slots[mainToolbarState.soundSlotActive].params = GenPowerup(); regenerate = true; }
+            if (GuiButton((Rectangle){ 12, 200, 108, 24 }, "#152#Hit/Hurt")) { soundSlots.slots[mainToolbarState.soundSlotActive].params = GenHitHurt(); regenerate = true; }
+            if (GuiButton((Rectangle){ 12, 228, 108, 24 }, "#150#Jump")) { soundSlots.slots[mainToolbarState.soundSlotActive].params = GenJump(); regenerate = true; }
+            if (GuiButton((Rectangle){ 12, 256, 108, 24 }, "#144#Blip/Select")) { soundSlots.slots[mainToolbarState.soundSlotActive].params = GenBlipSelect(); regenerate = true; }
             GuiSetStyle(BUTTON, TEXT_PADDING, prevTextPadding);
             GuiSetStyle(BUTTON, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
 
@@ -674,14 +1259,14 @@ int main(int argc, char *argv[])
 
             GuiSetStyle(TOGGLE, TEXT_PADDING, 3);
             GuiSetStyle(TOGGLE, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
-            params[mainToolbarState.soundSlotActive].waveTypeValue = GuiToggleGroup((Rectangle){ 12, 248 + 32 + 16, 108, 24 }, "#126#Square\n#127#Sawtooth\n#125#Sinewave\n#124#Noise", params[mainToolbarState.soundSlotActive].waveTypeValue);
+            soundSlots.slots[mainToolbarState.soundSlotActive].params.waveTypeValue = GuiToggleGroup((Rectangle){ 12, 248 + 32 + 16, 108, 24 }, "#126#Square\n#127#Sawtooth\n#125#Sinewave\n#124#Noise", soundSlots.slots[mainToolbarState.soundSlotActive].params.waveTypeValue);
             GuiSetStyle(TOGGLE, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
             GuiSetStyle(TOGGLE, TEXT_PADDING, 0);
 
             GuiLine((Rectangle){ 12, 248 + 32 + 16 + 4*24 + 3*2, 108, 16 }, NULL);
 
-            if (GuiButton((Rectangle){ 12, 414, 108, 24 }, "#75#Mutate")) { WaveMutate(&params[mainToolbarState.soundSlotActive]); regenerate = true; }
-            if (GuiButton((Rectangle){ 12, 414 + 24 + 4, 108, 24 }, "#77#Randomize")) { params[mainToolbarState.soundSlotActive] = GenRandomize(); regenerate = true; }
+            if (GuiButton((Rectangle){ 12, 414, 108, 24 }, "#75#Mutate")) { WaveMutate(&soundSlots.slots[mainToolbarState.soundSlotActive].params); regenerate = true; }
+            if (GuiButton((Rectangle){ 12, 414 + 24 + 4, 108, 24 }, "#77#Randomize")) { soundSlots.slots[mainToolbarState.soundSlotActive].params = GenRandomize(); regenerate = true; }
 
             // Parameters sliders
             //--------------------------------------------------------------------------------
@@ -697,40 +1282,57 @@ int main(int argc, char *argv[])
 
             volumeValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y - 2, 220, 12 }, "VOLUME", TextFormat("%i", (int)(volumeValue*100)), volumeValue, 0, 1);
 
-            params[mainToolbarState.soundSlotActive].attackTimeValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 30, 220, 12 }, "ATTACK TIME", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].attackTimeValue), params[mainToolbarState.soundSlotActive].attackTimeValue, 0, 1);
-            params[mainToolbarState.soundSlotActive].sustainTimeValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 220, 12 }, "SUSTAIN TIME", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].sustainTimeValue), params[mainToolbarState.soundSlotActive].sustainTimeValue, 0, 1);
-            params[mainToolbarState.soundSlotActive].sustainPunchValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 220, 12 }, "SUSTAIN PUNCH", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].sustainPunchValue), params[mainToolbarState.soundSlotActive].sustainPunchValue, 0, 1);
-            params[mainToolbarState.soundSlotActive].decayTimeValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 220, 12 }, "DECAY TIME", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].decayTimeValue), params[mainToolbarState.soundSlotActive].decayTimeValue, 0, 1);
+            soundSlots.slots[mainToolbarState.soundSlotActive].params.attackTimeValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 30, 220, 12 }, "ATTACK TIME", TextFormat("%.2f", soundSlots.slots[mainToolbarState.soundSlotActive].params.attackTimeValue), soundSlots.slots[mainToolbarState.soundSlotActive].params.attackTimeValue, 0, 1);
+            soundSlots.slots[mainToolbarState.soundSlotActive].params.sustainTimeValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 220, 12 }, "SUSTAIN TIME", TextFormat("%.2f", soundSlots.slots[mainToolbarState.soundSlotActive].params.sustainTimeValue), soundSlots.slots[mainToolbarState.soundSlotActive].params.sustainTimeValue, 0, 1);
+            soundSlots.slots[mainToolbarState.soundSlotActive].params.sustainPunchValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 220, 12 }, "SUSTAIN PUNCH", TextFormat("%.2f", soundSlots.slots[mainToolbarState.soundSlotActive].params.sustainPunchValue), soundSlots.slots[mainToolbarState.soundSlotActive].params.sustainPunchValue, 0, 1);
+            soundSlots.slots[mainToolbarState.soundSlotActive].params.decayTimeValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 220, 12 }, "DECAY TIME", TextFormat("%.2f", soundSlots.slots[mainToolbarState.soundSlotActive].params.decayTimeValue), soundSlots.slots[mainToolbarState.soundSlotActive].params.decayTimeValue, 0, 1);
             
-            params[mainToolbarState.soundSlotActive].startFrequencyValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 24, 220, 12 }, "START FREQUENCY", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].startFrequencyValue), params[mainToolbarState.soundSlotActive].startFrequencyValue, 0, 1);
-            params[mainToolbarState.soundSlotActive].minFrequencyValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 220, 12 }, "MIN FREQUENCY", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].minFrequencyValue), params[mainToolbarState.soundSlotActive].minFrequencyValue, 0, 1);
+            soundSlots.slots[mainToolbarState.soundSlotActive].params.startFrequencyValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 24, 220, 12 }, "START FREQUENCY", TextFormat("%.2f", soundSlots.slots[mainToolbarState.soundSlotActive].params.startFrequencyValue), soundSlots.slots[mainToolbarState.soundSlotActive].params.startFrequencyValue, 0, 1);
+            soundSlots.slots[mainToolbarState.soundSlotActive].params.minFrequencyValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 220, 12 }, "MIN FREQUENCY", TextFormat("%.2f", soundSlots.slots[mainToolbarState.soundSlotActive].params.minFrequencyValue), soundSlots.slots[mainToolbarState.soundSlotActive].params.minFrequencyValue, 0, 1);
             
-            params[mainToolbarState.soundSlotActive].slideValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 24, 220, 12 }, "SLIDE", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].slideValue), params[mainToolbarState.soundSlotActive].slideValue, -1, 1);
-            params[mainToolbarState.soundSlotActive].deltaSlideValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 220, 12 }, "DELTA SLIDE", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].deltaSlideValue), params[mainToolbarState.soundSlotActive].deltaSlideValue, -1, 1);
-            params[mainToolbarState.soundSlotActive].vibratoDepthValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 220, 12 }, "VIBRATO DEPTH", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].vibratoDepthValue), params[mainToolbarState.soundSlotActive].vibratoDepthValue, 0, 1);
-            params[mainToolbarState.soundSlotActive].vibratoSpeedValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 220, 12 }, "VIBRATO SPEED", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].vibratoSpeedValue), params[mainToolbarState.soundSlotActive].vibratoSpeedValue, 0, 1);
+            soundSlots.slots[mainToolbarState.soundSlotActive].params.slideValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 24, 220, 12 }, "SLIDE", TextFormat("%.2f", soundSlots.slots[mainToolbarState.soundSlotActive].params.slideValue), soundSlots.slots[mainToolbarState.soundSlotActive].params.slideValue, -1, 1);
+            soundSlots.slots[mainToolbarState.soundSlotActive].params.deltaSlideValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 220, 12 }, "DELTA SLIDE", TextFormat("%.2f", soundSlots.slots[mainToolbarState.soundSlotActive].params.deltaSlideValue), soundSlots.slots[mainToolbarState.soundSlotActive].params.deltaSlideValue, -1, 1);
+            soundSlots.slots[mainToolbarState.soundSlotActive].params.vibratoDepthValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 220, 12 }, "VIBRATO DEPTH", TextFormat("%.2f", soundSlots.slots[mainToolbarState.soundSlotActive].params.vibratoDepthValue), soundSlots.slots[mainToolbarState.soundSlotActive].params.vibratoDepthValue, 0, 1);
+            soundSlots.slots[mainToolbarState.soundSlotActive].params.vibratoSpeedValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 220, 12 }, "VIBRATO SPEED", TextFormat("%.2f", soundSlots.slots[mainToolbarState.soundSlotActive].params.vibratoSpeedValue), soundSlots.slots[mainToolbarState.soundSlotActive].params.vibratoSpeedValue, 0, 1);
             
-            params[mainToolbarState.soundSlotActive].changeAmountValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 24, 220, 12 }, "CHANGE AMOUNT", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].changeAmountValue), params[mainToolbarState.soundSlotActive].changeAmountValue, -1, 1);
-            params[mainToolbarState.soundSlotActive].changeSpeedValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 220, 12 }, "CHANGE SPEED", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].changeSpeedValue), params[mainToolbarState.soundSlotActive].changeSpeedValue, 0, 1);
-            params[mainToolbarState.soundSlotActive].squareDutyValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 220, 12 }, "SQUARE DUTY", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].squareDutyValue), params[mainToolbarState.soundSlotActive].squareDutyValue, 0, 1);
-            params[mainToolbarState.soundSlotActive].dutySweepValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 220, 12 }, "DUTY SWEEP", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].dutySweepValue), params[mainToolbarState.soundSlotActive].dutySweepValue, -1, 1);
+            soundSlots.slots[mainToolbarState.soundSlotActive].params.changeAmountValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 24, 220, 12 }, "CHANGE AMOUNT", TextFormat("%.2f", soundSlots.slots[mainToolbarState.soundSlotActive].params.changeAmountValue), soundSlots.slots[mainToolbarState.soundSlotActive].params.changeAmountValue, -1, 1);
+            soundSlots.slots[mainToolbarState.soundSlotActive].params.changeSpeedValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 220, 12 }, "CHANGE SPEED", TextFormat("%.2f", soundSlots.slots[mainToolbarState.soundSlotActive].params.changeSpeedValue), soundSlots.slots[mainToolbarState.soundSlotActive].params.changeSpeedValue, 0, 1);
+            soundSlots.slots[mainToolbarState.soundSlotActive].params.squareDutyValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 220, 12 }, "SQUARE DUTY", TextFormat("%.2f", soundSlots.slots[mainToolbarState.soundSlotActive].params.squareDutyValue), soundSlots.slots[mainToolbarState.soundSlotActive].params.squareDutyValue, 0, 1);
+            soundSlots.slots[mainToolbarState.soundSlotActive].params.dutySweepValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 220, 12 }, "DUTY SWEEP", TextFormat("%.2f", soundSlots.slots[mainToolbarState.soundSlotActive].params.dutySweepValue), soundSlots.slots[mainToolbarState.soundSlotActive].params.dutySweepValue, -1, 1);
            
-            params[mainToolbarState.soundSlotActive].repeatSpeedValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 24, 220, 12 }, "REPEAT SPEED", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].repeatSpeedValue), params[mainToolbarState.soundSlotActive].repeatSpeedValue, 0, 1);
-            params[mainToolbarState.soundSlotActive].phaserOffsetValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 220, 12 }, "PHASER OFFSET", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].phaserOffsetValue), params[mainToolbarState.soundSlotActive].phaserOffsetValue, -1, 1);
-            params[mainToolbarState.soundSlotActive].phaserSweepValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 220, 12 }, "PHASER SWEEP", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].phaserSweepValue), params[mainToolbarState.soundSlotActive].phaserSweepValue, -1, 1);
+            soundSlots.slots[mainToolbarState.soundSlotActive].params.repeatSpeedValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 24, 220, 12 }, "REPEAT SPEED", TextFormat("%.2f", soundSlots.slots[mainToolbarState.soundSlotActive].params.repeatSpeedValue), soundSlots.slots[mainToolbarState.soundSlotActive].params.repeatSpeedValue, 0, 1);
+            soundSlots.slots[mainToolbarState.soundSlotActive].params.phaserOffsetValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 220, 12 }, "PHASER OFFSET", TextFormat("%.2f", soundSlots.slots[mainToolbarState.soundSlotActive].params.phaserOffsetValue), soundSlots.slots[mainToolbarState.soundSlotActive].params.phaserOffsetValue, -1, 1);
+            soundSlots.slots[mainToolbarState.soundSlotActive].params.phaserSweepValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 220, 12 }, "PHASER SWEEP", TextFormat("%.2f", soundSlots.slots[mainToolbarState.soundSlotActive].params.phaserSweepValue), soundSlots.slots[mainToolbarState.soundSlotActive].params.phaserSweepValue, -1, 1);
             
-            params[mainToolbarState.soundSlotActive].lpfCutoffValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 24, 220, 12 }, "LPF CUTOFF", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].lpfCutoffValue), params[mainToolbarState.soundSlotActive].lpfCutoffValue, 0, 1);
-            params[mainToolbarState.soundSlotActive].lpfCutoffSweepValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 220, 12 }, "LPF CUTOFF SWEEP", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].lpfCutoffSweepValue), params[mainToolbarState.soundSlotActive].lpfCutoffSweepValue, -1, 1);
-            params[mainToolbarState.soundSlotActive].lpfResonanceValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 220, 12 }, "LPF RESONANCE", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].lpfResonanceValue), params[mainToolbarState.soundSlotActive].lpfResonanceValue, 0, 1);
-            params[mainToolbarState.soundSlotActive].hpfCutoffValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 220, 12 }, "HPF CUTOFF", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].hpfCutoffValue), params[mainToolbarState.soundSlotActive].hpfCutoffValue, 0, 1);
-            params[mainToolbarState.soundSlotActive].hpfCutoffSweepValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 220, 12 }, "HPF CUTOFF SWEEP", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].hpfCutoffSweepValue), params[mainToolbarState.soundSlotActive].hpfCutoffSweepValue, -1, 1);
+            soundSlots.slots[mainToolbarState.soundSlotActive].params.lpfCutoffValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 24, 220, 12 }, "LPF CUTOFF", TextFormat("%.2f", soundSlots.slots[mainToolbarState.soundSlotActive].params.lpfCutoffValue), soundSlots.slots[mainToolbarState.soundSlotActive].params.lpfCutoffValue, 0, 1);
+            soundSlots.slots[mainToolbarState.soundSlotActive].params.lpfCutoffSweepValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 220, 12 }, "LPF CUTOFF SWEEP", TextFormat("%.2f", soundSlots.slots[mainToolbarState.soundSlotActive].params.lpfCutoffSweepValue), soundSlots.slots[mainToolbarState.soundSlotActive].params.lpfCutoffSweepValue, -1, 1);
+            soundSlots.slots[mainToolbarState.soundSlotActive].params.lpfResonanceValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 220, 12 }, "LPF RESONANCE", TextFormat("%.2f", soundSlots.slots[mainToolbarState.soundSlotActive].params.lpfResonanceValue), soundSlots.slots[mainToolbarState.soundSlotActive].params.lpfResonanceValue, 0, 1);
+            soundSlots.slots[mainToolbarState.soundSlotActive].params.hpfCutoffValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 220, 12 }, "HPF CUTOFF", TextFormat("%.2f", soundSlots.slots[mainToolbarState.soundSlotActive].params.hpfCutoffValue), soundSlots.slots[mainToolbarState.soundSlotActive].params.hpfCutoffValue, 0, 1);
+            soundSlots.slots[mainToolbarState.soundSlotActive].params.hpfCutoffSweepValue = GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 220, 12 }, "HPF CUTOFF SWEEP", TextFormat("%.2f", soundSlots.slots[mainToolbarState.soundSlotActive].params.hpfCutoffSweepValue), soundSlots.slots[mainToolbarState.soundSlotActive].params.hpfCutoffSweepValue, -1, 1);
             //--------------------------------------------------------------------------------
 
             // Draw Wave form
             //--------------------------------------------------------------------------------
-            DrawTextureEx(waveTarget.texture, (Vector2) { waveRec.x, waveRec.y }, 0.0f, 0.5f, WHITE);
-            DrawRectangle((int)waveRec.x, (int)waveRec.y + (int)waveRec.height/2, (int)waveRec.width, 1, Fade(GetColor(GuiGetStyle(DEFAULT, TEXT_COLOR_FOCUSED)), 0.6f));
+            if (spectrogramViewActive)
+            {
+                // NOTE: Spectrogram texture is tinted with style color, view zoom is applied to source rectangle
+                DrawRectangleRec(waveRec, GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));
+                if (currentSlot->spectrogramWaveId == currentSlot->waveId) DrawTexturePro(currentSlot->spectrogram,
+                    (Rectangle){ waveViewOffset*SPECTROGRAM_WIDTH, 0, SPECTROGRAM_WIDTH/waveViewZoom, SPECTROGRAM_HEIGHT }, waveRec, (Vector2){ 0, 0 }, 0.0f, GetColor(GuiGetStyle(DEFAULT, TEXT_COLOR_PRESSED)));
+            }
+            else
+            {
+                DrawTextureEx(waveTarget.texture, (Vector2) { waveRec.x, waveRec.y }, 0.0f, 0.5f, WHITE);
+                DrawRectangle((int)waveRec.x, (int)waveRec.y + (int)waveRec.height/2, (int)waveRec.width, 1, Fade(GetColor(GuiGetStyle(DEFAULT, TEXT_COLOR_FOCUSED)), 0.6f));
+            }
             DrawRectangleLines((int)waveRec.x, (int)waveRec.y, (int)waveRec.width, (int)waveRec.height, GetColor(GuiGetStyle(DEFAULT, LINE_COLOR)));
+
+            if (currentSlot->loadTask != NULL)
+            {
+                GuiSetStyle(LABEL, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
+                GuiLabel(waveRec, TextFormat("Loading sounds... (%i pending)", soundSlots.loadingCount));
+                GuiSetStyle(LABEL, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
+            }
             //--------------------------------------------------------------------------------
 
             // GUI: Status bar
@@ -738,13 +1340,17 @@ int main(int argc, char *argv[])
             int textPadding = GuiGetStyle(STATUSBAR, TEXT_PADDING);
             GuiSetStyle(STATUSBAR, TEXT_PADDING, 0);
             GuiSetStyle(STATUSBAR, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
-            GuiStatusBar((Rectangle){ 0, screenHeight - 24, 190, 24 }, TextFormat("Total Frames: %i", wave[mainToolbarState.soundSlotActive].frameCount));
-            GuiStatusBar((Rectangle){ 190 - 1, screenHeight - 24, 170, 24 }, TextFormat("Duration: %i ms", wave[mainToolbarState.soundSlotActive].frameCount*1000/(wave[mainToolbarState.soundSlotActive].sampleRate)));
-            GuiStatusBar((Rectangle){ 190 + 170 - 2, screenHeight - 24, screenWidth - (190 + 170 - 2), 24 }, TextFormat("Size: %i bytes", wave[mainToolbarState.soundSlotActive].frameCount *wave[mainToolbarState.soundSlotActive].channels *exportSampleSize/8));
+            GuiStatusBar((Rectangle){ 0, screenHeight - 24, 190, 24 }, TextFormat("Total Frames: %i", currentSlot->wave.frameCount));
+            GuiStatusBar((Rectangle){ 190 - 1, screenHeight - 24, 170, 24 }, TextFormat("Duration: %i ms", currentSlot->wave.frameCount*1000/(currentSlot->wave.sampleRate)));
+            GuiStatusBar((Rectangle){ 190 + 170 - 2, screenHeight - 24, screenWidth - (190 + 170 - 2), 24 }, TextFormat("Size: %i bytes", currentSlot->wave.frameCount*currentSlot->wave.channels*exportSampleSize/8));
             GuiSetStyle(STATUSBAR, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
             GuiSetStyle(STATUSBAR, TEXT_PADDING, textPadding);
             //----------------------------------------------------------------------------------
 
+#if defined(SUPPORT_PROFILING)
+            // Draw performance HUD over parameters
+            if (profilerHUDActive) DrawProfilerHUD((Rectangle){ 130, 48, 398, 426 }, &soundSlots);
+#endif
             // NOTE: If some overlap window is open and main window is locked, we draw a background rectangle
             if (GuiIsLocked()) DrawRectangle(0, 0, GetScreenWidth(), GetScreenHeight(), Fade(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)), 0.85f));
             
@@ -758,7 +1364,7 @@ int main(int argc, char *argv[])
 
             // GUI: Help Window
             //----------------------------------------------------------------------------------------
-            Rectangle helpWindowBounds = { (float)screenWidth/2 - 330/2, (float)screenHeight/2 - 400.0f/2, 330, 0 };
+            Rectangle helpWindowBounds = { (float)screenWidth/2 - 330/2, (float)screenHeight/2 - (float)(HELP_LINES_COUNT*24 + 24)/2, 330, 0 };
             if (helpWindowActive) helpWindowActive = GuiHelpWindow(helpWindowBounds, GuiIconText(ICON_HELP, TextFormat("%s Shortcuts", TOOL_NAME)), helpLines, HELP_LINES_COUNT);
             //----------------------------------------------------------------------------------------
 
@@ -816,14 +1422,23 @@ int main(int argc, char *argv[])
 #if defined(CUSTOM_MODAL_DIALOGS)
                 int result = GuiFileDialog(DIALOG_MESSAGE, "Load sound file ...", inFileName, "Ok", "Just drag and drop your .rfx sound file!");
 #else
-                int result = GuiFileDialog(DIALOG_OPEN_FILE, "Load sound parameters file...", inFileName, "*.rfx", "Sound Param Files (*.rfx)");
+                strcpy(openFileNames, inFileName);
+                int result = GuiFileDialog(DIALOG_OPEN_FILE_MULTI, "Load sound parameters file...", openFileNames, "*.rfx", "Sound Param Files (*.rfx)");
 #endif
                 if (result == 1)
                 {
-                    // Load parameters file
-                    params[mainToolbarState.soundSlotActive] = LoadWaveParams(inFileName);
-                    SetWindowTitle(TextFormat("%s v%s - %s", toolName, toolVersion, GetFileName(inFileName)));
-                    regenerate = true;
+                    // Load parameters files, multiple files selection is separated by '|'
+                    const char *rfxFileNames[MAX_OPEN_FILES] = { 0 };
+                    int rfxFileCount = SplitFileNames(openFileNames, '|', rfxFileNames, MAX_OPEN_FILES);
+
+                    if (rfxFileCount > 0)
+                    {
+                        LoadSoundSlotsFromFiles(&soundSlots, mainToolbarState.soundSlotActive, rfxFileNames, rfxFileCount, workerPool);
+
+                        strcpy(inFileName, rfxFileNames[0]);
+                        if (rfxFileCount == 1) SetWindowTitle(TextFormat("%s v%s - %s", toolName, toolVersion, GetFileName(inFileName)));
+                        else SetWindowTitle(TextFormat("%s v%s - %i files", toolName, toolVersion, rfxFileCount));
+                    }
                 }
 
                 if (result >= 0) showLoadFileDialog = false;
@@ -845,7 +1460,7 @@ int main(int argc, char *argv[])
                     // Save file: outFileName
                     // Check for valid extension and make sure it is
                     if ((GetFileExtension(outFileName) == NULL) || !IsFileExtension(outFileName, ".rfx")) strcat(outFileName, ".rfx\0");
-                    SaveWaveParams(params[mainToolbarState.soundSlotActive], outFileName);    // Save wave parameters
+                    SaveWaveParams(soundSlots.slots[mainToolbarState.soundSlotActive].params, outFileName);    // Save wave parameters
 
                 #if defined(PLATFORM_WEB)
                     // Download file from MEMFS (emscripten memory filesystem)
@@ -878,7 +1493,7 @@ int main(int argc, char *argv[])
                 if (result == 1)
                 {
                     // Export file: outFileName
-                    Wave cwave = WaveCopy(wave[mainToolbarState.soundSlotActive]);
+                    Wave cwave = WaveCopy(currentSlot->wave);
                     WaveFormat(&cwave, exportSampleRate, exportSampleSize, exportChannels);   // Before exporting wave data, we format it as desired
 
                     if (fileTypeActive == 0) 
@@ -921,6 +1536,32 @@ int main(int argc, char *argv[])
 
         EndTextureMode();
 
+#if !defined(CONTINUOUS_RENDERING)
+        // Events waiting logic
+        // NOTE: Some extra frames are processed after every input event because
+        // GUI controls results (buttons pressed...) are checked on next frame logic
+        if (eventWaiting) activeFramesCounter = EVENTS_WAITING_EXTRA_FRAMES;   // Current frame was triggered by an input event
+        else if (activeFramesCounter > 0) activeFramesCounter--;
+
+        // Keep processing frames while wave regeneration is pending, sound is playing or background tasks are in progress
+        if (regenerate || IsSoundPlaying(soundSlots.slots[mainToolbarState.soundSlotActive].sound) ||
+            (soundSlots.slots[mainToolbarState.soundSlotActive].spectrogramTask != NULL) ||
+            (soundSlots.loadingCount > 0)) activeFramesCounter = EVENTS_WAITING_EXTRA_FRAMES;
+
+        if ((activeFramesCounter > 0) && eventWaiting)
+        {
+            DisableEventWaiting();
+            eventWaiting = false;
+        }
+        else if ((activeFramesCounter == 0) && !eventWaiting)
+        {
+            EnableEventWaiting();
+            eventWaiting = true;
+        }
+#endif
+
+        PROFILE_SAMPLE(PROFILE_FRAME, frameStartTime);
+
         BeginDrawing();
             ClearBackground(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));
             
@@ -934,11 +1575,10 @@ int main(int argc, char *argv[])
 
     // De-Initialization
     //----------------------------------------------------------------------------------------
-    for (int i = 0; i < MAX_WAVE_SLOTS; i++)
-    {
-        UnloadSound(sound[i]);  // Unload sounds
-        UnloadWave(wave[i]);    // Unload wave slots (free done internally)
-    }
+    WorkerPoolWait(workerPool);     // Wait for background tasks, they could be using slots data
+    UnloadSoundSlots(&soundSlots);  // Unload sound slots (waves and sounds)
+    UnloadWorkerPool(workerPool);   // Unload worker pool, threads are finished
+    TrimRenderCache(&renderCache);  // Trim render cache, least recently used waves removed over max size
 
     UnloadRenderTexture(screenTarget);
     UnloadRenderTexture(waveTarget);
@@ -946,6 +1586,7 @@ int main(int argc, char *argv[])
     CloseAudioDevice();         // Close audio device
     CloseWindow();              // Close window and OpenGL context
     //----------------------------------------------------------------------------------------
+#endif  // COMMAND_LINE_ONLY
 
     return 0;
 }
@@ -960,7 +1601,11 @@ static void ShowCommandLineInfo(void)
     printf("\n//////////////////////////////////////////////////////////////////////////////////\n");
     printf("//                                                                              //\n");
     printf("// %s v%s - %s                   //\n", toolName, toolVersion, toolDescription);
+#if defined(COMMAND_LINE_ONLY)
+    printf("// powered by raylib v%s (command line only build)                             //\n", RAYLIB_VERSION);
+#else
     printf("// powered by raylib v%s and raygui v%s                               //\n", RAYLIB_VERSION, RAYGUI_VERSION);
+#endif
     printf("// more info and bugs-report: github.com/raysan5/rfxgen                         //\n");
     printf("//                                                                              //\n");
     printf("// Copyright (c) 2014-2022 raylib technologies (@raylibtech)                    //\n");
@@ -968,16 +1613,25 @@ static void ShowCommandLineInfo(void)
     printf("//////////////////////////////////////////////////////////////////////////////////\n\n");
 
     printf("USAGE:\n\n");
-    printf("    > rfxgen [--help] --input <filename.ext> [--output <filename.ext>]\n");
-    printf("             [--format <sample_rate>,<sample_size>,<channels>] [--play <filename.ext>]\n");
+    printf("    > rfxgen [--help] --input <filename.ext> [<filename.ext>...] [--output <filename.ext>]\n");
+    printf("             [--output-format <wav|raw>] [--format <sample_rate>,<sample_size>,<channels>]\n");
+    printf("             [--play <filename.ext>] [--manifest <filename.csv>] [--output-dir <path>] [--jobs <count>]\n");
+    printf("             [--incremental <filename.txt>] [--force] [--trace <filename.json>] [--profile]\n");
+    printf("             [--cache-dir <path>] [--cache-size <size_mb>] [--no-cache] [--shard <index>/<count>] [--queue <path>]\n");
+    printf("    > rfxgen --merge-state <filename.txt> <filename.txt> [<filename.txt>...]\n");
+    printf("    > rfxgen --watch <path> [--output-dir <path>] [--format <sample_rate>,<sample_size>,<channels>] [--jobs <count>]\n");
+    printf("    > rfxgen --serve <socket> [--jobs <count>]\n");
 
     printf("\nOPTIONS:\n\n");
     printf("    -h, --help                      : Show tool version and command line usage help\n\n");
-    printf("    -i, --input <filename.ext>      : Define input file.\n");
-    printf("                                      Supported extensions: .rfx, .wav, .ogg, .flac, .mp3\n\n");
+    printf("    -i, --input <filename.ext>      : Define input file, multiple .rfx files can be provided.\n");
+    printf("                                      Supported extensions: .rfx, .wav, .ogg, .flac, .mp3\n");
+    printf("                                      NOTE: Use - to read .rfx data from stdin\n\n");
     printf("    -o, --output <filename.ext>     : Define output file.\n");
     printf("                                      Supported extensions: .wav, .raw, .h\n");
-    printf("                                      NOTE: If not specified, defaults to: output.wav\n\n");
+    printf("                                      NOTE: If not specified, defaults to: output.wav\n");
+    printf("                                      NOTE: Use - to write to stdout, as generated (--output-format required)\n\n");
+    printf("    --output-format <wav|raw>       : Define output format, output file extension is not used.\n\n");
     printf("    -f, --format <sample_rate>,<sample_size>,<channels>\n");
     printf("                                    : Define output wave format. Comma separated values.\n");
     printf("                                      Supported values:\n");
@@ -986,7 +1640,51 @@ static void ShowCommandLineInfo(void)
     printf("                                          Channels:         1 (mono), 2 (stereo)\n");
     printf("                                      NOTE: If not specified, defaults to: 44100, 16, 1\n\n");
     printf("    -p, --play <filename.ext>       : Play provided sound.\n");
-    printf("                                      Supported extensions: .wav, .ogg, .flac, .mp3\n");
+    printf("                                      Supported extensions: .wav, .ogg, .flac, .mp3, .rfx\n");
+    printf("                                      NOTE: .rfx sounds are generated while playing, use - to read from stdin\n\n");
+    printf("    --manifest <filename.csv>       : Convert manifest entries as batch, one entry per line.\n");
+    printf("                                      Columns: source (.rfx file or preset: coin, laser, explosion,\n");
+    printf("                                      powerup, hit, jump, blip, random), seed, output (.wav, .raw),\n");
+    printf("                                      sample_rate, sample_size, channels, wave parameters overrides\n");
+    printf("                                      (attackTime, slide, lpfCutoff...). First line names columns.\n");
+    printf("                                      NOTE: Relative paths are resolved from manifest directory\n\n");
+    printf("    --output-dir <path>             : Define output directory for batch conversion.\n");
+    printf("                                      NOTE: If not specified, outputs go to input files directory\n\n");
+    printf("    -j, --jobs <count>              : Define worker threads for batch conversion.\n");
+    printf("                                      NOTE: If not specified, one per processor is used\n\n");
+    printf("    --incremental <filename.txt>    : Batch conversion skips up to date outputs, state saved to file.\n");
+    printf("                                      Outputs are converted if wave parameters, output format or\n");
+    printf("                                      generator version changed, or output file was modified\n\n");
+    printf("    --force                         : Convert up to date outputs on incremental conversion.\n\n");
+    printf("    --trace <filename.json>         : Save batch conversion trace events (Chrome tracing, Perfetto).\n\n");
+    printf("    --profile                       : Profile input .rfx wave generation, per stage ns/sample.\n");
+    printf("                                      NOTE: Requires a build with SUPPORT_PROFILING, optimized build\n");
+    printf("                                      with: make PROFILING=TRUE (debug builds are not representative)\n\n");
+    printf("    --cache-dir <path>              : Define render cache directory, generated waves are reused\n");
+    printf("                                      between runs and processes (also GUI and serve mode).\n");
+    printf("                                      NOTE: If not specified, defaults to user cache directory:\n");
+    printf("                                      $XDG_CACHE_HOME/rfxgen, %%LOCALAPPDATA%%\\rfxgen\\cache\n\n");
+    printf("    --cache-size <size_mb>          : Define render cache max size, least recently used waves\n");
+    printf("                                      removed over it (0 for no limit). Default: %i MB\n\n", RENDER_CACHE_DEFAULT_SIZE/(1024*1024));
+    printf("    --no-cache                      : Disable render cache, waves are always generated.\n\n");
+    printf("    --shard <index>/<count>         : Convert batch inputs of one shard (1 to count), inputs are\n");
+    printf("                                      selected by input path hash (manifest entries: output path).\n");
+    printf("                                      NOTE: Same inputs (relative paths) must be provided to every shard\n\n");
+    printf("    --queue <path>                  : Convert batch inputs as jobs of a work queue directory shared\n");
+    printf("                                      by several processes (and machines), every job is claimed by\n");
+    printf("                                      one process (atomic rename). First process creates the jobs.\n");
+    printf("                                      NOTE: Remove queue directory to convert inputs again\n\n");
+    printf("    --merge-state <filename.txt> <filename.txt>...\n");
+    printf("                                    : Merge incremental conversion state files (one per shard or\n");
+    printf("                                      process) into first file, latest record kept per output.\n\n");
+    printf("    --watch <path>                  : Convert .rfx files changed on directory tree to .wav files,\n");
+    printf("                                      new and out of date files converted on start. Outputs keep\n");
+    printf("                                      relative paths on --output-dir, replaced at once when written.\n");
+    printf("                                      NOTE: Runs until SIGINT/SIGTERM, only supported on Linux\n\n");
+    printf("    --serve <socket>                : Render .rfx requests received on a UNIX domain socket.\n");
+    printf("                                      Requests are rendered by --jobs worker threads, pipelined\n");
+    printf("                                      responses sent in order, a STAT request returns JSON stats.\n");
+    printf("                                      NOTE: Runs until SIGINT/SIGTERM, not supported on Windows\n");
 
     printf("\nEXAMPLES:\n\n");
     printf("    > rfxgen --input sound.rfx --output jump.wav\n");
@@ -997,7 +1695,38 @@ static void ShowCommandLineInfo(void)
     printf("        Process <sound.ogg> to generate <output.wav> and play <output.wav>\n\n");
     printf("    > rfxgen --input sound.mp3 --output jump.wav --format 22050,8,1 --play jump.wav\n");
     printf("        Process <sound.mp3> to generate <jump.wav> at 22050 Hz, 8 bit, Stereo.\n");
-    printf("        Plays generated sound <jump.wav>.\n");
+    printf("        Plays generated sound <jump.wav>.\n\n");
+    printf("    > cat coin.rfx | rfxgen --input - --output - --output-format raw --format 44100,16,2 | encoder\n");
+    printf("        Process .rfx data from stdin, raw 44100 Hz, 16 bit, Stereo samples written to stdout\n\n");
+    printf("    > rfxgen --play coin.rfx\n");
+    printf("        Play <coin.rfx> generated while playing, no intermediate file\n\n");
+    printf("    > cat coin.rfx | rfxgen --play -\n");
+    printf("        Play .rfx data read from stdin\n\n");
+    printf("    > rfxgen coin.rfx jump.rfx shoot.rfx\n");
+    printf("        Open GUI with <coin.rfx>, <jump.rfx> and <shoot.rfx> loaded into slots 1, 2 and 3\n\n");
+    printf("    > rfxgen --input coin.rfx jump.rfx shoot.rfx --output-dir sounds --jobs 4 --trace batch.json\n");
+    printf("        Process .rfx files into <sounds> directory as .wav files, using 4 worker threads.\n");
+    printf("        Conversion spans per file and thread are saved into <batch.json>\n\n");
+    printf("    > rfxgen --manifest variants.csv --jobs 4\n");
+    printf("        Convert <variants.csv> entries, i.e.: source,seed,output,sample_rate,slide\n");
+    printf("                                             coin,42,coin_high.wav,22050,0.2\n\n");
+    printf("    > rfxgen --manifest variants.csv --incremental variants.state.txt\n");
+    printf("        Convert <variants.csv> entries changed since last run, rebuilt outputs are reported\n\n");
+    printf("    > rfxgen --input coin.rfx jump.rfx --output-dir sounds --cache-dir /shared/rfxgen-cache\n");
+    printf("        Process .rfx files into <sounds>, waves already generated by any process sharing the\n");
+    printf("        cache directory are loaded instead of generated\n\n");
+    printf("    > rfxgen --manifest bake.csv --output-dir /shared/audio --shard 2/8 --incremental bake.2.txt\n");
+    printf("        Convert second of 8 shards of <bake.csv> entries, i.e. on second of 8 build machines\n\n");
+    printf("    > rfxgen --manifest bake.csv --output-dir /shared/audio --queue /shared/bake.queue\n");
+    printf("        Convert <bake.csv> entries not claimed by other processes sharing </shared/bake.queue>\n\n");
+    printf("    > rfxgen --merge-state bake.txt bake.1.txt bake.2.txt bake.3.txt\n");
+    printf("        Merge per shard conversion states into <bake.txt>\n\n");
+    printf("    > rfxgen --input sound.rfx --profile\n");
+    printf("        Process <sound.rfx> to generate <output.wav>, profiling wave generation stages\n\n");
+    printf("    > rfxgen --watch sounds --output-dir assets/audio\n");
+    printf("        Convert .rfx files on <sounds> tree to <assets/audio> as they are saved\n\n");
+    printf("    > rfxgen --serve /tmp/rfxgen.sock --jobs 4\n");
+    printf("        Render requests received on </tmp/rfxgen.sock> using 4 worker threads\n");
 }
 
 // Process command line input
@@ -1005,10 +1734,32 @@ static void ProcessCommandLine(int argc, char *argv[])
 {
     // CLI required variables
     bool showUsageInfo = false;         // Toggle command line usage info
+    bool profileGeneration = false;     // Toggle wave generation profiling
+    bool forceConversion = false;       // Toggle conversion of up to date outputs (incremental conversion)
+    bool cacheDisabled = false;         // Toggle render cache usage, waves always generated
 
     char inFileName[512] = { 0 };       // Input file name
     char outFileName[512] = { 0 };      // Output file name
     char playFileName[512] = { 0 };     // Play file name
+    char outFormat[8] = { 0 };          // Output format: wav, raw, h (output file extension if not provided)
+
+    const char **inFileNames = (const char **)RL_CALLOC(argc, sizeof(const char *));  // Input file names (batch conversion)
+    int inFileCount = 0;                // Input files count
+    const char *outDirectory = NULL;    // Output directory (batch conversion)
+    const char *traceFileName = NULL;   // Trace events file name (batch conversion)
+    const char *manifestFileName = NULL;    // Conversion manifest file name (batch conversion)
+    const char *stateFileName = NULL;   // Incremental conversion state file name (batch conversion)
+    const char *queuePath = NULL;       // Conversion work queue directory (batch conversion shared by processes)
+    const char *mergeFileName = NULL;   // Merged conversion state file name
+    const char **mergeFileNames = (const char **)RL_CALLOC(argc, sizeof(const char *));   // Conversion state files to merge
+    int mergeFileCount = 0;             // Conversion state files to merge count
+    int shardIndex = 0;                 // Batch conversion shard index (0 based)
+    int shardCount = 1;                 // Batch conversion shards count, inputs selected by path hash
+    const char *socketPath = NULL;      // Serve mode socket path
+    const char *watchPath = NULL;       // Watch mode directory path
+    const char *cachePath = NULL;       // Render cache directory path, user cache directory if not provided
+    int cacheSize = RENDER_CACHE_DEFAULT_SIZE/(1024*1024);  // Render cache max size in MB
+    int jobCount = 0;                   // Worker threads for conversion, 0 uses number of processors
 
     int sampleRate = 44100;             // Default conversion sample rate
     int sampleSize = 16;                // Default conversion sample size
@@ -1026,29 +1777,38 @@ static void ProcessCommandLine(int argc, char *argv[])
         else if ((strcmp(argv[i], "-i") == 0) || (strcmp(argv[i], "--input") == 0))
         {
             // Check for valid argument and valid file extension
-            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            // NOTE: Multiple input files can be provided for batch conversion, .rfx data could be read from stdin ("-")
+            if (((i + 1) < argc) && ((argv[i + 1][0] != '-') || (strcmp(argv[i + 1], "-") == 0)))
             {
-                if (IsFileExtension(argv[i + 1], ".rfx") ||
-                    IsFileExtension(argv[i + 1], ".wav") ||
-                    IsFileExtension(argv[i + 1], ".ogg") ||
-                    IsFileExtension(argv[i + 1], ".flac") ||
-                    IsFileExtension(argv[i + 1], ".mp3"))
+                while (((i + 1) < argc) && ((argv[i + 1][0] != '-') || (strcmp(argv[i + 1], "-") == 0)))
                 {
-                    strcpy(inFileName, argv[i + 1]);    // Read input filename
-                }
-                else LOG("WARNING: Input file extension not recognized\n");
+                    if (IsFileExtension(argv[i + 1], ".rfx") ||
+                        IsFileExtension(argv[i + 1], ".wav") ||
+                        IsFileExtension(argv[i + 1], ".ogg") ||
+                        IsFileExtension(argv[i + 1], ".flac") ||
+                        IsFileExtension(argv[i + 1], ".mp3") ||
+                        (strcmp(argv[i + 1], "-") == 0))
+                    {
+                        if (inFileCount == 0) strcpy(inFileName, argv[i + 1]);    // Read input filename
+                        inFileNames[inFileCount] = argv[i + 1];
+                        inFileCount++;
+                    }
+                    else LOG("WARNING: [%s] Input file extension not recognized\n", argv[i + 1]);
 
-                i++;
+                    i++;
+                }
             }
             else LOG("WARNING: No input file provided\n");
         }
         else if ((strcmp(argv[i], "-o") == 0) || (strcmp(argv[i], "--output") == 0))
         {
-            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            // NOTE: Output data could be written to stdout ("-"), output format required
+            if (((i + 1) < argc) && ((argv[i + 1][0] != '-') || (strcmp(argv[i + 1], "-") == 0)))
             {
                 if (IsFileExtension(argv[i + 1], ".wav") ||
                     IsFileExtension(argv[i + 1], ".raw") ||
-                    IsFileExtension(argv[i + 1], ".h"))
+                    IsFileExtension(argv[i + 1], ".h") ||
+                    (strcmp(argv[i + 1], "-") == 0))
                 {
                     strcpy(outFileName, argv[i + 1]);   // Read output filename
                 }
@@ -1058,6 +1818,17 @@ static void ProcessCommandLine(int argc, char *argv[])
             }
             else LOG("WARNING: No output file provided\n");
         }
+        else if (strcmp(argv[i], "--output-format") == 0)
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                if ((strcmp(argv[i + 1], "wav") == 0) || (strcmp(argv[i + 1], "raw") == 0)) strcpy(outFormat, argv[i + 1]);
+                else LOG("WARNING: Output format not supported, supported formats: wav, raw\n");
+
+                i++;
+            }
+            else LOG("WARNING: No output format provided\n");
+        }
         else if ((strcmp(argv[i], "-f") == 0) || (strcmp(argv[i], "--format") == 0))
         {
             if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
@@ -1097,15 +1868,17 @@ static void ProcessCommandLine(int argc, char *argv[])
         }
         else if ((strcmp(argv[i], "-p") == 0) || (strcmp(argv[i], "--play") == 0))
         {
-            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            // NOTE: Wave parameters (.rfx data) could be played from stdin ("-")
+            if (((i + 1) < argc) && ((argv[i + 1][0] != '-') || (strcmp(argv[i + 1], "-") == 0)))
             {
                 if (IsFileExtension(argv[i + 1], ".wav") ||
                     IsFileExtension(argv[i + 1], ".ogg") ||
                     IsFileExtension(argv[i + 1], ".flac") ||
-                    IsFileExtension(argv[i + 1], ".mp3"))
+                    IsFileExtension(argv[i + 1], ".mp3") ||
+                    IsFileExtension(argv[i + 1], ".rfx") ||
+                    (strcmp(argv[i + 1], "-") == 0))
                 {
                     strcpy(playFileName, argv[i + 1]);   // Read filename to play
-                    i++;
                 }
                 else LOG("WARNING: Play file format not supported\n");
 
@@ -1113,900 +1886,3412 @@ static void ProcessCommandLine(int argc, char *argv[])
             }
             else LOG("WARNING: No file to play provided\n");
         }
-    }
-
-    // Process input file if provided
-    if (inFileName[0] != '\0')
-    {
-        if (outFileName[0] == '\0') strcpy(outFileName, "output.wav");  // Set a default name for output in case not provided
-
-        LOG("\nInput file:       %s", inFileName);
-        LOG("\nOutput file:      %s", outFileName);
-        LOG("\nOutput format:    %i Hz, %i bits, %s\n\n", sampleRate, sampleSize, (channels == 1)? "Mono" : "Stereo");
-
-        Wave wave = { 0 };
-
-        if (IsFileExtension(inFileName, ".rfx")) // || IsFileExtension(inFileName, ".sfs"))
-        {
-            WaveParams params = LoadWaveParams(inFileName);
-            wave = GenerateWave(params);
-        }
-        else if (IsFileExtension(inFileName, ".wav") ||
-                 IsFileExtension(inFileName, ".ogg") ||
-                 IsFileExtension(inFileName, ".flac") ||
-                 IsFileExtension(inFileName, ".mp3"))
+        else if (strcmp(argv[i], "--manifest") == 0)
         {
-            wave = LoadWave(inFileName);
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                if (IsFileExtension(argv[i + 1], ".csv")) manifestFileName = argv[i + 1];
+                else LOG("WARNING: Manifest file extension not recognized\n");
+                i++;
+            }
+            else LOG("WARNING: No manifest file provided\n");
         }
-
-        // Format wave data to desired sampleRate, sampleSize and channels
-        WaveFormat(&wave, sampleRate, sampleSize, channels);
-
-        // Export wave data as audio file (.wav) or code file (.h)
-        if (IsFileExtension(outFileName, ".wav")) ExportWave(wave, outFileName);
-        else if (IsFileExtension(outFileName, ".h")) ExportWaveAsCode(wave, outFileName);
-        else if (IsFileExtension(outFileName, ".raw"))
+        else if (strcmp(argv[i], "--incremental") == 0)
         {
-            // Export Wave as RAW data
-            FILE *rawFile = fopen(outFileName, "wb");
-
-            if (rawFile != NULL)
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
             {
-                fwrite(wave.data, 1, wave.frameCount*wave.channels*wave.sampleSize/8, rawFile);  // Write wave data
-                fclose(rawFile);
+                stateFileName = argv[i + 1];
+                i++;
             }
+            else LOG("WARNING: No conversion state file provided\n");
         }
-
-        UnloadWave(wave);
-    }
-
-    // Play audio file if provided
-    if (playFileName[0] != '\0')
-    {
-        Wave wave = LoadWave(playFileName);     // Load audio (WAV, OGG, FLAC, MP3)
-        PlayWaveCLI(wave);
-        UnloadWave(wave);
-    }
-
-    if (showUsageInfo) ShowCommandLineInfo();
-}
-#endif      // PLATFORM_DESKTOP
-
-//--------------------------------------------------------------------------------------------
-// Load/Save/Export functions
-//--------------------------------------------------------------------------------------------
-
-// Reset wave parameters
-static void ResetWaveParams(WaveParams *params)
-{
-    // NOTE: Random seed is set to a random value
-    params->randSeed = GetRandomValue(0x1, 0xFFFE);
-    srand(params->randSeed);
-
-    // Wave type
-    params->waveTypeValue = 0;
-
-    // Wave envelope params
-    params->attackTimeValue = 0.0f;
-    params->sustainTimeValue = 0.3f;
-    params->sustainPunchValue = 0.0f;
-    params->decayTimeValue = 0.4f;
-
-    // Frequency params
-    params->startFrequencyValue = 0.3f;
-    params->minFrequencyValue = 0.0f;
-    params->slideValue = 0.0f;
-    params->deltaSlideValue = 0.0f;
-    params->vibratoDepthValue = 0.0f;
-    params->vibratoSpeedValue = 0.0f;
-    //params->vibratoPhaseDelay = 0.0f;
-
-    // Tone change params
-    params->changeAmountValue = 0.0f;
-    params->changeSpeedValue = 0.0f;
-
-    // Square wave params
-    params->squareDutyValue = 0.0f;
-    params->dutySweepValue = 0.0f;
-
-    // Repeat params
-    params->repeatSpeedValue = 0.0f;
-
-    // Phaser params
-    params->phaserOffsetValue = 0.0f;
-    params->phaserSweepValue = 0.0f;
-
-    // Filter params
-    params->lpfCutoffValue = 1.0f;
-    params->lpfCutoffSweepValue = 0.0f;
-    params->lpfResonanceValue = 0.0f;
-    params->hpfCutoffValue = 0.0f;
-    params->hpfCutoffSweepValue = 0.0f;
-}
-
-// Generates new wave from wave parameters
-// NOTE: By default wave is generated as 44100Hz, 32bit float, mono
-static Wave GenerateWave(WaveParams params)
-{
-    #define MAX_WAVE_LENGTH_SECONDS  10     // Max length for wave: 10 seconds
-    #define WAVE_SAMPLE_RATE      44100     // Default sample rate
-
-    #define rnd(n) (rand()%(n + 1))
-    #define GetRandomFloat(range) ((float)rnd(10000)/10000*range)
-
-    if (params.randSeed != 0) srand(params.randSeed);   // Initialize seed if required
-
-    // Configuration parameters for generation
-    // NOTE: Those parameters are calculated from selected values
-    int phase = 0;
-    double fperiod = 0.0;
-    double fmaxperiod = 0.0;
-    double fslide = 0.0;
-    double fdslide = 0.0;
-    int period = 0;
-    float squareDuty = 0.0f;
-    float squareSlide = 0.0f;
-    int envelopeStage = 0;
-    int envelopeTime = 0;
-    int envelopeLength[3] = { 0 };
-    float envelopeVolume = 0.0f;
-    float fphase = 0.0f;
-    float fdphase = 0.0f;
-    int iphase = 0;
-    float phaserBuffer[1024] = { 0 };
-    int ipp = 0;
-    float noiseBuffer[32] = { 0 };       // Required for noise wave, depends on random seed!
-    float fltp = 0.0f;
-    float fltdp = 0.0f;
-    float fltw = 0.0f;
-    float fltwd = 0.0f;
-    float fltdmp = 0.0f;
-    float fltphp = 0.0f;
-    float flthp = 0.0f;
-    float flthpd = 0.0f;
-    float vibratoPhase = 0.0f;
-    float vibratoSpeed = 0.0f;
-    float vibratoAmplitude = 0.0f;
-    int repeatTime = 0;
-    int repeatLimit = 0;
-    int arpeggioTime = 0;
-    int arpeggioLimit = 0;
-    double arpeggioModulation = 0.0;
-
-    // HACK: Security check to avoid crash (why?)
-    if (params.minFrequencyValue > params.startFrequencyValue) params.minFrequencyValue = params.startFrequencyValue;
-    if (params.slideValue < params.deltaSlideValue) params.slideValue = params.deltaSlideValue;
-
-    // Reset sample parameters
-    //----------------------------------------------------------------------------------------
-    fperiod = 100.0/(params.startFrequencyValue*params.startFrequencyValue + 0.001);
-    period = (int)fperiod;
-    fmaxperiod = 100.0/(params.minFrequencyValue*params.minFrequencyValue + 0.001);
-    fslide = 1.0 - pow((double)params.slideValue, 3.0)*0.01;
-    fdslide = -pow((double)params.deltaSlideValue, 3.0)*0.000001;
-    squareDuty = 0.5f - params.squareDutyValue*0.5f;
-    squareSlide = -params.dutySweepValue*0.00005f;
-
-    if (params.changeAmountValue >= 0.0f) arpeggioModulation = 1.0 - pow((double)params.changeAmountValue, 2.0)*0.9;
-    else arpeggioModulation = 1.0 + pow((double)params.changeAmountValue, 2.0)*10.0;
-
-    arpeggioLimit = (int)(powf(1.0f - params.changeSpeedValue, 2.0f)*20000 + 32);
-
-    if (params.changeSpeedValue == 1.0f) arpeggioLimit = 0;     // WATCH OUT: float comparison
-
-    // Reset filter parameters
-    fltw = powf(params.lpfCutoffValue, 3.0f)*0.1f;
-    fltwd = 1.0f + params.lpfCutoffSweepValue*0.0001f;
-    fltdmp = 5.0f/(1.0f + powf(params.lpfResonanceValue, 2.0f)*20.0f)*(0.01f + fltw);
-    if (fltdmp > 0.8f) fltdmp = 0.8f;
-    flthp = powf(params.hpfCutoffValue, 2.0f)*0.1f;
-    flthpd = 1.0f + params.hpfCutoffSweepValue*0.0003f;
-
-    // Reset vibrato
-    vibratoSpeed = powf(params.vibratoSpeedValue, 2.0f)*0.01f;
-    vibratoAmplitude = params.vibratoDepthValue*0.5f;
-
-    // Reset envelope
-    envelopeLength[0] = (int)(params.attackTimeValue*params.attackTimeValue*100000.0f);
-    envelopeLength[1] = (int)(params.sustainTimeValue*params.sustainTimeValue*100000.0f);
-    envelopeLength[2] = (int)(params.decayTimeValue*params.decayTimeValue*100000.0f);
-
-    fphase = powf(params.phaserOffsetValue, 2.0f)*1020.0f;
-    if (params.phaserOffsetValue < 0.0f) fphase = -fphase;
-
-    fdphase = powf(params.phaserSweepValue, 2.0f)*1.0f;
-    if (params.phaserSweepValue < 0.0f) fdphase = -fdphase;
-
-    iphase = abs((int)fphase);
-
-    for (int i = 0; i < 32; i++) noiseBuffer[i] = GetRandomFloat(2.0f) - 1.0f;      // WATCH OUT: GetRandomFloat()
-
-    repeatLimit = (int)(powf(1.0f - params.repeatSpeedValue, 2.0f)*20000 + 32);
-
-    if (params.repeatSpeedValue == 0.0f) repeatLimit = 0;
-    //----------------------------------------------------------------------------------------
-
-    // NOTE: We reserve enough space for up to 10 seconds of wave audio at given sample rate
-    // By default we use float size samples, they are converted to desired sample size at the end
-    float *buffer = (float *)RL_CALLOC(MAX_WAVE_LENGTH_SECONDS*WAVE_SAMPLE_RATE, sizeof(float));
-    bool generatingSample = true;
-    int sampleCount = 0;
-
-    for (int i = 0; i < MAX_WAVE_LENGTH_SECONDS*WAVE_SAMPLE_RATE; i++)
-    {
-        if (!generatingSample)
+        else if (strcmp(argv[i], "--force") == 0)
         {
-            sampleCount = i;
-            break;
+            forceConversion = true;
         }
-
-        // Generate sample using selected parameters
-        //------------------------------------------------------------------------------------
-        repeatTime++;
-
-        if ((repeatLimit != 0) && (repeatTime >= repeatLimit))
+        else if (strcmp(argv[i], "--shard") == 0)
         {
-            // Reset sample parameters (only some of them)
-            repeatTime = 0;
-
-            fperiod = 100.0/(params.startFrequencyValue*params.startFrequencyValue + 0.001);
-            period = (int)fperiod;
-            fmaxperiod = 100.0/(params.minFrequencyValue*params.minFrequencyValue + 0.001);
-            fslide = 1.0 - pow((double)params.slideValue, 3.0)*0.01;
-            fdslide = -pow((double)params.deltaSlideValue, 3.0)*0.000001;
-            squareDuty = 0.5f - params.squareDutyValue*0.5f;
-            squareSlide = -params.dutySweepValue*0.00005f;
-
-            if (params.changeAmountValue >= 0.0f) arpeggioModulation = 1.0 - pow((double)params.changeAmountValue, 2.0)*0.9;
-            else arpeggioModulation = 1.0 + pow((double)params.changeAmountValue, 2.0)*10.0;
-
-            arpeggioTime = 0;
-            arpeggioLimit = (int)(powf(1.0f - params.changeSpeedValue, 2.0f)*20000 + 32);
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                // NOTE: Shards are numbered from 1 (--shard 1/4 to --shard 4/4)
+                int index = 0;
+                int count = 0;
 
-            if (params.changeSpeedValue == 1.0f) arpeggioLimit = 0;     // WATCH OUT: float comparison
+                if ((sscanf(argv[i + 1], "%i/%i", &index, &count) == 2) && (count > 0) && (index >= 1) && (index <= count))
+                {
+                    shardIndex = index - 1;
+                    shardCount = count;
+                }
+                else LOG("WARNING: Shard not valid (<index>/<count>, i.e. 1/4). Default: all inputs converted\n");
+                i++;
+            }
+            else LOG("WARNING: No shard provided\n");
         }
-
-        // Frequency envelopes/arpeggios
-        arpeggioTime++;
-
-        if ((arpeggioLimit != 0) && (arpeggioTime >= arpeggioLimit))
+        else if (strcmp(argv[i], "--queue") == 0)
         {
-            arpeggioLimit = 0;
-            fperiod *= arpeggioModulation;
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                queuePath = argv[i + 1];
+                i++;
+            }
+            else LOG("WARNING: No work queue directory provided\n");
         }
-
-        fslide += fdslide;
-        fperiod *= fslide;
-
-        if (fperiod > fmaxperiod)
+        else if (strcmp(argv[i], "--merge-state") == 0)
         {
-            fperiod = fmaxperiod;
-
-            if (params.minFrequencyValue > 0.0f) generatingSample = false;
+            // NOTE: First file is merged output, next files are conversion state files to merge
+            if (((i + 2) < argc) && (argv[i + 1][0] != '-') && (argv[i + 2][0] != '-'))
+            {
+                mergeFileName = argv[++i];
+                while (((i + 1) < argc) && (argv[i + 1][0] != '-')) mergeFileNames[mergeFileCount++] = argv[++i];
+            }
+            else LOG("WARNING: No conversion state files to merge provided\n");
         }
-
-        float rfperiod = (float)fperiod;
-
-        if (vibratoAmplitude > 0.0f)
+        else if (strcmp(argv[i], "--output-dir") == 0)
         {
-            vibratoPhase += vibratoSpeed;
-            rfperiod = (float)(fperiod*(1.0 + sinf(vibratoPhase)*vibratoAmplitude));
-        }
-
-        period = (int)rfperiod;
-
-        if (period < 8) period=8;
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                outDirectory = argv[i + 1];
+                i++;
+            }
+            else LOG("WARNING: No output directory provided\n");
+        }
+        else if ((strcmp(argv[i], "-j") == 0) || (strcmp(argv[i], "--jobs") == 0))
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                jobCount = TextToInteger(argv[i + 1]);
+                if (jobCount <= 0) LOG("WARNING: Jobs count not valid. Default: one per processor\n");
+                i++;
+            }
+            else LOG("WARNING: No jobs count provided\n");
+        }
+        else if (strcmp(argv[i], "--trace") == 0)
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                if (IsFileExtension(argv[i + 1], ".json")) traceFileName = argv[i + 1];
+                else LOG("WARNING: Trace file extension not recognized\n");
+                i++;
+            }
+            else LOG("WARNING: No trace file provided\n");
+        }
+        else if (strcmp(argv[i], "--profile") == 0)
+        {
+            profileGeneration = true;
+        }
+        else if (strcmp(argv[i], "--watch") == 0)
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                watchPath = argv[i + 1];
+                i++;
+            }
+            else LOG("WARNING: No watch directory provided\n");
+        }
+        else if (strcmp(argv[i], "--serve") == 0)
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                socketPath = argv[i + 1];
+                i++;
+            }
+            else LOG("WARNING: No serve socket path provided\n");
+        }
+        else if (strcmp(argv[i], "--cache-dir") == 0)
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                cachePath = argv[i + 1];
+                i++;
+            }
+            else LOG("WARNING: No render cache directory provided\n");
+        }
+        else if (strcmp(argv[i], "--cache-size") == 0)
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                cacheSize = TextToInteger(argv[i + 1]);
+                if (cacheSize < 0)
+                {
+                    LOG("WARNING: Render cache size not valid. Default: %i MB\n", RENDER_CACHE_DEFAULT_SIZE/(1024*1024));
+                    cacheSize = RENDER_CACHE_DEFAULT_SIZE/(1024*1024);
+                }
+                i++;
+            }
+            else LOG("WARNING: No render cache size provided\n");
+        }
+        else if (strcmp(argv[i], "--no-cache") == 0)
+        {
+            cacheDisabled = true;
+        }
+    }
 
-        squareDuty += squareSlide;
+    // Render cache loaded if sounds are going to be generated, waves are reused between runs
+    // NOTE: Cache directory could be shared by several processes (and GUI), entries are never partially read
+    if (!cacheDisabled && ((socketPath != NULL) || (watchPath != NULL) || (manifestFileName != NULL) || (inFileCount > 0)))
+    {
+        renderCache = LoadRenderCache(cachePath, (long long)cacheSize*1024*1024);
+        if (!renderCache.ready) LOG("WARNING: [%s] Render cache directory not available, sounds are generated\n", renderCache.path);
+    }
 
-        if (squareDuty < 0.0f) squareDuty = 0.0f;
-        if (squareDuty > 0.5f) squareDuty = 0.5f;
+    // Merge conversion state files: per shard (or per process) incremental conversion states merged into one
+    if (mergeFileName != NULL)
+    {
+        if (!MergeConversionStates(mergeFileName, mergeFileNames, mergeFileCount)) LOG("WARNING: [%s] Merged conversion state file could not be saved\n", mergeFileName);
+        RL_FREE(mergeFileNames);
+        RL_FREE(inFileNames);
+        return;
+    }
 
-        // Volume envelope
-        envelopeTime++;
+    RL_FREE(mergeFileNames);
 
-        if (envelopeTime > envelopeLength[envelopeStage])
-        {
-            envelopeTime = 0;
-            envelopeStage++;
+    // Serve mode: one process renders requests received on a UNIX domain socket, until SIGINT/SIGTERM
+    // NOTE: Other conversion arguments are ignored, output format is provided per request
+    if (socketPath != NULL)
+    {
+        RunServe(socketPath, jobCount);
+        TrimRenderCache(&renderCache);
+        RL_FREE(inFileNames);
+        return;
+    }
 
-            if (envelopeStage == 3) generatingSample = false;
-        }
+    // Watch mode: .rfx files changed on directory tree converted, until SIGINT/SIGTERM
+    if (watchPath != NULL)
+    {
+        RunWatch(watchPath, outDirectory, sampleRate, sampleSize, channels, jobCount);
+        TrimRenderCache(&renderCache);
+        RL_FREE(inFileNames);
+        return;
+    }
 
-        if (envelopeStage == 0) envelopeVolume = (float)envelopeTime/envelopeLength[0];
-        if (envelopeStage == 1) envelopeVolume = 1.0f + powf(1.0f - (float)envelopeTime/envelopeLength[1], 1.0f)*2.0f*params.sustainPunchValue;
-        if (envelopeStage == 2) envelopeVolume = 1.0f - (float)envelopeTime/envelopeLength[2];
+    // Process input files as batch, if multiple files, manifest, output directory or trace provided
+    // NOTE: Files are converted in parallel on worker threads, only .rfx to .wav conversion is supported,
+    // manifest entries also support presets, parameters overrides, .raw output and per entry format
+    if ((inFileCount > 1) || (manifestFileName != NULL) || (outDirectory != NULL) || (traceFileName != NULL) || (stateFileName != NULL) ||
+        (shardCount > 1) || (queuePath != NULL))
+    {
+        ConversionTask *conversions = NULL;
+        int conversionCount = 0;
 
-        // Phaser step
-        fphase += fdphase;
-        iphase = abs((int)fphase);
+        if (manifestFileName != NULL)
+        {
+            if (inFileCount > 0) LOG("WARNING: Input files ignored, manifest entries are converted\n");
+            conversions = LoadConversionManifest(manifestFileName, outDirectory, sampleRate, sampleSize, channels, &conversionCount);
+        }
+        else conversions = (ConversionTask *)RL_CALLOC(inFileCount, sizeof(ConversionTask));
 
-        if (iphase > 1023) iphase = 1023;
+        if ((manifestFileName == NULL) && (outFileName[0] != '\0') && ((inFileCount > 1) || !IsFileExtension(outFileName, ".wav")))
+        {
+            LOG("WARNING: Output file ignored on batch conversion, .wav files named as input files are generated\n");
+            outFileName[0] = '\0';
+        }
 
-        if (flthpd != 0.0f)     // WATCH OUT!
+        for (int i = 0; (i < inFileCount) && (manifestFileName == NULL); i++)
         {
-            flthp *= flthpd;
-            if (flthp < 0.00001f) flthp = 0.00001f;
-            if (flthp > 0.1f) flthp = 0.1f;
+            if (!IsFileExtension(inFileNames[i], ".rfx"))
+            {
+                LOG("WARNING: [%s] Only .rfx files supported on batch conversion\n", inFileNames[i]);
+                continue;
+            }
+
+            ConversionTask *conversion = &conversions[conversionCount];
+            conversion->inFileName = inFileNames[i];
+            conversion->outFileName = (outFileName[0] != '\0')? outFileName : NULL;
+            conversion->outDirectory = outDirectory;
+            conversion->sampleRate = sampleRate;
+            conversion->sampleSize = sampleSize;
+            conversion->channels = channels;
+            conversion->task.func = ConversionTaskFunc;
+            conversion->task.data = conversion;
+            conversionCount++;
         }
 
-        float ssample = 0.0f;
+        // Shard selection: job hash (input file name or manifest entry output) modulo shards count,
+        // every process computes the same hashes, inputs are split between shards with no coordination
+        int inputCount = conversionCount;
 
-        #define MAX_SUPERSAMPLING   8
+        for (int i = 0; i < conversionCount; i++) conversions[i].jobHash = GetConversionJobHash(&conversions[i], outDirectory, (manifestFileName != NULL));
 
-        // Supersampling x8
-        for (int si = 0; si < MAX_SUPERSAMPLING; si++)
+        if (shardCount > 1)
         {
-            float sample = 0.0f;
-            phase++;
+            conversionCount = 0;
 
-            if (phase >= period)
+            for (int i = 0; i < inputCount; i++)
             {
-                //phase = 0;
-                phase %= period;
-
-                if (params.waveTypeValue == 3)
+                if ((conversions[i].jobHash%shardCount) != (unsigned long long)shardIndex)
                 {
-                    for (int i = 0;i < 32; i++) noiseBuffer[i] = GetRandomFloat(2.0f) - 1.0f;   // WATCH OUT: GetRandomFloat()
+                    if (manifestFileName != NULL) RL_FREE((char *)conversions[i].inFileName);   // NOTE: Output file name on same allocation
+                    continue;
                 }
-            }
-
-            // base waveform
-            float fp = (float)phase/period;
-
-            switch (params.waveTypeValue)
-            {
-                case 0: // Square wave
-                {
-                    if (fp < squareDuty) sample = 0.5f;
-                    else sample = -0.5f;
 
-                } break;
-                case 1: sample = 1.0f - fp*2; break;    // Sawtooth wave
-                case 2: sample = sinf(fp*2*PI); break;  // Sine wave
-                case 3: sample = noiseBuffer[phase*32/period]; break; // Noise wave
-                default: break;
+                conversions[conversionCount] = conversions[i];
+                conversions[conversionCount].task.data = &conversions[conversionCount];
+                conversionCount++;
             }
+        }
 
-            // LP filter
-            float pp = fltp;
-            fltw *= fltwd;
-
-            if (fltw < 0.0f) fltw = 0.0f;
-            if (fltw > 0.1f) fltw = 0.1f;
+        // Work queue: jobs claimed on conversion, several processes (machines sharing the queue directory) convert same inputs
+        ConversionQueue queue = { 0 };
 
-            if (params.lpfCutoffValue != 1.0f)  // WATCH OUT!
+        if (queuePath != NULL)
+        {
+            if (LoadConversionQueue(queuePath, &queue, conversions, conversionCount))
             {
-                fltdp += (sample-fltp)*fltw;
-                fltdp -= fltdp*fltdmp;
+                for (int i = 0; i < conversionCount; i++)
+                {
+                    conversions[i].queue = &queue;
+                    conversions[i].task.func = QueuedConversionTaskFunc;
+                }
             }
             else
             {
-                fltp = sample;
-                fltdp = 0.0f;
+                LOG("WARNING: [%s] Work queue not available, batch conversion cancelled\n", queuePath);
+
+                // NOTE: Cancelled entries are not unloaded with the manifest, file names freed here
+                if (manifestFileName != NULL) for (int i = 0; i < conversionCount; i++) RL_FREE((char *)conversions[i].inFileName);
+                conversionCount = 0;
             }
+        }
+
+        WorkerPool *pool = LoadWorkerPool(jobCount);
+
+        if (manifestFileName != NULL)
+        {
+            LOG("\nManifest:         %s (%i entries)", manifestFileName, conversionCount);
+            LOG("\nOutput directory: %s", (outDirectory != NULL)? outDirectory : "(manifest directory)");
+            LOG("\nOutput format:    per entry, default %i Hz, %i bits, %s", sampleRate, sampleSize, (channels == 1)? "Mono" : "Stereo");
+        }
+        else
+        {
+            LOG("\nInput files:      %i", conversionCount);
+            LOG("\nOutput directory: %s", (outDirectory != NULL)? outDirectory : "(input files directory)");
+            LOG("\nOutput format:    %i Hz, %i bits, %s", sampleRate, sampleSize, (channels == 1)? "Mono" : "Stereo");
+        }
+        if (shardCount > 1) LOG("\nShard:            %i/%i (%i of %i inputs)", shardIndex + 1, shardCount, conversionCount, inputCount);
+        if (queue.path[0] != '\0') LOG("\nWork queue:       %s (claim: %s)", queue.path, queue.claimId);
+        LOG("\nWorker threads:   %i\n\n", GetWorkerPoolThreadCount(pool));
 
-            fltp += fltdp;
+        double startTime = GetProfilerTime();
 
-            // HP filter
-            fltphp += fltp - pp;
-            fltphp -= fltphp*flthp;
-            sample = fltphp;
+        // Incremental conversion: previous state loaded, all outputs converted if forced
+        ConversionState state = (stateFileName != NULL)? LoadConversionState(stateFileName) : (ConversionState){ 0 };
 
-            // Phaser
-            phaserBuffer[ipp & 1023] = sample;
-            sample += phaserBuffer[(ipp - iphase + 1024) & 1023];
-            ipp = (ipp + 1) & 1023;
+        // NOTE: Queued jobs are pushed from a per process offset, processes claim different jobs first
+        int firstConversion = 0;
+        if ((queue.path[0] != '\0') && (conversionCount > 0)) firstConversion = (int)(GetDataHash(0xcbf29ce484222325ULL, queue.claimId, (int)strlen(queue.claimId))%conversionCount);
 
-            // Final accumulation and envelope application
-            ssample += sample*envelopeVolume;
+        for (int c = 0; c < conversionCount; c++)
+        {
+            int i = (firstConversion + c)%conversionCount;
+            conversions[i].pool = pool;
+            conversions[i].state = ((stateFileName != NULL) && !forceConversion)? &state : NULL;
+            WorkerPoolPush(pool, &conversions[i].task);
         }
 
-        #define SAMPLE_SCALE_COEFICIENT 0.2f    // NOTE: Used to scale sample value to [-1..1]
+        WorkerPoolWait(pool);
 
-        ssample = (ssample/MAX_SUPERSAMPLING)*SAMPLE_SCALE_COEFICIENT;
-        //------------------------------------------------------------------------------------
+        double endTime = GetProfilerTime();
 
-        // Accumulate samples in the buffer
-        if (ssample > 1.0f) ssample = 1.0f;
-        if (ssample < -1.0f) ssample = -1.0f;
+        // Work queue: only jobs claimed by this process are reported, recorded and traced
+        ConversionTask *allConversions = conversions;
+        int allConversionCount = conversionCount;
 
-        buffer[i] = ssample;
-    }
+        if (queue.path[0] != '\0')
+        {
+            conversions = (ConversionTask *)RL_CALLOC(allConversionCount + 1, sizeof(ConversionTask));
+            conversionCount = 0;
 
-    Wave genWave = { 0 };
-    genWave.frameCount = sampleCount/1;    // Number of samples / channels
-    genWave.sampleRate = WAVE_SAMPLE_RATE; // By default 44100 Hz
-    genWave.sampleSize = 32;               // By default 32 bit float samples
-    genWave.channels = 1;                  // By default 1 channel (mono)
+            for (int i = 0; i < allConversionCount; i++) if (allConversions[i].claimed) conversions[conversionCount++] = allConversions[i];
+        }
 
-    // NOTE: Wave can be converted to desired format after generation
+        int successCount = 0;
+        int cachedCount = 0;
+        int generatedCount = 0;
+        long long bytesWritten = 0;
+        double stageTotal[CONVERSION_STAGE_COUNT] = { 0 };
 
-    genWave.data = (float *)RL_CALLOC(genWave.frameCount*genWave.channels, sizeof(float));
-    memcpy(genWave.data, buffer, genWave.frameCount*genWave.channels*sizeof(float));
+        for (int i = 0; i < conversionCount; i++)
+        {
+            if (conversions[i].success) successCount++;
+            if (conversions[i].cached) cachedCount++;
+            else if (conversions[i].rebuildReason != NULL) generatedCount++;      // NOTE: Up to date outputs are not generated
+            bytesWritten += conversions[i].bytesWritten;
 
-    RL_FREE(buffer);
+            for (int s = 0; s < CONVERSION_STAGE_COUNT; s++) stageTotal[s] += (conversions[i].stageTime[s + 1] - conversions[i].stageTime[s]);
+        }
 
-    return genWave;
-}
+        LOG("Converted %i/%i files in %.3f s: %.1f files/s, %.2f MB written\n", successCount, conversionCount, endTime - startTime,
+            (endTime > startTime)? conversionCount/(endTime - startTime) : 0.0, (double)bytesWritten/(1024*1024));
 
-// Load .rfx (rFXGen) or .sfs (sfxr) sound parameters file
-static WaveParams LoadWaveParams(const char *fileName)
-{
-    WaveParams params = { 0 };
+        // NOTE: Stages time is summed over worker threads, line format is parsed by rfxgen_bench --e2e
+        LOG("Stages time: load %.6f s, generate %.6f s, format %.6f s, encode %.6f s, write %.6f s\n", stageTotal[CONVERSION_STAGE_LOAD],
+            stageTotal[CONVERSION_STAGE_GENERATE], stageTotal[CONVERSION_STAGE_FORMAT], stageTotal[CONVERSION_STAGE_ENCODE], stageTotal[CONVERSION_STAGE_WRITE]);
 
-    if (IsFileExtension(fileName, ".rfx"))
-    {
-        FILE *rfxFile = fopen(fileName, "rb");
+        if (renderCache.ready)
+        {
+            LOG("Render cache: %i waves loaded, %i generated (%s)\n", cachedCount, generatedCount, renderCache.path);
+
+            // Cache only grows with generated waves, trimmed once over max size
+            if (generatedCount > 0) TrimRenderCache(&renderCache);
+        }
 
-        if (rfxFile != NULL)
+        if (stateFileName != NULL)
         {
-            // Read .rfx file header
-            unsigned char signature[5] = { 0 };
-            fread(signature, 4, sizeof(unsigned char), rfxFile);
+            // Report rebuilt outputs and conversion reason, state saved for next run
+            int rebuiltCount = 0;
 
-            // Check for valid .rfx file (FormatCC)
-            if ((signature[0] == 'r') &&
-                (signature[1] == 'F') &&
-                (signature[2] == 'X') &&
-                (signature[3] == ' '))
+            for (int i = 0; i < conversionCount; i++)
             {
-                unsigned short version = 0;
-                unsigned short length = 0;
-                fread(&version, 1, sizeof(unsigned short), rfxFile);
-                fread(&length, 1, sizeof(unsigned short), rfxFile);
+                if (conversions[i].rebuildReason == NULL) continue;
 
-                if (version != 200) LOG("[%s] rFX file version not supported (%i)\n", fileName, version);
-                else
-                {
-                    if (length != sizeof(WaveParams)) LOG("[%s] Wrong rFX wave parameters size\n", fileName);
-                    else fread(&params, 1, sizeof(WaveParams), rfxFile);   // Load wave generation parameters
-                }
+                LOG("Rebuilt: %s (%s)%s\n", conversions[i].record.fileName, conversions[i].rebuildReason, conversions[i].success? "" : " FAILED");
+                rebuiltCount++;
             }
-            else LOG("[%s] rFX file does not seem to be valid\n", fileName);
 
-            fclose(rfxFile);
-        }
-    }
-    /*
-    else if (IsFileExtension(fileName, ".sfs"))
-    {
-        // NOTE: It seem .sfs loading has some issues,
-        // I can't see the point to keep supporting this format
+            LOG("Incremental conversion: %i rebuilt, %i up to date\n", rebuiltCount, conversionCount - rebuiltCount);
 
-        FILE *sfsFile = fopen(fileName, "rb");
+            if (!SaveConversionState(stateFileName, state, conversions, conversionCount)) LOG("WARNING: [%s] Conversion state file could not be saved\n", stateFileName);
+        }
 
-        if (sfsFile == NULL) return params;
+        UnloadConversionState(state);
 
-        // Load .sfs sound parameters
-        int version = 0;
-        fread(&version, 1, sizeof(int), sfsFile);
+        if (traceFileName != NULL)
+        {
+            if (SaveConversionTrace(traceFileName, conversions, conversionCount, GetWorkerPoolThreadCount(pool), startTime, endTime)) LOG("Trace saved: %s\n", traceFileName);
+            else LOG("WARNING: [%s] Trace file could not be saved\n", traceFileName);
+        }
 
-        if ((version == 100) || (version == 101) || (version == 102))
+        if (queue.path[0] != '\0')
         {
-            fread(&params.waveTypeValue, 1, sizeof(int), sfsFile);
+            LOG("Work queue: %i jobs converted by this process, %i waiting, %i in progress, %i done, %i failed\n", conversionCount,
+                GetConversionQueueCount(&queue, "jobs"), GetConversionQueueCount(&queue, "claimed"),
+                GetConversionQueueCount(&queue, "done"), GetConversionQueueCount(&queue, "failed"));
 
-            volumeValue = 0.5f;
+            RL_FREE(conversions);
+            conversions = allConversions;
+            conversionCount = allConversionCount;
+        }
 
-            if (version == 102) fread(&volumeValue, 1, sizeof(float), sfsFile);
+        UnloadWorkerPool(pool);
 
-            fread(&params.startFrequencyValue, 1, sizeof(float), sfsFile);
-            fread(&params.minFrequencyValue, 1, sizeof(float), sfsFile);
-            fread(&params.slideValue, 1, sizeof(float), sfsFile);
+        for (int i = 0; i < conversionCount; i++) RL_FREE(conversions[i].record.fileName);
 
-            if (version >= 101) fread(&params.deltaSlideValue, 1, sizeof(float), sfsFile);
+        if (manifestFileName != NULL) UnloadConversionManifest(conversions, conversionCount);
+        else RL_FREE(conversions);
+    }
+    else if (inFileName[0] != '\0')    // Process input file if provided
+    {
+        if (outFileName[0] == '\0') strcpy(outFileName, "output.wav");  // Set a default name for output in case not provided
 
-            fread(&params.squareDutyValue, 1, sizeof(float), sfsFile);
-            fread(&params.dutySweepValue, 1, sizeof(float), sfsFile);
+        // Output data written to stdout, console output redirected to stderr
+        bool stdinInput = (strcmp(inFileName, "-") == 0);
+        FILE *stdoutStream = (strcmp(outFileName, "-") == 0)? LoadStdoutStream() : NULL;
 
-            fread(&params.vibratoDepthValue, 1, sizeof(float), sfsFile);
-            fread(&params.vibratoSpeedValue, 1, sizeof(float), sfsFile);
+        // Output format from output file extension if not provided
+        if (outFormat[0] == '\0')
+        {
+            if (IsFileExtension(outFileName, ".wav")) strcpy(outFormat, "wav");
+            else if (IsFileExtension(outFileName, ".raw")) strcpy(outFormat, "raw");
+            else if (IsFileExtension(outFileName, ".h")) strcpy(outFormat, "h");
+        }
 
-            float vibratoPhaseDelay = 0.0f;
-            fread(&vibratoPhaseDelay, 1, sizeof(float), sfsFile); // Not used
+        LOG("\nInput file:       %s", stdinInput? "(stdin)" : inFileName);
+        LOG("\nOutput file:      %s", (stdoutStream != NULL)? "(stdout)" : outFileName);
+        LOG("\nOutput format:    %i Hz, %i bits, %s\n\n", sampleRate, sampleSize, (channels == 1)? "Mono" : "Stereo");
 
-            fread(&params.attackTimeValue, 1, sizeof(float), sfsFile);
-            fread(&params.sustainTimeValue, 1, sizeof(float), sfsFile);
-            fread(&params.decayTimeValue, 1, sizeof(float), sfsFile);
-            fread(&params.sustainPunchValue, 1, sizeof(float), sfsFile);
+        bool audioOutput = ((strcmp(outFormat, "wav") == 0) || (strcmp(outFormat, "raw") == 0));
+        bool waveHeader = (strcmp(outFormat, "wav") == 0);
 
-            bool filterOn = false;
-            fread(&filterOn, 1, sizeof(bool), sfsFile); // Not used
+        if (!audioOutput && (stdoutStream != NULL))
+        {
+            LOG("WARNING: Output format required to write to stdout: --output-format <wav|raw>\n");
+            fclose(stdoutStream);
+        }
+#if defined(SUPPORT_AUDIO_STREAMING)
+        else if (audioOutput && ((stdoutStream != NULL) || IsFileExtension(inFileName, ".wav;.ogg;.mp3")))
+        {
+            // Audio data streamed by blocks: generated waves written as generated, audio files transcoded
+            // NOTE: FLAC is not streamed, its decoder is not included in raylib default build
+            FILE *outFile = (stdoutStream != NULL)? stdoutStream : fopen(outFileName, "wb");
 
-            fread(&params.lpfResonanceValue, 1, sizeof(float), sfsFile);
-            fread(&params.lpfCutoffValue, 1, sizeof(float), sfsFile);
-            fread(&params.lpfCutoffSweepValue, 1, sizeof(float), sfsFile);
-            fread(&params.hpfCutoffValue, 1, sizeof(float), sfsFile);
-            fread(&params.hpfCutoffSweepValue, 1, sizeof(float), sfsFile);
+            if (outFile == NULL) LOG("WARNING: [%s] Output file could not be written\n", outFileName);
+            else
+            {
+                bool success = false;
 
-            fread(&params.phaserOffsetValue, 1, sizeof(float), sfsFile);
-            fread(&params.phaserSweepValue, 1, sizeof(float), sfsFile);
-            fread(&params.repeatSpeedValue, 1, sizeof(float), sfsFile);
+                if (stdinInput || IsFileExtension(inFileName, ".rfx"))
+                {
+                    // NOTE: Only stdout output reaches here, always streamed as generated (render cache not used)
+                    WaveParams params = stdinInput? LoadWaveParamsFromStdin() : LoadWaveParams(inFileName);
+                    success = StreamWaveParams(params, outFile, waveHeader, sampleRate, sampleSize, channels);
+                }
+                else if (IsFileExtension(inFileName, ".wav;.ogg;.mp3")) success = TranscodeAudioFile(inFileName, outFile, waveHeader, sampleRate, sampleSize, channels);
+                else LOG("WARNING: [%s] Input file format can not be streamed\n", inFileName);
 
-            if (version >= 101)
-            {
-                fread(&params.changeSpeedValue, 1, sizeof(float), sfsFile);
-                fread(&params.changeAmountValue, 1, sizeof(float), sfsFile);
+                if (fclose(outFile) != 0) success = false;
+                if (!success) LOG("WARNING: [%s] Output data could not be written\n", outFileName);
             }
         }
-        else LOG("[%s] SFS file version not supported\n", fileName);
+#endif
+        else
+        {
+            Wave wave = { 0 };
 
-        fclose(sfsFile);
-    }
-    */
+            if (stdinInput || IsFileExtension(inFileName, ".rfx")) // || IsFileExtension(inFileName, ".sfs"))
+            {
+                WaveParams params = stdinInput? LoadWaveParamsFromStdin() : LoadWaveParams(inFileName);
+                bool cached = false;
+                wave = GenerateWaveCached(params, sampleRate, sampleSize, channels, &cached);
+
+                // NOTE: Cache directory not scanned on every invocation (build pipelines), parameters hash used as sampling
+                if (!cached && ((GetWaveParamsHash(params)%CACHE_TRIM_INTERVAL) == 0)) TrimRenderCache(&renderCache);
+#if defined(SUPPORT_PROFILING)
+                if (profileGeneration) ProfileGenerateWave(params);
+#else
+                if (profileGeneration) LOG("WARNING: Profiling not supported, build with SUPPORT_PROFILING (make PROFILING=TRUE)\n");
+#endif
+            }
+            else if (IsFileExtension(inFileName, ".wav") ||
+                     IsFileExtension(inFileName, ".ogg") ||
+                     IsFileExtension(inFileName, ".flac") ||
+                     IsFileExtension(inFileName, ".mp3"))
+            {
+                wave = LoadWave(inFileName);
+            }
 
-    return params;
-}
+            // Format wave data to desired sampleRate, sampleSize and channels
+            WaveFormat(&wave, sampleRate, sampleSize, channels);
 
-// Save .rfx sound parameters file
-static void SaveWaveParams(WaveParams params, const char *fileName)
-{
-    if (IsFileExtension(fileName, ".rfx"))
-    {
-        // Fx Sound File Structure (.rfx)
-        // ------------------------------------------------------
-        // Offset | Size  | Type       | Description
-        // ------------------------------------------------------
-        // 0      | 4     | char       | Signature: "rFX "
-        // 4      | 2     | short      | Version: 200
-        // 6      | 2     | short      | Data length: 96 bytes
-        // 8      | 96    | WaveParams | Wave parameters
-        // ------------------------------------------------------
+            if (stdoutStream != NULL)
+            {
+                // Full wave written to stdout (.wav or raw data), audio streaming not supported
+                // NOTE: Only reached on builds not defining SUPPORT_AUDIO_STREAMING
+                unsigned int dataSize = wave.frameCount*wave.channels*wave.sampleSize/8;
+                unsigned char header[WAVE_HEADER_SIZE] = { 0 };
+                SetWaveHeader(header, wave);
+
+                bool success = (wave.data != NULL);
+                if (success && waveHeader) success = (fwrite(header, 1, WAVE_HEADER_SIZE, stdoutStream) == WAVE_HEADER_SIZE);
+                if (success) success = (fwrite(wave.data, 1, dataSize, stdoutStream) == dataSize);
+
+                if (fclose(stdoutStream) != 0) success = false;
+                if (!success) LOG("WARNING: [%s] Output data could not be written\n", outFileName);
+            }
+            // Export wave data as audio file (.wav) or code file (.h)
+            else if (strcmp(outFormat, "wav") == 0) ExportWave(wave, outFileName);
+            else if (strcmp(outFormat, "h") == 0) ExportWaveAsCode(wave, outFileName);
+            else if (strcmp(outFormat, "raw") == 0)
+            {
+                // Export Wave as RAW data
+                FILE *rawFile = fopen(outFileName, "wb");
+
+                if (rawFile != NULL)
+                {
+                    fwrite(wave.data, 1, wave.frameCount*wave.channels*wave.sampleSize/8, rawFile);  // Write wave data
+                    fclose(rawFile);
+                }
+            }
 
-        FILE *rfxFile = fopen(fileName, "wb");
+            UnloadWave(wave);
+        }
+    }
 
-        if (rfxFile != NULL)
+    // Play audio file if provided
+    if (playFileName[0] != '\0')
+    {
+        if ((strcmp(playFileName, "-") == 0) || IsFileExtension(playFileName, ".rfx"))
         {
-            unsigned char signature[5] = "rFX ";
-            unsigned short version = 200;
-            unsigned short length = sizeof(WaveParams);
+            // Wave parameters played while wave is generated, no intermediate file or full wave buffer
+            WaveParams params = { 0 };
 
-            // Write .rfx file header
-            fwrite(signature, 4, sizeof(unsigned char), rfxFile);
-            fwrite(&version, 1, sizeof(unsigned short), rfxFile);
-            fwrite(&length, 1, sizeof(unsigned short), rfxFile);
+            if (strcmp(playFileName, "-") == 0) params = LoadWaveParamsFromStdin();
+            else params = LoadWaveParamsRFX(playFileName);
 
-            // Write wave generation parameters
-            fwrite(&params, 1, sizeof(WaveParams), rfxFile);
-
-            fclose(rfxFile);
+            // NOTE: Not valid data loads empty parameters
+            if (memcmp(&params, &(WaveParams){ 0 }, sizeof(WaveParams)) != 0) PlayWaveParamsCLI(params);
+            else LOG("WARNING: No valid wave parameters to play\n");
+        }
+        else
+        {
+            Wave wave = LoadWave(playFileName);     // Load audio (WAV, OGG, FLAC, MP3)
+            PlayWaveCLI(wave);
+            UnloadWave(wave);
         }
     }
+
+    if (showUsageInfo) ShowCommandLineInfo();
+
+    RL_FREE(inFileNames);
 }
 
 //--------------------------------------------------------------------------------------------
-// Sound generation functions
+// Batch conversion functions
 //--------------------------------------------------------------------------------------------
 
-// Generate sound: Pickup/Coin
-static WaveParams GenPickupCoin(void)
+// Conversion task function, processed on a worker thread
+// NOTE: Only thread-safe functions are used, output file name is computed in place,
+// on incremental conversion outputs with same input hash and not modified are not converted
+static void ConversionTaskFunc(void *data)
 {
-    WaveParams params = { 0 };
-    ResetWaveParams(&params);
+    ConversionTask *conversion = (ConversionTask *)data;
+
+    conversion->queueDepth = GetWorkerPoolPendingCount(conversion->pool);
 
-    params.startFrequencyValue = 0.4f + frnd(0.5f);
-    params.attackTimeValue = 0.0f;
-    params.sustainTimeValue = frnd(0.1f);
-    params.decayTimeValue = 0.1f + frnd(0.4f);
-    params.sustainPunchValue = 0.3f + frnd(0.3f);
+    conversion->stageTime[CONVERSION_STAGE_LOAD] = GetProfilerTime();
+    WaveParams params = conversion->paramsProvided? conversion->params : LoadWaveParamsRFX(conversion->inFileName);
 
-    if (GetRandomValue(0, 1))
+    // Overridden values copied over loaded parameters (manifest entries)
+    for (int i = 0; i < RFX_PARAMS_SIZE/4; i++)
     {
-        params.changeSpeedValue = 0.5f + frnd(0.2f);
-        params.changeAmountValue = 0.2f + frnd(0.4f);
+        if (conversion->overrideMask & (1u << i)) memcpy((unsigned char *)&params + i*4, (unsigned char *)&conversion->overrides + i*4, 4);
     }
 
-    return params;
-}
+    char outFileName[512] = { 0 };
 
-// Generate sound: Laser shoot
-static WaveParams GenLaserShoot(void)
-{
-    WaveParams params = { 0 };
-    ResetWaveParams(&params);
+    if (conversion->outFileName != NULL) strncpy(outFileName, conversion->outFileName, 511);
+    else
+    {
+        // Output file name: input file name with .wav extension, on output directory if provided
+        const char *name = conversion->inFileName;
+        for (const char *c = conversion->inFileName; *c != '\0'; c++) if ((*c == '/') || (*c == '\\')) name = c + 1;
+
+        int nameLength = (int)strlen(name);
+        const char *extension = strrchr(name, '.');
+        if (extension != NULL) nameLength = (int)(extension - name);
+
+        if (conversion->outDirectory != NULL) snprintf(outFileName, 512, "%s/%.*s.wav", conversion->outDirectory, nameLength, name);
+        else snprintf(outFileName, 512, "%.*s%.*s.wav", (int)(name - conversion->inFileName), conversion->inFileName, nameLength, name);
+    }
+
+    // Input hash: every value changing output data
+    // NOTE: Parameters hash is computed from canonical parameters (generation version included),
+    // parameters changes not changing generated wave do not rebuild output
+    int format[4] = { conversion->sampleRate, conversion->sampleSize, conversion->channels, conversion->rawOutput };
+    conversion->record.inputHash = GetDataHash(GetWaveParamsHash(params), format, sizeof(format));
+    conversion->record.fileName = (char *)RL_MALLOC(strlen(outFileName) + 1);
+    strcpy(conversion->record.fileName, outFileName);
 
-    params.waveTypeValue = GetRandomValue(0, 2);
+    if (conversion->state != NULL)
+    {
+        const ConversionRecord *previous = GetConversionRecord(conversion->state, outFileName);
 
-    if ((params.waveTypeValue == 2) && GetRandomValue(0, 1)) params.waveTypeValue = GetRandomValue(0, 1);
+        if (previous == NULL) conversion->rebuildReason = "new";
+        else if (previous->inputHash != conversion->record.inputHash) conversion->rebuildReason = "changed";
+        else
+        {
+            ConversionRecord record = *previous;
+            record.fileName = outFileName;
 
-    params.startFrequencyValue = 0.5f + frnd(0.5f);
-    params.minFrequencyValue = params.startFrequencyValue - 0.2f - frnd(0.6f);
+            if (IsConversionOutputValid(&record))
+            {
+                // Output up to date, not converted: no stages time
+                conversion->record.outputHash = record.outputHash;
+                conversion->record.outputSize = record.outputSize;
+                conversion->record.outputTime = record.outputTime;
+                conversion->success = true;
+
+                for (int i = CONVERSION_STAGE_GENERATE; i <= CONVERSION_STAGE_COUNT; i++) conversion->stageTime[i] = conversion->stageTime[CONVERSION_STAGE_LOAD];
+                return;
+            }
 
-    if (params.minFrequencyValue < 0.2f) params.minFrequencyValue = 0.2f;
+            conversion->rebuildReason = "output modified";
+        }
+    }
+    else conversion->rebuildReason = "forced";
 
-    params.slideValue = -0.15f - frnd(0.2f);
+    // NOTE: Cached waves are already formatted, render cache updated once formatted
+    conversion->stageTime[CONVERSION_STAGE_GENERATE] = GetProfilerTime();
+    Wave wave = LoadRenderCacheWave(&renderCache, params, conversion->sampleRate, conversion->sampleSize, conversion->channels);
+    conversion->cached = (wave.data != NULL);
+    if (!conversion->cached) wave = GenerateWave(params);
 
-    if (GetRandomValue(0, 2) == 0)
+    conversion->stageTime[CONVERSION_STAGE_FORMAT] = GetProfilerTime();
+    if (!conversion->cached)
     {
-        params.startFrequencyValue = 0.3f + frnd(0.6f);
-        params.minFrequencyValue = frnd(0.1f);
-        params.slideValue = -0.35f - frnd(0.3f);
+        WaveFormat(&wave, conversion->sampleRate, conversion->sampleSize, conversion->channels);
+        SaveRenderCacheWave(&renderCache, params, wave);
     }
 
-    if (GetRandomValue(0, 1))
+    conversion->stageTime[CONVERSION_STAGE_ENCODE] = GetProfilerTime();
+    int fileSize = 0;
+    unsigned char *fileData = NULL;
+
+    if (conversion->rawOutput)
     {
-        params.squareDutyValue = frnd(0.5f);
-        params.dutySweepValue = frnd(0.2f);
+        fileData = (unsigned char *)wave.data;      // Raw data, wave data owned by file data
+        fileSize = wave.frameCount*wave.channels*wave.sampleSize/8;
     }
     else
     {
-        params.squareDutyValue = 0.4f + frnd(0.5f);
-        params.dutySweepValue = -frnd(0.7f);
+        fileData = ExportWaveToMemory(wave, &fileSize);
+        UnloadWave(wave);
     }
 
-    params.attackTimeValue = 0.0f;
-    params.sustainTimeValue = 0.1f + frnd(0.2f);
-    params.decayTimeValue = frnd(0.4f);
+    conversion->stageTime[CONVERSION_STAGE_WRITE] = GetProfilerTime();
+    char writeFileName[520] = { 0 };
+    snprintf(writeFileName, 520, conversion->atomicWrite? "%s.tmp" : "%s", outFileName);
+
+    FILE *outFile = fopen(writeFileName, "wb");
 
-    if (GetRandomValue(0, 1)) params.sustainPunchValue = frnd(0.3f);
+    if (outFile != NULL)
+    {
+        conversion->bytesWritten = (int)fwrite(fileData, 1, fileSize, outFile);
+        fclose(outFile);
+    }
 
-    if (GetRandomValue(0, 2) == 0)
+    conversion->success = ((fileData != NULL) && (conversion->bytesWritten == fileSize));
+
+    if (conversion->atomicWrite)
     {
-        params.phaserOffsetValue = frnd(0.2f);
-        params.phaserSweepValue = -frnd(0.2f);
+        // NOTE: Output replaced at once (POSIX rename), previous output kept on failure
+        if (conversion->success) conversion->success = (rename(writeFileName, outFileName) == 0);
+        else remove(writeFileName);
     }
 
-    if (GetRandomValue(0, 1)) params.hpfCutoffValue = frnd(0.3f);
+    if (!conversion->success) LOG("WARNING: [%s] Output file could not be written\n", outFileName);
+
+    // Output record: data hash, size and modification time once written
+    struct stat outStat = { 0 };
+    conversion->record.outputHash = GetDataHash(0xcbf29ce484222325ULL, fileData, fileSize);
+    conversion->record.outputSize = fileSize;
+    conversion->record.outputTime = (stat(outFileName, &outStat) == 0)? (long long)outStat.st_mtime : 0;
 
-    return params;
+    RL_FREE(fileData);
+
+    conversion->stageTime[CONVERSION_STAGE_COUNT] = GetProfilerTime();
 }
 
-// Generate sound: Explosion
-static WaveParams GenExplosion(void)
+// Export wave data to memory as .wav file data, returns file data and size
+// NOTE: Thread-safe alternative to ExportWave(), same RIFF/WAVE layout: PCM (8/16 bit) or IEEE float (32 bit)
+static unsigned char *ExportWaveToMemory(Wave wave, int *fileSize)
 {
-    WaveParams params = { 0 };
-    ResetWaveParams(&params);
+    int dataSize = wave.frameCount*wave.channels*wave.sampleSize/8;
+    unsigned char *fileData = (unsigned char *)RL_MALLOC(WAVE_HEADER_SIZE + dataSize);
 
-    params.waveTypeValue = 3;
+    *fileSize = 0;
+    if (fileData == NULL) return NULL;
 
-    if (GetRandomValue(0, 1))
-    {
-        params.startFrequencyValue = 0.1f + frnd(0.4f);
-        params.slideValue = -0.1f + frnd(0.4f);
-    }
-    else
-    {
-        params.startFrequencyValue = 0.2f + frnd(0.7f);
-        params.slideValue = -0.2f - frnd(0.2f);
-    }
+    SetWaveHeader(fileData, wave);
+
+    // NOTE: Samples are expected to be stored in little-endian order
+    if (dataSize > 0) memcpy(fileData + WAVE_HEADER_SIZE, wave.data, dataSize);
+
+    *fileSize = WAVE_HEADER_SIZE + dataSize;
 
-    params.startFrequencyValue *= params.startFrequencyValue;
+    return fileData;
+}
 
-    if (GetRandomValue(0, 4) == 0) params.slideValue = 0.0f;
-    if (GetRandomValue(0, 2) == 0) params.repeatSpeedValue = 0.3f + frnd(0.5f);
+// Set wave file header (.wav), data size computed from wave frames count, wave data not required
+// NOTE: RIFF/WAVE layout: PCM (8/16 bit) or IEEE float (32 bit), WAVE_HEADER_SIZE bytes
+static void SetWaveHeader(unsigned char *header, Wave wave)
+{
+    unsigned int dataSize = wave.frameCount*wave.channels*wave.sampleSize/8;
+
+    // Write little-endian header values
+    #define WRITE_U16(offset, value) { header[offset] = (unsigned char)((value) & 0xff); header[(offset) + 1] = (unsigned char)(((value) >> 8) & 0xff); }
+    #define WRITE_U32(offset, value) { WRITE_U16(offset, (value) & 0xffff); WRITE_U16((offset) + 2, ((unsigned int)(value) >> 16) & 0xffff); }
+
+    memcpy(header, "RIFF", 4);
+    WRITE_U32(4, WAVE_HEADER_SIZE - 8 + dataSize);                      // RIFF chunk size
+    memcpy(header + 8, "WAVEfmt ", 8);
+    WRITE_U32(16, 16);                                                  // Format chunk size
+    WRITE_U16(20, (wave.sampleSize == 32)? 3 : 1);                      // Format: IEEE float (3) or PCM (1)
+    WRITE_U16(22, wave.channels);
+    WRITE_U32(24, wave.sampleRate);
+    WRITE_U32(28, wave.sampleRate*wave.channels*wave.sampleSize/8);     // Byte rate
+    WRITE_U16(32, wave.channels*wave.sampleSize/8);                     // Block align
+    WRITE_U16(34, wave.sampleSize);
+    memcpy(header + 36, "data", 4);
+    WRITE_U32(40, dataSize);                                            // Data chunk size
+}
 
-    params.attackTimeValue = 0.0f;
-    params.sustainTimeValue = 0.1f + frnd(0.3f);
-    params.decayTimeValue = frnd(0.5f);
+#if defined(SUPPORT_AUDIO_STREAMING)
+// Load audio decoder for file (.wav, .ogg, .mp3), decoder context is NULL on failure
+static AudioDecoder LoadAudioDecoder(const char *fileName)
+{
+    AudioDecoder decoder = { 0 };
 
-    if (GetRandomValue(0, 1) == 0)
+    if (IsFileExtension(fileName, ".wav"))
     {
-        params.phaserOffsetValue = -0.3f + frnd(0.9f);
-        params.phaserSweepValue = -frnd(0.3f);
+        drwav *wav = (drwav *)RL_CALLOC(1, sizeof(drwav));
+
+        if (drwav_init_file(wav, fileName, NULL))
+        {
+            decoder.type = AUDIO_DECODER_WAV;
+            decoder.context = wav;
+            decoder.sampleRate = wav->sampleRate;
+            decoder.sampleSize = 16;
+            decoder.channels = wav->channels;
+        }
+        else RL_FREE(wav);
     }
+    else if (IsFileExtension(fileName, ".ogg"))
+    {
+        int error = 0;
+        stb_vorbis *ogg = stb_vorbis_open_filename(fileName, &error, NULL);
 
-    params.sustainPunchValue = 0.2f + frnd(0.6f);
+        if (ogg != NULL)
+        {
+            stb_vorbis_info info = stb_vorbis_get_info(ogg);
 
-    if (GetRandomValue(0, 1))
+            decoder.type = AUDIO_DECODER_OGG;
+            decoder.context = ogg;
+            decoder.sampleRate = info.sample_rate;
+            decoder.sampleSize = 16;
+            decoder.channels = info.channels;
+        }
+    }
+    else if (IsFileExtension(fileName, ".mp3"))
     {
-        params.vibratoDepthValue = frnd(0.7f);
-        params.vibratoSpeedValue = frnd(0.6f);
+        drmp3 *mp3 = (drmp3 *)RL_CALLOC(1, sizeof(drmp3));
+
+        if (drmp3_init_file(mp3, fileName, NULL))
+        {
+            decoder.type = AUDIO_DECODER_MP3;
+            decoder.context = mp3;
+            decoder.sampleRate = mp3->sampleRate;
+            decoder.sampleSize = 32;
+            decoder.channels = mp3->channels;
+        }
+        else RL_FREE(mp3);
     }
 
-    if (GetRandomValue(0, 2) == 0)
+    // Only mono and stereo outputs are supported, any input channels are mixed
+    if ((decoder.context != NULL) && ((decoder.sampleRate == 0) || (decoder.channels == 0)))
     {
-        params.changeSpeedValue = 0.6f + frnd(0.3f);
-        params.changeAmountValue = 0.8f - frnd(1.6f);
+        UnloadAudioDecoder(decoder);
+        decoder = (AudioDecoder){ 0 };
     }
 
-    return params;
+    return decoder;
 }
 
-// Generate sound: Powerup
-static WaveParams GenPowerup(void)
+// Read audio decoder frames (decoder sample size, interleaved), returns frames read (0 on file end)
+static unsigned int ReadAudioDecoderFrames(AudioDecoder decoder, void *frames, unsigned int frameCount)
 {
-    WaveParams params = { 0 };
-    ResetWaveParams(&params);
+    unsigned int framesRead = 0;
 
-    if (GetRandomValue(0, 1)) params.waveTypeValue = 1;
-    else params.squareDutyValue = frnd(0.6f);
-
-    if (GetRandomValue(0, 1))
+    switch (decoder.type)
     {
-        params.startFrequencyValue = 0.2f + frnd(0.3f);
-        params.slideValue = 0.1f + frnd(0.4f);
-        params.repeatSpeedValue = 0.4f + frnd(0.4f);
+        case AUDIO_DECODER_WAV: framesRead = (unsigned int)drwav_read_pcm_frames_s16((drwav *)decoder.context, frameCount, (short *)frames); break;
+        case AUDIO_DECODER_OGG: framesRead = (unsigned int)stb_vorbis_get_samples_short_interleaved((stb_vorbis *)decoder.context, decoder.channels, (short *)frames, frameCount*decoder.channels); break;
+        case AUDIO_DECODER_MP3: framesRead = (unsigned int)drmp3_read_pcm_frames_f32((drmp3 *)decoder.context, frameCount, (float *)frames); break;
+        default: break;
     }
-    else
-    {
-        params.startFrequencyValue = 0.2f + frnd(0.3f);
-        params.slideValue = 0.05f + frnd(0.2f);
 
-        if (GetRandomValue(0, 1))
-        {
-            params.vibratoDepthValue = frnd(0.7f);
-            params.vibratoSpeedValue = frnd(0.6f);
-        }
-    }
+    return framesRead;
+}
 
-    params.attackTimeValue = 0.0f;
-    params.sustainTimeValue = frnd(0.4f);
-    params.decayTimeValue = 0.1f + frnd(0.4f);
+// Unload audio decoder
+static void UnloadAudioDecoder(AudioDecoder decoder)
+{
+    if (decoder.context == NULL) return;
 
-    return params;
+    switch (decoder.type)
+    {
+        case AUDIO_DECODER_WAV: drwav_uninit((drwav *)decoder.context); RL_FREE(decoder.context); break;
+        case AUDIO_DECODER_OGG: stb_vorbis_close((stb_vorbis *)decoder.context); break;
+        case AUDIO_DECODER_MP3: drmp3_uninit((drmp3 *)decoder.context); RL_FREE(decoder.context); break;
+        default: break;
+    }
 }
 
-// Generate sound: Hit/Hurt
-static WaveParams GenHitHurt(void)
+// Load audio encoder for frames with provided input format, converted to sampleRate, sampleSize and channels
+// NOTE: Frames converter is configured as WaveFormat() does (ma_convert_frames()), streamed output is the same
+// than the converted full wave; wave header is written with streaming sizes (max), updated on unloading if seekable
+static AudioEncoder LoadAudioEncoder(FILE *file, bool waveHeader, unsigned int inSampleRate, unsigned int inSampleSize, unsigned int inChannels, int sampleRate, int sampleSize, int channels)
 {
-    WaveParams params = { 0 };
-    ResetWaveParams(&params);
+    AudioEncoder encoder = { 0 };
+
+    encoder.file = file;
+    encoder.waveHeader = waveHeader;
+    encoder.inFrameSize = inChannels*inSampleSize/8;
+    encoder.sampleRate = sampleRate;
+    encoder.sampleSize = sampleSize;
+    encoder.channels = channels;
+    encoder.success = true;
+
+    ma_format formatIn = (inSampleSize == 16)? ma_format_s16 : ma_format_f32;
+    ma_format formatOut = (sampleSize == 8)? ma_format_u8 : ((sampleSize == 16)? ma_format_s16 : ma_format_f32);
+    ma_data_converter_config config = ma_data_converter_config_init(formatIn, formatOut, inChannels, channels, inSampleRate, sampleRate);
+    config.resampling.linear.lpfOrder = ma_min(MA_DEFAULT_RESAMPLER_LPF_ORDER, MA_MAX_FILTER_ORDER);
+
+    // NOTE: Converter is allocated, its resampler keeps internal pointers (it can not be copied)
+    encoder.converter = (ma_data_converter *)RL_CALLOC(1, sizeof(ma_data_converter));
+    encoder.outCapacity = (unsigned int)(TRANSCODE_BLOCK_FRAMES*(double)sampleRate/inSampleRate) + 2;
+    encoder.outData = (unsigned char *)RL_MALLOC(encoder.outCapacity*channels*sizeof(float));
+
+    if (ma_data_converter_init(&config, NULL, encoder.converter) != MA_SUCCESS)
+    {
+        RL_FREE(encoder.converter);
+        encoder.converter = NULL;
+        encoder.success = false;
+        return encoder;
+    }
 
-    params.waveTypeValue = GetRandomValue(0, 2);
-    if (params.waveTypeValue == 2) params.waveTypeValue = 3;
-    if (params.waveTypeValue == 0) params.squareDutyValue = frnd(0.6f);
+    if (waveHeader)
+    {
+        unsigned char header[WAVE_HEADER_SIZE] = { 0 };
 
-    params.startFrequencyValue = 0.2f + frnd(0.6f);
-    params.slideValue = -0.3f - frnd(0.4f);
-    params.attackTimeValue = 0.0f;
-    params.sustainTimeValue = frnd(0.1f);
-    params.decayTimeValue = 0.1f + frnd(0.2f);
+        SetWaveHeader(header, (Wave){ .frameCount = 0, .sampleRate = sampleRate, .sampleSize = sampleSize, .channels = channels });
+        memset(header + 4, 0xff, 4);        // RIFF chunk size: streaming (max)
+        memset(header + 40, 0xff, 4);       // Data chunk size: streaming (max)
 
-    if (GetRandomValue(0, 1)) params.hpfCutoffValue = frnd(0.3f);
+        encoder.success = (fwrite(header, 1, WAVE_HEADER_SIZE, file) == WAVE_HEADER_SIZE);
+    }
 
-    return params;
+    return encoder;
 }
 
-// Generate sound: Jump
-static WaveParams GenJump(void)
+// Convert and write frames block (input format), frames count up to TRANSCODE_BLOCK_FRAMES
+// NOTE: Converter output could be limited by output capacity, block is processed until all frames are consumed,
+// file is flushed after every block (piped output)
+static void WriteAudioEncoderFrames(AudioEncoder *encoder, const void *frames, unsigned int frameCount)
 {
-    WaveParams params = { 0 };
-    ResetWaveParams(&params);
+    if (!encoder->success || (frameCount == 0)) return;
+
+    while (encoder->success && (frameCount > 0))
+    {
+        ma_uint64 inCount = frameCount;
+        ma_uint64 outCount = encoder->outCapacity;
+
+        if (ma_data_converter_process_pcm_frames(encoder->converter, frames, &inCount, encoder->outData, &outCount) != MA_SUCCESS)
+        {
+            encoder->success = false;
+            break;
+        }
+
+        unsigned int sampleCount = (unsigned int)outCount*encoder->channels;
+
+        if (fwrite(encoder->outData, encoder->sampleSize/8, sampleCount, encoder->file) != sampleCount) encoder->success = false;
 
-    params.waveTypeValue = 0;
-    params.squareDutyValue = frnd(0.6f);
-    params.startFrequencyValue = 0.3f + frnd(0.3f);
-    params.slideValue = 0.1f + frnd(0.2f);
-    params.attackTimeValue = 0.0f;
-    params.sustainTimeValue = 0.1f + frnd(0.3f);
-    params.decayTimeValue = 0.1f + frnd(0.2f);
+        encoder->frameCount += (unsigned int)outCount;
+        frames = (const unsigned char *)frames + inCount*encoder->inFrameSize;
+        frameCount -= (unsigned int)inCount;
 
-    if (GetRandomValue(0, 1)) params.hpfCutoffValue = frnd(0.3f);
-    if (GetRandomValue(0, 1)) params.lpfCutoffValue = 1.0f - frnd(0.6f);
+        if ((inCount == 0) && (outCount == 0)) encoder->success = false;     // No progress, converter not valid
+    }
 
-    return params;
+    if (fflush(encoder->file) != 0) encoder->success = false;
 }
 
-// Generate sound: Blip/Select
-static WaveParams GenBlipSelect(void)
+// Unload audio encoder, returns true if all frames were written
+// NOTE: Wave header sizes are updated if file is seekable (not piped), file is not closed
+static bool UnloadAudioEncoder(AudioEncoder *encoder)
 {
-    WaveParams params = { 0 };
-    ResetWaveParams(&params);
+    if (encoder->waveHeader && encoder->success && (fseek(encoder->file, 0, SEEK_SET) == 0))
+    {
+        unsigned char header[WAVE_HEADER_SIZE] = { 0 };
+
+        SetWaveHeader(header, (Wave){ .frameCount = encoder->frameCount, .sampleRate = encoder->sampleRate, .sampleSize = encoder->sampleSize, .channels = encoder->channels });
+        encoder->success = (fwrite(header, 1, WAVE_HEADER_SIZE, encoder->file) == WAVE_HEADER_SIZE);
+    }
 
-    params.waveTypeValue = GetRandomValue(0, 1);
-    if (params.waveTypeValue == 0) params.squareDutyValue = frnd(0.6f);
-    params.startFrequencyValue = 0.2f + frnd(0.4f);
-    params.attackTimeValue = 0.0f;
-    params.sustainTimeValue = 0.1f + frnd(0.1f);
-    params.decayTimeValue = frnd(0.2f);
-    params.hpfCutoffValue = 0.1f;
+    if (encoder->converter != NULL) ma_data_converter_uninit(encoder->converter, NULL);
 
-    return params;
+    RL_FREE(encoder->converter);
+    RL_FREE(encoder->outData);
+
+    return encoder->success;
 }
 
-// Generate random sound
-static WaveParams GenRandomize(void)
+// Transcode audio file (.wav, .ogg, .mp3) to desired sampleRate, sampleSize and channels (.wav or raw data)
+// NOTE: Frames are decoded, converted and encoded by blocks (TRANSCODE_BLOCK_FRAMES), memory used does not depend on file size
+static bool TranscodeAudioFile(const char *inFileName, FILE *outFile, bool waveHeader, int sampleRate, int sampleSize, int channels)
 {
-    WaveParams params = { 0 };
-    ResetWaveParams(&params);
+    AudioDecoder decoder = LoadAudioDecoder(inFileName);
 
-    params.randSeed = GetRandomValue(0, 0xFFFE);
+    if (decoder.context == NULL)
+    {
+        LOG("WARNING: [%s] Audio file could not be decoded\n", inFileName);
+        return false;
+    }
 
-    params.startFrequencyValue = powf(frnd(2.0f) - 1.0f, 2.0f);
+    AudioEncoder encoder = LoadAudioEncoder(outFile, waveHeader, decoder.sampleRate, decoder.sampleSize, decoder.channels, sampleRate, sampleSize, channels);
+    void *frames = RL_MALLOC(TRANSCODE_BLOCK_FRAMES*decoder.channels*decoder.sampleSize/8);
+    unsigned int frameCount = 0;
 
-    if (GetRandomValue(0, 1)) params.startFrequencyValue = powf(frnd(2.0f) - 1.0f, 3.0f)+0.5f;
+    while (encoder.success && ((frameCount = ReadAudioDecoderFrames(decoder, frames, TRANSCODE_BLOCK_FRAMES)) > 0))
+    {
+        WriteAudioEncoderFrames(&encoder, frames, frameCount);
+    }
 
-    params.minFrequencyValue = 0.0f;
-    params.slideValue = powf(frnd(2.0f) - 1.0f, 5.0f);
+    RL_FREE(frames);
+    UnloadAudioDecoder(decoder);
 
-    if ((params.startFrequencyValue > 0.7f) && (params.slideValue > 0.2f)) params.slideValue = -params.slideValue;
-    if ((params.startFrequencyValue < 0.2f) && (params.slideValue < -0.05f)) params.slideValue = -params.slideValue;
+    return UnloadAudioEncoder(&encoder);
+}
 
-    params.deltaSlideValue = powf(frnd(2.0f) - 1.0f, 3.0f);
-    params.squareDutyValue = frnd(2.0f) - 1.0f;
-    params.dutySweepValue = powf(frnd(2.0f) - 1.0f, 3.0f);
-    params.vibratoDepthValue = powf(frnd(2.0f) - 1.0f, 3.0f);
-    params.vibratoSpeedValue = frnd(2.0f) - 1.0f;
-    //params.vibratoPhaseDelay = frnd(2.0f) - 1.0f;
-    params.attackTimeValue = powf(frnd(2.0f) - 1.0f, 3.0f);
-    params.sustainTimeValue = powf(frnd(2.0f) - 1.0f, 2.0f);
-    params.decayTimeValue = frnd(2.0f)-1.0f;
-    params.sustainPunchValue = powf(frnd(0.8f), 2.0f);
+// Generate wave by blocks and write it as generated to desired sampleRate, sampleSize and channels (.wav or raw data)
+// NOTE: Full length wave is not generated first, downstream readers (pipes) get first block immediately
+static bool StreamWaveParams(WaveParams params, FILE *outFile, bool waveHeader, int sampleRate, int sampleSize, int channels)
+{
+    WaveGenerator generator = InitWaveGenerator(params);
+    AudioEncoder encoder = LoadAudioEncoder(outFile, waveHeader, WAVE_SAMPLE_RATE, 32, 1, sampleRate, sampleSize, channels);
+    float *frames = (float *)RL_MALLOC(TRANSCODE_BLOCK_FRAMES*sizeof(float));
+    int frameCount = 0;
 
-    if (params.attackTimeValue + params.sustainTimeValue + params.decayTimeValue < 0.2f)
+    while (encoder.success && ((frameCount = GenerateWaveFrames(&generator, frames, TRANSCODE_BLOCK_FRAMES)) > 0))
     {
-        params.sustainTimeValue += 0.2f + frnd(0.3f);
-        params.decayTimeValue += 0.2f + frnd(0.3f);
+        WriteAudioEncoderFrames(&encoder, frames, frameCount);
     }
 
-    params.lpfResonanceValue = frnd(2.0f) - 1.0f;
-    params.lpfCutoffValue = 1.0f - powf(frnd(1.0f), 3.0f);
-    params.lpfCutoffSweepValue = powf(frnd(2.0f) - 1.0f, 3.0f);
+    RL_FREE(frames);
 
-    if (params.lpfCutoffValue < 0.1f && params.lpfCutoffSweepValue < -0.05f) params.lpfCutoffSweepValue = -params.lpfCutoffSweepValue;
+    return UnloadAudioEncoder(&encoder);
+}
+#endif  // SUPPORT_AUDIO_STREAMING
 
-    params.hpfCutoffValue = powf(frnd(1.0f), 5.0f);
-    params.hpfCutoffSweepValue = powf(frnd(2.0f) - 1.0f, 5.0f);
-    params.phaserOffsetValue = powf(frnd(2.0f) - 1.0f, 3.0f);
-    params.phaserSweepValue = powf(frnd(2.0f) - 1.0f, 3.0f);
-    params.repeatSpeedValue = frnd(2.0f) - 1.0f;
-    params.changeSpeedValue = frnd(2.0f) - 1.0f;
-    params.changeAmountValue = frnd(2.0f) - 1.0f;
+// Load wave parameters from stdin (.rfx data), empty parameters returned if data is not valid
+// NOTE: One extra byte is read to detect data size not valid
+static WaveParams LoadWaveParamsFromStdin(void)
+{
+    unsigned char fileData[RFX_FILE_SIZE + 1] = { 0 };
+#if defined(_WIN32)
+    _setmode(_fileno(stdin), _O_BINARY);
+#endif
+    unsigned int dataSize = (unsigned int)fread(fileData, 1, RFX_FILE_SIZE + 1, stdin);
 
-    return params;
+    return LoadWaveParamsFromMemory(fileData, dataSize);
 }
 
-// Mutate current sound
-static void WaveMutate(WaveParams *params)
+// Load stdout binary stream for output data, console output (LOG(), raylib trace log) is redirected to stderr
+// NOTE: Output data written to stdout is never mixed with text messages
+static FILE *LoadStdoutStream(void)
 {
-    srand(time(NULL));      // Refresh seed to avoid converging behaviour
-    
-    if (GetRandomValue(0, 1)) params->startFrequencyValue += frnd(0.1f) - 0.05f;        
-    //if (GetRandomValue(0, 1)) params.minFrequencyValue += frnd(0.1f) - 0.05f;
-    if (GetRandomValue(0, 1)) params->slideValue += frnd(0.1f) - 0.05f;
-    if (GetRandomValue(0, 1)) params->deltaSlideValue += frnd(0.1f) - 0.05f;
-    if (GetRandomValue(0, 1)) params->squareDutyValue += frnd(0.1f) - 0.05f;
-    if (GetRandomValue(0, 1)) params->dutySweepValue += frnd(0.1f) - 0.05f;
-    if (GetRandomValue(0, 1)) params->vibratoDepthValue += frnd(0.1f) - 0.05f;
-    if (GetRandomValue(0, 1)) params->vibratoSpeedValue += frnd(0.1f) - 0.05f;
-    //if (GetRandomValue(0, 1)) params.vibratoPhaseDelay += frnd(0.1f) - 0.05f;
-    if (GetRandomValue(0, 1)) params->attackTimeValue += frnd(0.1f) - 0.05f;
-    if (GetRandomValue(0, 1)) params->sustainTimeValue += frnd(0.1f) - 0.05f;
-    if (GetRandomValue(0, 1)) params->decayTimeValue += frnd(0.1f) - 0.05f;
-    if (GetRandomValue(0, 1)) params->sustainPunchValue += frnd(0.1f) - 0.05f;
-    if (GetRandomValue(0, 1)) params->lpfResonanceValue += frnd(0.1f) - 0.05f;
-    if (GetRandomValue(0, 1)) params->lpfCutoffValue += frnd(0.1f) - 0.05f;
-    if (GetRandomValue(0, 1)) params->lpfCutoffSweepValue += frnd(0.1f) - 0.05f;
-    if (GetRandomValue(0, 1)) params->hpfCutoffValue += frnd(0.1f) - 0.05f;
-    if (GetRandomValue(0, 1)) params->hpfCutoffSweepValue += frnd(0.1f) - 0.05f;
-    if (GetRandomValue(0, 1)) params->phaserOffsetValue += frnd(0.1f) - 0.05f;
-    if (GetRandomValue(0, 1)) params->phaserSweepValue += frnd(0.1f) - 0.05f;
-    if (GetRandomValue(0, 1)) params->repeatSpeedValue += frnd(0.1f) - 0.05f;
-    if (GetRandomValue(0, 1)) params->changeSpeedValue += frnd(0.1f) - 0.05f;
-    if (GetRandomValue(0, 1)) params->changeAmountValue += frnd(0.1f) - 0.05f;
+    fflush(stdout);
+#if defined(_WIN32)
+    int dataOutput = _dup(_fileno(stdout));
+    _dup2(_fileno(stderr), _fileno(stdout));
+    _setmode(dataOutput, _O_BINARY);
+
+    return _fdopen(dataOutput, "wb");
+#else
+    int dataOutput = dup(STDOUT_FILENO);
+    dup2(STDERR_FILENO, STDOUT_FILENO);
+
+    return fdopen(dataOutput, "wb");
+#endif
 }
 
-//--------------------------------------------------------------------------------------------
-// Auxiliar functions
-//--------------------------------------------------------------------------------------------
-// Draw wave data
-// NOTE: For proper visualization, MSAA x4 is recommended but it could be costly for the GPU
-// Alternative: Rendered to a bigger texture and scale down with bilinear/trilinear texture filtering
-static void DrawWave(Wave *wave, Rectangle bounds, Color color)
+// Run serve mode: render requests received on UNIX domain socket until SIGINT/SIGTERM received
+// NOTE: One thread polls the socket (connections input/output), requests are rendered on worker threads,
+// requests are not read while SERVE_MAX_PENDING requests are in progress (backpressure to clients)
+static bool RunServe(const char *socketPath, int jobCount)
 {
-    float sample = 0.0f;
-    float sampleNext = 0.0f;
-    float currentSample = 0.0f;
-    float sampleIncrement = (float)wave->frameCount*wave->channels/(float)(bounds.width*2);
-    float sampleScale = (float)bounds.height;
+#if defined(_WIN32)
+    LOG("WARNING: Serve mode not supported on this platform\n");
+    return false;
+#else
+    struct sockaddr_un address = { 0 };
+    address.sun_family = AF_UNIX;
 
-    for (int i = 1; i < bounds.width*2 - 1; i++)
+    if (strlen(socketPath) >= sizeof(address.sun_path))
     {
-        sample = ((float *)wave->data)[(int)currentSample]*sampleScale;
-        sampleNext = ((float *)wave->data)[(int)(currentSample + sampleIncrement)]*sampleScale;
+        LOG("WARNING: [%s] Socket path too long\n", socketPath);
+        return false;
+    }
 
-        if (sample > bounds.height/2) sample = bounds.height/2;
-        else if (sample < -bounds.height/2) sample = -bounds.height/2;
+    strcpy(address.sun_path, socketPath);
 
-        if (sampleNext > bounds.height/2) sampleNext = bounds.height/2;
-        else if (sampleNext < -bounds.height/2) sampleNext = -bounds.height/2;
+    // Stale socket file removed (previous process not finished properly), any other file is kept
+    struct stat socketStat = { 0 };
+    if ((stat(socketPath, &socketStat) == 0) && S_ISSOCK(socketStat.st_mode)) unlink(socketPath);
 
-        DrawLineV((Vector2){ (float)bounds.x + (float)i/2.0f, (float)(bounds.y + bounds.height/2) + sample },
-                  (Vector2){ (float)bounds.x + (float)i/2.0f, (float)(bounds.y  + bounds.height/2) + sampleNext }, color);
+    int listenSocket = socket(AF_UNIX, SOCK_STREAM, 0);
 
-        currentSample += sampleIncrement;
+    if ((listenSocket < 0) || (bind(listenSocket, (struct sockaddr *)&address, sizeof(address)) != 0) || (listen(listenSocket, SERVE_MAX_CONNECTIONS) != 0))
+    {
+        LOG("WARNING: [%s] Socket could not be opened\n", socketPath);
+        if (listenSocket >= 0) close(listenSocket);
+        return false;
     }
-}
+
+    fcntl(listenSocket, F_SETFL, fcntl(listenSocket, F_GETFL, 0) | O_NONBLOCK);
+
+    if (pipe(wakePipe) != 0)
+    {
+        LOG("WARNING: Serve mode could not be initialized\n");
+        close(listenSocket);
+        unlink(socketPath);
+        return false;
+    }
+
+    for (int i = 0; i < 2; i++) fcntl(wakePipe[i], F_SETFL, fcntl(wakePipe[i], F_GETFL, 0) | O_NONBLOCK);
+
+    // Exit requested on SIGINT/SIGTERM (poll() interrupted), writing to closed connections does not end process
+    struct sigaction action = { 0 };
+    action.sa_handler = ExitSignalHandler;
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+    signal(SIGPIPE, SIG_IGN);
+
+    WorkerPool *pool = LoadWorkerPool(jobCount);
+    ServeConnection *connections = (ServeConnection *)RL_CALLOC(SERVE_MAX_CONNECTIONS, sizeof(ServeConnection));
+    struct pollfd *fds = (struct pollfd *)RL_CALLOC(SERVE_MAX_CONNECTIONS + 2, sizeof(struct pollfd));
+    ServeStats *stats = (ServeStats *)RL_CALLOC(1, sizeof(ServeStats));
+    int connectionCount = 0;
+    int pendingCount = 0;       // Requests in progress: received, response not sent yet
+    double trimTime = 0.0;      // Render cache last trim time
+    long long trimRequestCount = 0;     // Requests count on render cache last trim
+
+    stats->startTime = GetProfilerTime();
+
+    LOG("\nServing on:       %s", socketPath);
+    LOG("\nWorker threads:   %i", GetWorkerPoolThreadCount(pool));
+    LOG("\nMax requests:     %i in progress\n\n", SERVE_MAX_PENDING);
+    fflush(stdout);
+
+    while (!exitRequested)
+    {
+        // Poll listening socket, wake pipe and connections: input only read under max requests in progress,
+        // output polled if first request is ready to be sent
+        fds[0] = (struct pollfd){ .fd = listenSocket, .events = (connectionCount < SERVE_MAX_CONNECTIONS)? POLLIN : 0 };
+        fds[1] = (struct pollfd){ .fd = wakePipe[0], .events = POLLIN };
+
+        int timeout = -1;
+
+        for (int i = 0; i < connectionCount; i++)
+        {
+            ServeConnection *connection = &connections[i];
+            ServeRequest *first = connection->first;
+            bool ready = ((first != NULL) && IsServeRequestReady(pool, first));
+
+            // NOTE: Render task state is set done after its function returns (wake pipe written), polled again shortly
+            if ((first != NULL) && !ready && first->rendered) timeout = 1;
+
+            fds[i + 2] = (struct pollfd){ .fd = connection->socket, .events = 0 };
+            if ((connection->socket >= 0) && !connection->inputClosed && (pendingCount < SERVE_MAX_PENDING)) fds[i + 2].events |= POLLIN;
+            if ((connection->socket >= 0) && ready) fds[i + 2].events |= POLLOUT;
+        }
+
+        if (poll(fds, connectionCount + 2, timeout) < 0)
+        {
+            if (errno == EINTR) continue;
+            break;
+        }
+
+        double time = GetProfilerTime();
+
+        // Drain wake pipe, rendered requests are checked on connections
+        if (fds[1].revents & POLLIN)
+        {
+            unsigned char buffer[256];
+            while (read(wakePipe[0], buffer, sizeof(buffer)) > 0) { }
+        }
+
+        // Process connections: read requests, send ready responses, remove finished connections
+        for (int i = 0; i < connectionCount; i++)
+        {
+            ServeConnection *connection = &connections[i];
+            bool connected = (connection->socket >= 0);
+
+            // NOTE: Connection closed by client while its input is not read (max requests in progress), responses can not be sent
+            if (connected && (fds[i + 2].revents & (POLLHUP | POLLERR)) && !(fds[i + 2].events & POLLIN)) connected = false;
+            if (connected && (fds[i + 2].revents & (POLLIN | POLLHUP | POLLERR))) connected = ReadServeRequests(connection, pool, &pendingCount, time);
+            if (connected) connected = SendServeResponses(connection, pool, stats, &pendingCount, connectionCount);
+
+            if (!connected && (connection->socket >= 0))
+            {
+                close(connection->socket);
+                connection->socket = -1;
+            }
+
+            // Connection lost: requests discarded once rendered (task memory in use until done)
+            if (connection->socket < 0)
+            {
+                while ((connection->first != NULL) && IsServeRequestReady(pool, connection->first))
+                {
+                    ServeRequest *request = connection->first;
+                    connection->first = request->next;
+                    RL_FREE(request->data);
+                    RL_FREE(request);
+                    pendingCount--;
+                }
+            }
+
+            if (((connection->socket < 0) || connection->inputClosed) && (connection->first == NULL))
+            {
+                if (connection->socket >= 0) close(connection->socket);
+
+                // Connection removed, last connection moved to its place (polled result not used any more)
+                connections[i] = connections[connectionCount - 1];
+                fds[i + 2] = fds[connectionCount + 1];
+                connectionCount--;
+                i--;
+            }
+        }
+
+        // Accept new connections, non-blocking
+        if (fds[0].revents & POLLIN)
+        {
+            while (connectionCount < SERVE_MAX_CONNECTIONS)
+            {
+                int clientSocket = accept(listenSocket, NULL, NULL);
+                if (clientSocket < 0) break;
+
+                fcntl(clientSocket, F_SETFL, fcntl(clientSocket, F_GETFL, 0) | O_NONBLOCK);
+                connections[connectionCount] = (ServeConnection){ .socket = clientSocket };
+                connectionCount++;
+            }
+        }
+
+        // Render cache trimmed once no requests in progress, if requests were rendered since last trim
+        if ((pendingCount == 0) && (stats->requestCount > trimRequestCount) && ((time - trimTime) >= CACHE_TRIM_TIME))
+        {
+            TrimRenderCache(&renderCache);
+            trimTime = time;
+            trimRequestCount = stats->requestCount;
+        }
+    }
+
+    LOG("Serve mode finished: %lli requests, %lli errors\n", stats->requestCount, stats->errorCount);
+
+    // Pending renders finished before releasing requests memory
+    WorkerPoolWait(pool);
+
+    for (int i = 0; i < connectionCount; i++)
+    {
+        if (connections[i].socket >= 0) close(connections[i].socket);
+
+        while (connections[i].first != NULL)
+        {
+            ServeRequest *request = connections[i].first;
+            IsWorkerTaskDone(pool, &request->task);
+            connections[i].first = request->next;
+            RL_FREE(request->data);
+            RL_FREE(request);
+        }
+    }
+
+    UnloadWorkerPool(pool);
+    RL_FREE(connections);
+    RL_FREE(fds);
+    RL_FREE(stats);
+
+    close(listenSocket);
+    unlink(socketPath);
+    close(wakePipe[0]);
+    close(wakePipe[1]);
+    wakePipe[0] = wakePipe[1] = -1;
+
+    return true;
+#endif
+}
+
+#if !defined(_WIN32)
+// Serve render task function, processed on a worker thread
+// NOTE: Same wave generation, format conversion and .wav encoding than batch conversion (ConversionTaskFunc())
+static void ServeTaskFunc(void *data)
+{
+    ServeRequest *request = (ServeRequest *)data;
+
+    // NOTE: Not valid data loads empty parameters
+    if (memcmp(&request->params, &(WaveParams){ 0 }, sizeof(WaveParams)) == 0) SetServeRequestError(request, "wave parameters not valid");
+    else
+    {
+        Wave wave = GenerateWaveCached(request->params, request->sampleRate, request->sampleSize, request->channels, NULL);
+
+        if (request->waveHeader)
+        {
+            int fileSize = 0;
+            request->data = ExportWaveToMemory(wave, &fileSize);
+            request->dataSize = fileSize;
+            UnloadWave(wave);
+        }
+        else
+        {
+            request->data = (unsigned char *)wave.data;     // Raw data, wave data owned by request
+            request->dataSize = wave.frameCount*wave.channels*wave.sampleSize/8;
+        }
+    }
+
+    // Wake serve mode polling thread, response could be sent
+    request->rendered = true;
+    if (write(wakePipe[1], "", 1) < 0) { }     // NOTE: Pipe full, polling thread already woken
+}
+
+// Serve and watch modes signal handler, exit requested
+static void ExitSignalHandler(int signal)
+{
+    (void)signal;
+    exitRequested = 1;
+    if (write(wakePipe[1], "", 1) < 0) { }     // Wake polling thread, signal could be received out of poll()
+}
+
+// Check if serve request response is ready to be sent: stats, errors and render tasks done
+static bool IsServeRequestReady(WorkerPool *pool, ServeRequest *request)
+{
+    return (request->stats || (request->task.func == NULL) || IsWorkerTaskDone(pool, &request->task));
+}
+
+// Set serve request error response, message text as data
+static void SetServeRequestError(ServeRequest *request, const char *message)
+{
+    request->status = 1;
+    request->dataSize = (unsigned int)strlen(message);
+    request->data = (unsigned char *)RL_MALLOC(request->dataSize);
+    memcpy(request->data, message, request->dataSize);
+}
+
+// Read connection requests, render requests pushed to worker pool, returns false on connection error
+// NOTE: Requests are not read over SERVE_MAX_PENDING requests in progress, they wait on socket buffers
+static bool ReadServeRequests(ServeConnection *connection, WorkerPool *pool, int *pendingCount, double time)
+{
+    while (*pendingCount < SERVE_MAX_PENDING)
+    {
+        // Request size known once command is received: render requests have .rfx data, stats requests have no data
+        // NOTE: Every request is at least header size, next request data is never read
+        int requestSize = SERVE_REQUEST_HEADER_SIZE;
+        if ((connection->inputSize >= 4) && (memcmp(connection->input, "RNDR", 4) == 0)) requestSize += RFX_FILE_SIZE;
+
+        ssize_t bytesRead = recv(connection->socket, connection->input + connection->inputSize, requestSize - connection->inputSize, 0);
+
+        if (bytesRead == 0)
+        {
+            connection->inputClosed = true;    // Client finished sending requests, responses still sent
+            return (connection->inputSize == 0);
+        }
+        else if (bytesRead < 0) return ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR));
+
+        connection->inputSize += (int)bytesRead;
+
+        if ((connection->inputSize >= 4) && (memcmp(connection->input, "RNDR", 4) != 0) && (memcmp(connection->input, "STAT", 4) != 0))
+        {
+            LOG("WARNING: Serve request command not valid, connection closed\n");
+            return false;
+        }
+
+        if ((connection->inputSize >= 4) && (memcmp(connection->input, "RNDR", 4) == 0)) requestSize = SERVE_REQUEST_HEADER_SIZE + RFX_FILE_SIZE;
+
+        if (connection->inputSize == requestSize)
+        {
+            // Read little-endian request values
+            #define READ_U16(offset) ((unsigned int)connection->input[offset] | ((unsigned int)connection->input[(offset) + 1] << 8))
+            #define READ_U32(offset) (READ_U16(offset) | (READ_U16((offset) + 2) << 16))
+
+            ServeRequest *request = (ServeRequest *)RL_CALLOC(1, sizeof(ServeRequest));
+            request->stats = (memcmp(connection->input, "STAT", 4) == 0);
+            request->sampleRate = READ_U32(4);
+            request->sampleSize = READ_U16(8);
+            request->channels = READ_U16(10);
+            request->waveHeader = (READ_U32(12) == 0);
+            request->receiveTime = time;
+
+            if (!request->stats)
+            {
+                // Output format verified as command line format, not valid format responded as error (not rendered)
+                bool validFormat = (((request->sampleRate == 44100) || (request->sampleRate == 22050)) &&
+                    ((request->sampleSize == 8) || (request->sampleSize == 16) || (request->sampleSize == 32)) &&
+                    ((request->channels == 1) || (request->channels == 2)));
+
+                if (validFormat)
+                {
+                    request->params = LoadWaveParamsFromMemory(connection->input + SERVE_REQUEST_HEADER_SIZE, RFX_FILE_SIZE);
+                    request->task.func = ServeTaskFunc;
+                    request->task.data = request;
+                    WorkerPoolPush(pool, &request->task);
+                }
+                else SetServeRequestError(request, "output format not valid");
+            }
+
+            if (connection->last != NULL) connection->last->next = request;
+            else connection->first = request;
+            connection->last = request;
+
+            connection->inputSize = 0;
+            (*pendingCount)++;
+        }
+    }
+
+    return true;
+}
+
+// Send connection ready responses in requests order, returns false on connection error
+// NOTE: Sockets are non-blocking, partially sent response is continued when socket is writable again
+static bool SendServeResponses(ServeConnection *connection, WorkerPool *pool, ServeStats *stats, int *pendingCount, int connectionCount)
+{
+    while ((connection->first != NULL) && IsServeRequestReady(pool, connection->first))
+    {
+        ServeRequest *request = connection->first;
+
+        if (request->stats && (request->data == NULL))
+        {
+            request->data = LoadServeStats(stats, *pendingCount, connectionCount, GetWorkerPoolThreadCount(pool), &request->dataSize);
+        }
+
+        // Response header, little-endian values
+        unsigned char header[SERVE_RESPONSE_HEADER_SIZE] = { 0 };
+        for (int i = 0; i < 4; i++)
+        {
+            header[i] = (unsigned char)((request->status >> (8*i)) & 0xff);
+            header[4 + i] = (unsigned char)((request->dataSize >> (8*i)) & 0xff);
+        }
+
+        while (request->bytesSent < (SERVE_RESPONSE_HEADER_SIZE + request->dataSize))
+        {
+            ssize_t bytesSent = 0;
+
+            if (request->bytesSent < SERVE_RESPONSE_HEADER_SIZE) bytesSent = send(connection->socket, header + request->bytesSent, SERVE_RESPONSE_HEADER_SIZE - request->bytesSent, 0);
+            else bytesSent = send(connection->socket, request->data + (request->bytesSent - SERVE_RESPONSE_HEADER_SIZE), request->dataSize - (request->bytesSent - SERVE_RESPONSE_HEADER_SIZE), 0);
+
+            if (bytesSent < 0) return ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR));
+
+            request->bytesSent += (unsigned int)bytesSent;
+        }
+
+        // Response sent, render requests latency registered
+        if (!request->stats)
+        {
+            double time = GetProfilerTime();
+
+            stats->requestCount++;
+            if (request->status != 0) stats->errorCount++;
+
+            stats->latency[stats->historyIndex] = (float)(time - request->receiveTime);
+            stats->sentTime[stats->historyIndex] = time;
+            stats->historyIndex = (stats->historyIndex + 1)%SERVE_LATENCY_HISTORY;
+            if (stats->historyCount < SERVE_LATENCY_HISTORY) stats->historyCount++;
+        }
+
+        connection->first = request->next;
+        if (connection->first == NULL) connection->last = NULL;
+
+        RL_FREE(request->data);
+        RL_FREE(request);
+        (*pendingCount)--;
+    }
+
+    return true;
+}
+
+// Compare float values, used to sort latencies
+static int CompareFloat(const void *a, const void *b)
+{
+    float valueA = *(const float *)a;
+    float valueB = *(const float *)b;
+
+    return (valueA > valueB) - (valueA < valueB);
+}
+
+// Load serve stats JSON text: requests, requests per second and latency percentiles (recent requests)
+// NOTE: Recent requests per second are measured over latency history responses sent time
+static unsigned char *LoadServeStats(ServeStats *stats, int pendingCount, int connectionCount, int threadCount, unsigned int *dataSize)
+{
+    double time = GetProfilerTime();
+    double uptime = time - stats->startTime;
+    float latency50 = 0.0f;
+    float latency99 = 0.0f;
+    double recentRate = 0.0;
+
+    if (stats->historyCount > 0)
+    {
+        float *latencies = (float *)RL_MALLOC(stats->historyCount*sizeof(float));
+        memcpy(latencies, stats->latency, stats->historyCount*sizeof(float));
+        qsort(latencies, stats->historyCount, sizeof(float), CompareFloat);
+
+        latency50 = latencies[(stats->historyCount - 1)*50/100];
+        latency99 = latencies[(stats->historyCount - 1)*99/100];
+        RL_FREE(latencies);
+
+        // Oldest sample on history: ring buffer index if full, first sample otherwise
+        double oldestTime = stats->sentTime[(stats->historyCount == SERVE_LATENCY_HISTORY)? stats->historyIndex : 0];
+        if (time > oldestTime) recentRate = stats->historyCount/(time - oldestTime);
+    }
+
+    char *text = (char *)RL_MALLOC(512);
+
+    *dataSize = (unsigned int)snprintf(text, 512, "{\"uptime\":%.3f,\"requests\":%lli,\"errors\":%lli,\"requests_per_second\":%.1f,"
+        "\"recent_requests_per_second\":%.1f,\"latency_p50_ms\":%.3f,\"latency_p99_ms\":%.3f,\"latency_samples\":%i,"
+        "\"pending\":%i,\"max_pending\":%i,\"connections\":%i,\"threads\":%i}", uptime, stats->requestCount, stats->errorCount,
+        (uptime > 0.0)? stats->requestCount/uptime : 0.0, recentRate, latency50*1e3f, latency99*1e3f, stats->historyCount,
+        pendingCount, SERVE_MAX_PENDING, connectionCount, threadCount);
+
+    return (unsigned char *)text;
+}
+#endif
+
+#if defined(__linux__)
+// Run watch mode: .rfx files changed on directory tree (inotify) converted on worker threads, until SIGINT/SIGTERM received
+// NOTE: Changes are coalesced (WATCH_COALESCE_TIME after last change), files changed while converting are converted again
+static bool RunWatch(const char *dirPath, const char *outDirectory, int sampleRate, int sampleSize, int channels, int jobCount)
+{
+    WatchState watch = { 0 };
+    watch.rootPath = dirPath;
+    watch.outDirectory = outDirectory;
+    watch.sampleRate = sampleRate;
+    watch.sampleSize = sampleSize;
+    watch.channels = channels;
+    watch.notifyDescriptor = inotify_init1(IN_NONBLOCK);
+
+    if ((watch.notifyDescriptor < 0) || !DirectoryExists(dirPath) || (pipe(wakePipe) != 0))
+    {
+        LOG("WARNING: [%s] Directory could not be watched\n", dirPath);
+        if (watch.notifyDescriptor >= 0) close(watch.notifyDescriptor);
+        return false;
+    }
+
+    for (int i = 0; i < 2; i++) fcntl(wakePipe[i], F_SETFL, fcntl(wakePipe[i], F_GETFL, 0) | O_NONBLOCK);
+
+    struct sigaction action = { 0 };
+    action.sa_handler = ExitSignalHandler;
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+
+    // Initial scan: directories watched, outputs missing or older than input converted
+    AddWatchDirectory(&watch, dirPath, GetProfilerTime());
+
+    WorkerPool *pool = LoadWorkerPool(jobCount);
+    int convertedCount = 0;
+    double trimTime = 0.0;          // Render cache last trim time
+    int trimConvertedCount = 0;     // Files converted on render cache last trim
+
+    LOG("\nWatching:         %s (%i directories)", dirPath, watch.directoryCount);
+    LOG("\nOutput directory: %s", (outDirectory != NULL)? outDirectory : "(input files directory)");
+    LOG("\nOutput format:    %i Hz, %i bits, %s", sampleRate, sampleSize, (channels == 1)? "Mono" : "Stereo");
+    LOG("\nWorker threads:   %i\n\n", GetWorkerPoolThreadCount(pool));
+    fflush(stdout);
+
+    // NOTE: Events buffer aligned for inotify_event structs
+    char events[16*1024] __attribute__((aligned(__alignof__(struct inotify_event))));
+
+    while (!exitRequested)
+    {
+        double time = GetProfilerTime();
+        int timeout = -1;
+
+        // Wait for changes, next coalesced conversion or conversions in progress (task state set done after function returns)
+        for (int i = 0; i < watch.fileCount; i++)
+        {
+            int fileTimeout = 1;
+
+            if (watch.files[i].conversion == NULL)
+            {
+                fileTimeout = (int)ceil((watch.files[i].lastChangeTime + WATCH_COALESCE_TIME - time)*1000.0);
+                if (fileTimeout < 0) fileTimeout = 0;
+            }
+
+            if ((timeout < 0) || (fileTimeout < timeout)) timeout = fileTimeout;
+        }
+
+        struct pollfd fds[2] = { { .fd = watch.notifyDescriptor, .events = POLLIN }, { .fd = wakePipe[0], .events = POLLIN } };
+
+        if ((poll(fds, 2, timeout) < 0) && (errno != EINTR)) break;
+
+        time = GetProfilerTime();
+
+        // Process file system events: .rfx files written or moved in, new directories watched and scanned
+        ssize_t length = 0;
+
+        while ((length = read(watch.notifyDescriptor, events, sizeof(events))) > 0)
+        {
+            for (char *ptr = events; ptr < (events + length); ptr += sizeof(struct inotify_event) + ((struct inotify_event *)ptr)->len)
+            {
+                const struct inotify_event *event = (const struct inotify_event *)ptr;
+
+                if (event->mask & IN_Q_OVERFLOW)
+                {
+                    // Events lost, directories scanned again (outputs older than input converted)
+                    LOG("WARNING: Watch events overflow, directories scanned again\n");
+                    for (int i = 0; i < watch.directoryCount; i++) RL_FREE(watch.directories[i].path);
+                    watch.directoryCount = 0;
+                    AddWatchDirectory(&watch, dirPath, time);
+                    continue;
+                }
+
+                int index = 0;
+                while ((index < watch.directoryCount) && (watch.directories[index].descriptor != event->wd)) index++;
+
+                if (index == watch.directoryCount) continue;
+
+                // Directory removed or moved out of tree: watch removed
+                if (event->mask & IN_IGNORED)
+                {
+                    RL_FREE(watch.directories[index].path);
+                    watch.directories[index] = watch.directories[watch.directoryCount - 1];
+                    watch.directoryCount--;
+                    continue;
+                }
+
+                const char *dirName = watch.directories[index].path;
+                if (event->len == 0) continue;
+
+                char fileName[512] = { 0 };
+                snprintf(fileName, 512, "%s/%s", dirName, event->name);
+
+                if (event->mask & IN_ISDIR) { if (event->mask & (IN_CREATE | IN_MOVED_TO)) AddWatchDirectory(&watch, fileName, 0.0); }
+                else if (IsFileExtension(fileName, ".rfx")) SetWatchFileChanged(&watch, fileName, time);
+            }
+        }
+
+        // Drain wake pipe (exit signal)
+        if (fds[1].revents & POLLIN)
+        {
+            char buffer[64];
+            while (read(wakePipe[0], buffer, sizeof(buffer)) > 0) { }
+        }
+
+        // Process files: conversions done reported, coalesced changes converted, finished files removed
+        for (int i = 0; i < watch.fileCount; i++)
+        {
+            WatchFile *file = &watch.files[i];
+
+            if ((file->conversion != NULL) && IsWorkerTaskDone(pool, &file->conversion->task))
+            {
+                if (file->conversion->success)
+                {
+                    LOG("Converted: %s (%.1f ms since change)\n", file->outFileName, (file->conversion->stageTime[CONVERSION_STAGE_COUNT] - file->conversionChangeTime)*1000.0);
+                    convertedCount++;
+                }
+
+                RL_FREE(file->conversion->record.fileName);
+                RL_FREE(file->conversion);
+                file->conversion = NULL;
+            }
+
+            if ((file->conversion == NULL) && file->changed && ((time - file->lastChangeTime) >= WATCH_COALESCE_TIME))
+            {
+                // NOTE: Output directories created on main thread, output written to temporal file and renamed (hot-reload readers)
+                if (!MakeOutputDirectories(file->outFileName)) LOG("WARNING: [%s] Output directory could not be created\n", file->outFileName);
+
+                ConversionTask *conversion = (ConversionTask *)RL_CALLOC(1, sizeof(ConversionTask));
+                conversion->pool = pool;
+                conversion->inFileName = file->inFileName;
+                conversion->outFileName = file->outFileName;
+                conversion->sampleRate = watch.sampleRate;
+                conversion->sampleSize = watch.sampleSize;
+                conversion->channels = watch.channels;
+                conversion->atomicWrite = true;
+                conversion->task.func = ConversionTaskFunc;
+                conversion->task.data = conversion;
+
+                file->conversion = conversion;
+                file->conversionChangeTime = file->changeTime;
+                file->changed = false;
+                WorkerPoolPush(pool, &conversion->task);
+            }
+
+            if ((file->conversion == NULL) && !file->changed)
+            {
+                RL_FREE(file->inFileName);
+                RL_FREE(file->outFileName);
+                watch.files[i] = watch.files[watch.fileCount - 1];
+                watch.fileCount--;
+                i--;
+            }
+        }
+
+        // Render cache trimmed once no conversions in progress, if files were converted since last trim
+        if ((watch.fileCount == 0) && (convertedCount > trimConvertedCount) && ((time - trimTime) >= CACHE_TRIM_TIME))
+        {
+            TrimRenderCache(&renderCache);
+            trimTime = time;
+            trimConvertedCount = convertedCount;
+        }
+
+        fflush(stdout);
+    }
+
+    LOG("Watch mode finished: %i files converted\n", convertedCount);
+
+    // Conversions in progress finished before releasing files
+    WorkerPoolWait(pool);
+
+    for (int i = 0; i < watch.fileCount; i++)
+    {
+        if (watch.files[i].conversion != NULL)
+        {
+            IsWorkerTaskDone(pool, &watch.files[i].conversion->task);
+            RL_FREE(watch.files[i].conversion->record.fileName);
+            RL_FREE(watch.files[i].conversion);
+        }
+
+        RL_FREE(watch.files[i].inFileName);
+        RL_FREE(watch.files[i].outFileName);
+    }
+
+    for (int i = 0; i < watch.directoryCount; i++) RL_FREE(watch.directories[i].path);
+
+    UnloadWorkerPool(pool);
+    RL_FREE(watch.files);
+    RL_FREE(watch.directories);
+
+    close(watch.notifyDescriptor);
+    close(wakePipe[0]);
+    close(wakePipe[1]);
+    wakePipe[0] = wakePipe[1] = -1;
+
+    return true;
+}
+
+// Add directory watch and subdirectories watches, .rfx files with output missing or older than input marked changed
+// NOTE: New directories (created or moved into tree) are scanned with no change time, all files converted
+static void AddWatchDirectory(WatchState *watch, const char *dirPath, double time)
+{
+    int descriptor = inotify_add_watch(watch->notifyDescriptor, dirPath, IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+
+    if (descriptor < 0)
+    {
+        LOG("WARNING: [%s] Directory could not be watched\n", dirPath);
+        return;
+    }
+
+    // NOTE: Same descriptor returned if directory already watched (path updated)
+    int index = 0;
+    while ((index < watch->directoryCount) && (watch->directories[index].descriptor != descriptor)) index++;
+
+    if (index == watch->directoryCount)
+    {
+        if (watch->directoryCount == watch->directoryCapacity)
+        {
+            watch->directoryCapacity = (watch->directoryCapacity > 0)? watch->directoryCapacity*2 : 64;
+            watch->directories = (WatchDirectory *)RL_REALLOC(watch->directories, watch->directoryCapacity*sizeof(WatchDirectory));
+        }
+
+        watch->directoryCount++;
+    }
+    else RL_FREE(watch->directories[index].path);
+
+    watch->directories[index].descriptor = descriptor;
+    watch->directories[index].path = (char *)RL_MALLOC(strlen(dirPath) + 1);
+    strcpy(watch->directories[index].path, dirPath);
+
+    DIR *dir = opendir(dirPath);
+    if (dir == NULL) return;
+
+    struct dirent *entry = NULL;
+
+    while ((entry = readdir(dir)) != NULL)
+    {
+        if ((strcmp(entry->d_name, ".") == 0) || (strcmp(entry->d_name, "..") == 0)) continue;
+
+        char fileName[512] = { 0 };
+        snprintf(fileName, 512, "%s/%s", dirPath, entry->d_name);
+
+        struct stat fileStat = { 0 };
+        if (stat(fileName, &fileStat) != 0) continue;
+
+        if (S_ISDIR(fileStat.st_mode)) AddWatchDirectory(watch, fileName, time);
+        else if (S_ISREG(fileStat.st_mode) && IsFileExtension(fileName, ".rfx"))
+        {
+            if (time <= 0.0) SetWatchFileChanged(watch, fileName, GetProfilerTime());
+            else
+            {
+                // Initial scan: only outputs missing or older than input converted
+                char outFileName[512] = { 0 };
+                GetWatchOutputFileName(watch, fileName, outFileName);
+
+                struct stat outStat = { 0 };
+                if ((stat(outFileName, &outStat) != 0) || (outStat.st_mtime < fileStat.st_mtime)) SetWatchFileChanged(watch, fileName, time);
+            }
+        }
+    }
+
+    closedir(dir);
+}
+
+// Set watched file changed, file added to watched files if not converting or pending already
+static void SetWatchFileChanged(WatchState *watch, const char *fileName, double time)
+{
+    WatchFile *file = NULL;
+    for (int i = 0; (i < watch->fileCount) && (file == NULL); i++) if (strcmp(watch->files[i].inFileName, fileName) == 0) file = &watch->files[i];
+
+    if (file == NULL)
+    {
+        if (watch->fileCount == watch->fileCapacity)
+        {
+            watch->fileCapacity = (watch->fileCapacity > 0)? watch->fileCapacity*2 : 64;
+            watch->files = (WatchFile *)RL_REALLOC(watch->files, watch->fileCapacity*sizeof(WatchFile));
+        }
+
+        char outFileName[512] = { 0 };
+        GetWatchOutputFileName(watch, fileName, outFileName);
+
+        file = &watch->files[watch->fileCount++];
+        *file = (WatchFile){ 0 };
+        file->inFileName = (char *)RL_MALLOC(strlen(fileName) + 1);
+        strcpy(file->inFileName, fileName);
+        file->outFileName = (char *)RL_MALLOC(strlen(outFileName) + 1);
+        strcpy(file->outFileName, outFileName);
+    }
+
+    if (!file->changed) file->changeTime = time;
+    file->lastChangeTime = time;
+    file->changed = true;
+}
+
+// Get watched file output file name: .wav file on output directory (same relative path), input directory otherwise
+static void GetWatchOutputFileName(WatchState *watch, const char *fileName, char *outFileName)
+{
+    int extensionLength = (int)strlen(fileName) - (int)(strrchr(fileName, '.') - fileName);
+    int rootLength = (int)strlen(watch->rootPath);
+
+    if ((watch->outDirectory != NULL) && (strncmp(fileName, watch->rootPath, rootLength) == 0))
+    {
+        const char *relativePath = fileName + rootLength;
+        snprintf(outFileName, 512, "%s%s%.*s.wav", watch->outDirectory, (relativePath[0] == '/')? "" : "/", (int)strlen(relativePath) - extensionLength, relativePath);
+    }
+    else snprintf(outFileName, 512, "%.*s.wav", (int)strlen(fileName) - extensionLength, fileName);
+}
+
+// Make output file parent directories, if not exist
+static bool MakeOutputDirectories(const char *fileName)
+{
+    char dirPath[512] = { 0 };
+    strncpy(dirPath, fileName, 511);
+
+    for (char *c = dirPath + 1; *c != '\0'; c++)
+    {
+        if (*c != '/') continue;
+
+        *c = '\0';
+        if ((mkdir(dirPath, 0755) != 0) && (errno != EEXIST)) return false;
+        *c = '/';
+    }
+
+    return true;
+}
+#else
+// Run watch mode, not supported: inotify required
+static bool RunWatch(const char *dirPath, const char *outDirectory, int sampleRate, int sampleSize, int channels, int jobCount)
+{
+    (void)dirPath; (void)outDirectory; (void)sampleRate; (void)sampleSize; (void)channels; (void)jobCount;
+    LOG("WARNING: Watch mode not supported on this platform\n");
+    return false;
+}
+#endif
+
+// Write text as JSON string, escaping required characters
+static void WriteJSONString(FILE *file, const char *text)
+{
+    fputc('\"', file);
+
+    for (const unsigned char *c = (const unsigned char *)text; *c != '\0'; c++)
+    {
+        if ((*c == '\"') || (*c == '\\')) fprintf(file, "\\%c", *c);
+        else if (*c < 0x20) fprintf(file, "\\u%04x", *c);
+        else fputc(*c, file);
+    }
+
+    fputc('\"', file);
+}
+
+// Compare conversion tasks end time, used to sort them for written bytes counter
+static int CompareConversionEndTime(const void *a, const void *b)
+{
+    double timeA = (*(const ConversionTask **)a)->stageTime[CONVERSION_STAGE_COUNT];
+    double timeB = (*(const ConversionTask **)b)->stageTime[CONVERSION_STAGE_COUNT];
+
+    return (timeA > timeB) - (timeA < timeB);
+}
+
+// Save conversion trace as trace events JSON file (Chrome tracing, Perfetto)
+// NOTE: One track per thread (main and workers) with a span per file and its stages,
+// counters for worker pool queue depth and bytes written
+static bool SaveConversionTrace(const char *fileName, ConversionTask *tasks, int taskCount, int threadCount, double startTime, double endTime)
+{
+    static const char *stageNames[CONVERSION_STAGE_COUNT] = { "load", "generate", "format", "encode", "write" };
+
+    FILE *traceFile = fopen(fileName, "wt");
+    if (traceFile == NULL) return false;
+
+    #define TRACE_TIME(time) (((time) - startTime)*1e6)     // Trace timestamps in microseconds
+
+    fprintf(traceFile, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    fprintf(traceFile, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"%s\"}},\n", toolName);
+    fprintf(traceFile, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"main\"}},\n");
+    for (int i = 1; i <= threadCount; i++) fprintf(traceFile, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%i,\"args\":{\"name\":\"worker %i\"}},\n", i, i);
+
+    fprintf(traceFile, "{\"name\":\"batch\",\"cat\":\"convert\",\"ph\":\"X\",\"pid\":1,\"tid\":0,\"ts\":0,\"dur\":%.3f,\"args\":{\"files\":%i,\"threads\":%i}},\n",
+            TRACE_TIME(endTime), taskCount, threadCount);
+    fprintf(traceFile, "{\"name\":\"queue depth\",\"ph\":\"C\",\"pid\":1,\"ts\":0,\"args\":{\"pending\":%i}}", taskCount);
+
+    ConversionTask **sortedTasks = (ConversionTask **)RL_CALLOC(taskCount, sizeof(ConversionTask *));
+
+    for (int i = 0; i < taskCount; i++)
+    {
+        ConversionTask *conversion = &tasks[i];
+        double convertStart = conversion->stageTime[CONVERSION_STAGE_LOAD];
+        double convertEnd = conversion->stageTime[CONVERSION_STAGE_COUNT];
+
+        fprintf(traceFile, ",\n{\"name\":\"convert\",\"cat\":\"convert\",\"ph\":\"X\",\"pid\":1,\"tid\":%i,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"file\":",
+                conversion->task.worker, TRACE_TIME(convertStart), (convertEnd - convertStart)*1e6);
+        WriteJSONString(traceFile, conversion->inFileName);
+        fprintf(traceFile, ",\"bytes\":%i,\"success\":%s}}", conversion->bytesWritten, conversion->success? "true" : "false");
+
+        for (int s = 0; s < CONVERSION_STAGE_COUNT; s++)
+        {
+            fprintf(traceFile, ",\n{\"name\":\"%s\",\"cat\":\"convert\",\"ph\":\"X\",\"pid\":1,\"tid\":%i,\"ts\":%.3f,\"dur\":%.3f}", stageNames[s],
+                    conversion->task.worker, TRACE_TIME(conversion->stageTime[s]), (conversion->stageTime[s + 1] - conversion->stageTime[s])*1e6);
+        }
+
+        fprintf(traceFile, ",\n{\"name\":\"queue depth\",\"ph\":\"C\",\"pid\":1,\"ts\":%.3f,\"args\":{\"pending\":%i}}", TRACE_TIME(convertStart), conversion->queueDepth);
+
+        sortedTasks[i] = conversion;
+    }
+
+    // Bytes written counter, accumulated in conversions end order
+    qsort(sortedTasks, taskCount, sizeof(ConversionTask *), CompareConversionEndTime);
+
+    long long bytesWritten = 0;
+    fprintf(traceFile, ",\n{\"name\":\"bytes written\",\"ph\":\"C\",\"pid\":1,\"ts\":0,\"args\":{\"bytes\":0}}");
+
+    for (int i = 0; i < taskCount; i++)
+    {
+        bytesWritten += sortedTasks[i]->bytesWritten;
+        fprintf(traceFile, ",\n{\"name\":\"bytes written\",\"ph\":\"C\",\"pid\":1,\"ts\":%.3f,\"args\":{\"bytes\":%lld}}", TRACE_TIME(sortedTasks[i]->stageTime[CONVERSION_STAGE_COUNT]), bytesWritten);
+    }
+
+    fprintf(traceFile, "\n]}\n");
+
+    RL_FREE(sortedTasks);
+    fclose(traceFile);
+
+    return true;
+}
+
+// Load conversion tasks from manifest file (.csv), one task per valid entry
+// NOTE: First line defines columns: source, output, seed, sample_rate, sample_size, channels and wave
+// parameters names (without Value suffix), empty fields use defaults (no override), lines starting with # ignored.
+// Presets are generated on calling thread (raylib random generator is not thread-safe), .rfx files loaded on workers.
+// Relative paths are resolved from manifest directory, outputs from output directory if provided
+static ConversionTask *LoadConversionManifest(const char *fileName, const char *outDirectory, int sampleRate, int sampleSize, int channels, int *taskCount)
+{
+    static const char *paramNames[RFX_PARAMS_SIZE/4] = {
+        "randSeed", "waveType", "attackTime", "sustainTime", "sustainPunch", "decayTime", "startFrequency", "minFrequency",
+        "slide", "deltaSlide", "vibratoDepth", "vibratoSpeed", "changeAmount", "changeSpeed", "squareDuty", "dutySweep",
+        "repeatSpeed", "phaserOffset", "phaserSweep", "lpfCutoff", "lpfCutoffSweep", "lpfResonance", "hpfCutoff", "hpfCutoffSweep"
+    };
+    static const char *columnNames[MANIFEST_COLUMN_PARAM] = { "source", "seed", "output", "sample_rate", "sample_size", "channels" };
+    static const char *presetNames[8] = { "coin", "laser", "explosion", "powerup", "hit", "jump", "blip", "random" };
+    static WaveParams (*presetFuncs[8])(void) = { GenPickupCoin, GenLaserShoot, GenExplosion, GenPowerup, GenHitHurt, GenJump, GenBlipSelect, GenRandomize };
+
+    *taskCount = 0;
+
+    char *text = LoadFileText(fileName);
+
+    if (text == NULL)
+    {
+        LOG("WARNING: [%s] Manifest file could not be loaded\n", fileName);
+        return NULL;
+    }
+
+    // Manifest directory length, relative paths base
+    int baseLength = 0;
+    for (int i = 0; fileName[i] != '\0'; i++) if ((fileName[i] == '/') || (fileName[i] == '\\')) baseLength = i + 1;
+
+    int lineCount = 1;
+    for (char *c = text; *c != '\0'; c++) if (*c == '\n') lineCount++;
+
+    ConversionTask *tasks = (ConversionTask *)RL_CALLOC(lineCount, sizeof(ConversionTask));
+    int columns[MANIFEST_MAX_COLUMNS] = { 0 };
+    int columnCount = 0;
+
+    char *line = text;
+
+    for (int lineNumber = 1; line != NULL; lineNumber++)
+    {
+        char *nextLine = strchr(line, '\n');
+        if (nextLine != NULL) *nextLine++ = '\0';
+
+        char *fields[MANIFEST_MAX_COLUMNS] = { 0 };
+        int fieldCount = SplitManifestLine(line, fields, MANIFEST_MAX_COLUMNS);
+        line = nextLine;
+
+        if ((fieldCount == 0) || ((fieldCount == 1) && (fields[0][0] == '\0')) || (fields[0][0] == '#')) continue;
+
+        // First line: columns definition
+        if (columnCount == 0)
+        {
+            bool sourceColumn = false;
+            bool outputColumn = false;
+
+            for (int i = 0; i < fieldCount; i++)
+            {
+                columns[i] = MANIFEST_COLUMN_UNKNOWN;
+
+                for (int c = 0; c < MANIFEST_COLUMN_PARAM; c++) if (strcmp(fields[i], columnNames[c]) == 0) columns[i] = c;
+                for (int p = 0; p < RFX_PARAMS_SIZE/4; p++) if (strcmp(fields[i], paramNames[p]) == 0) columns[i] = MANIFEST_COLUMN_PARAM + p;
+
+                if (columns[i] == MANIFEST_COLUMN_SOURCE) sourceColumn = true;
+                else if (columns[i] == MANIFEST_COLUMN_OUTPUT) outputColumn = true;
+                else if (columns[i] == MANIFEST_COLUMN_UNKNOWN) LOG("WARNING: [%s] Manifest column not recognized, ignored: %s\n", fileName, fields[i]);
+            }
+
+            if (!sourceColumn || !outputColumn)
+            {
+                LOG("WARNING: [%s] Manifest source and output columns required\n", fileName);
+                break;
+            }
+
+            columnCount = fieldCount;
+            continue;
+        }
+
+        ConversionTask *task = &tasks[*taskCount];
+        *task = (ConversionTask){ .sampleRate = sampleRate, .sampleSize = sampleSize, .channels = channels };
+
+        const char *source = "";
+        const char *output = "";
+        int seed = 1;
+        bool valid = true;
+
+        for (int i = 0; (i < fieldCount) && (i < columnCount) && valid; i++)
+        {
+            if ((fields[i][0] == '\0') || (columns[i] == MANIFEST_COLUMN_UNKNOWN)) continue;
+
+            // Numeric fields must be fully parsed
+            char *end = NULL;
+            long integer = strtol(fields[i], &end, 10);
+            bool isInteger = (*end == '\0');
+            float value = strtof(fields[i], &end);
+            bool isFloat = ((*end == '\0') && isfinite(value));
+
+            switch (columns[i])
+            {
+                case MANIFEST_COLUMN_SOURCE: source = fields[i]; break;
+                case MANIFEST_COLUMN_OUTPUT: output = fields[i]; break;
+                case MANIFEST_COLUMN_SEED: seed = (int)integer; valid = isInteger; break;
+                case MANIFEST_COLUMN_SAMPLE_RATE: task->sampleRate = (int)integer; valid = (isInteger && ((integer == 22050) || (integer == 44100))); break;
+                case MANIFEST_COLUMN_SAMPLE_SIZE: task->sampleSize = (int)integer; valid = (isInteger && ((integer == 8) || (integer == 16) || (integer == 32))); break;
+                case MANIFEST_COLUMN_CHANNELS: task->channels = (int)integer; valid = (isInteger && ((integer == 1) || (integer == 2))); break;
+                default:
+                {
+                    // Wave parameters override: random seed and wave type integer values, float values otherwise
+                    int index = columns[i] - MANIFEST_COLUMN_PARAM;
+                    int intValue = (int)integer;
+
+                    if (index < 2) memcpy((unsigned char *)&task->overrides + index*4, &intValue, 4);
+                    else memcpy((unsigned char *)&task->overrides + index*4, &value, 4);
+
+                    task->overrideMask |= (1u << index);
+                    valid = ((index < 2)? isInteger : isFloat) && ((index != 1) || ((integer >= 0) && (integer <= 3)));
+                } break;
+            }
+
+            if (!valid) LOG("WARNING: [%s:%i] Manifest value not valid, entry ignored: %s\n", fileName, lineNumber, fields[i]);
+        }
+
+        if (!valid) continue;
+
+        if ((source[0] == '\0') || (output[0] == '\0'))
+        {
+            LOG("WARNING: [%s:%i] Manifest entry source or output not provided, entry ignored\n", fileName, lineNumber);
+            continue;
+        }
+
+        if (!IsFileExtension(output, ".wav") && !IsFileExtension(output, ".raw"))
+        {
+            LOG("WARNING: [%s:%i] Manifest entry output extension not supported, entry ignored: %s\n", fileName, lineNumber, output);
+            continue;
+        }
+
+        task->rawOutput = IsFileExtension(output, ".raw");
+
+        // Source: .rfx file or preset generated with provided seed
+        char inFileName[512] = { 0 };
+
+        if (IsFileExtension(source, ".rfx"))
+        {
+            bool absolute = ((source[0] == '/') || (source[0] == '\\') || (source[1] == ':'));
+            snprintf(inFileName, 512, "%.*s%s", absolute? 0 : baseLength, fileName, source);
+        }
+        else
+        {
+            for (int p = 0; p < 8; p++)
+            {
+                if (strcmp(source, presetNames[p]) == 0)
+                {
+                    SetRandomSeed(seed);
+                    task->params = presetFuncs[p]();
+                    task->paramsProvided = true;
+                    snprintf(inFileName, 512, "%s (seed %i)", source, seed);
+                }
+            }
+
+            if (!task->paramsProvided)
+            {
+                LOG("WARNING: [%s:%i] Manifest entry source not recognized, entry ignored: %s\n", fileName, lineNumber, source);
+                continue;
+            }
+        }
+
+        // Output file: relative to output directory if provided, manifest directory otherwise
+        char outFileName[512] = { 0 };
+        bool absolute = ((output[0] == '/') || (output[0] == '\\') || (output[1] == ':'));
+
+        if (absolute) snprintf(outFileName, 512, "%s", output);
+        else if (outDirectory != NULL) snprintf(outFileName, 512, "%s/%s", outDirectory, output);
+        else snprintf(outFileName, 512, "%.*s%s", baseLength, fileName, output);
+
+        char *names = (char *)RL_MALLOC(strlen(inFileName) + strlen(outFileName) + 2);
+        strcpy(names, inFileName);
+        strcpy(names + strlen(inFileName) + 1, outFileName);
+
+        task->inFileName = names;
+        task->outFileName = names + strlen(inFileName) + 1;
+        task->task.func = ConversionTaskFunc;
+        task->task.data = task;
+        (*taskCount)++;
+    }
+
+    UnloadFileText(text);
+
+    return tasks;
+}
+
+// Unload conversion tasks loaded from manifest, file names included
+static void UnloadConversionManifest(ConversionTask *tasks, int taskCount)
+{
+    for (int i = 0; i < taskCount; i++) RL_FREE((char *)tasks[i].inFileName);     // NOTE: Output file name on same allocation
+
+    RL_FREE(tasks);
+}
+
+// Split manifest line into comma separated fields, spaces trimmed, returns fields count
+// NOTE: Line is modified in place, fields point into it, quoted fields are not supported
+static int SplitManifestLine(char *line, char **fields, int maxFields)
+{
+    int fieldCount = 0;
+    char *field = line;
+
+    while ((field != NULL) && (fieldCount < maxFields))
+    {
+        char *next = strchr(field, ',');
+        if (next != NULL) *next++ = '\0';
+
+        while ((*field == ' ') || (*field == '\t')) field++;
+
+        int length = (int)strlen(field);
+        while ((length > 0) && ((field[length - 1] == ' ') || (field[length - 1] == '\t') || (field[length - 1] == '\r'))) field[--length] = '\0';
+
+        fields[fieldCount++] = field;
+        field = next;
+    }
+
+    return fieldCount;
+}
+
+// Load incremental conversion state file, one record per line: input hash, output hash, size, time and file name
+// NOTE: Empty state returned if file not found, records are sorted by file name for lookups from worker threads
+static ConversionState LoadConversionState(const char *fileName)
+{
+    ConversionState state = { 0 };
+    char *text = FileExists(fileName)? LoadFileText(fileName) : NULL;
+
+    if (text == NULL) return state;
+
+    if (strncmp(text, CONVERSION_STATE_HEADER, strlen(CONVERSION_STATE_HEADER)) != 0)
+    {
+        LOG("WARNING: [%s] Conversion state file not valid, all outputs converted\n", fileName);
+        UnloadFileText(text);
+        return state;
+    }
+
+    int lineCount = 1;
+    for (char *c = text; *c != '\0'; c++) if (*c == '\n') lineCount++;
+
+    state.records = (ConversionRecord *)RL_CALLOC(lineCount, sizeof(ConversionRecord));
+
+    for (char *line = strchr(text, '\n'); line != NULL; )
+    {
+        line++;
+        char *nextLine = strchr(line, '\n');
+        if (nextLine != NULL) *nextLine = '\0';
+
+        ConversionRecord record = { 0 };
+        int nameOffset = 0;
+
+        if ((sscanf(line, "%llx %llx %lld %lld %n", &record.inputHash, &record.outputHash, &record.outputSize, &record.outputTime, &nameOffset) == 4) &&
+            (nameOffset > 0) && (line[nameOffset] != '\0'))
+        {
+            int length = (int)strlen(line + nameOffset);
+            if (line[nameOffset + length - 1] == '\r') length--;
+
+            record.fileName = (char *)RL_CALLOC(length + 1, 1);
+            memcpy(record.fileName, line + nameOffset, length);
+            state.records[state.count++] = record;
+        }
+
+        line = nextLine;
+    }
+
+    UnloadFileText(text);
+
+    qsort(state.records, state.count, sizeof(ConversionRecord), CompareConversionRecord);
+
+    return state;
+}
+
+// Unload incremental conversion state
+static void UnloadConversionState(ConversionState state)
+{
+    for (int i = 0; i < state.count; i++) RL_FREE(state.records[i].fileName);
+
+    RL_FREE(state.records);
+}
+
+// Save conversion state: converted (or up to date) tasks records and previous records of outputs not in tasks
+// NOTE: Outputs converted on previous runs with other inputs are kept, failed conversions are not recorded
+static bool SaveConversionState(const char *fileName, ConversionState state, ConversionTask *tasks, int taskCount)
+{
+    ConversionState current = { 0 };
+    current.records = (ConversionRecord *)RL_CALLOC(taskCount + 1, sizeof(ConversionRecord));
+
+    for (int i = 0; i < taskCount; i++) if (tasks[i].success) current.records[current.count++] = tasks[i].record;
+
+    qsort(current.records, current.count, sizeof(ConversionRecord), CompareConversionRecord);
+
+    FILE *stateFile = fopen(fileName, "wt");
+
+    if (stateFile == NULL)
+    {
+        RL_FREE(current.records);
+        return false;
+    }
+
+    fprintf(stateFile, "%s\n", CONVERSION_STATE_HEADER);
+
+    // Records written sorted by file name: previous and current records merged
+    int p = 0;
+    int c = 0;
+
+    while ((p < state.count) || (c < current.count))
+    {
+        int order = (p >= state.count)? 1 : (c >= current.count)? -1 : strcmp(state.records[p].fileName, current.records[c].fileName);
+        ConversionRecord *record = (order < 0)? &state.records[p] : &current.records[c];
+
+        fprintf(stateFile, "%016llx %016llx %lld %lld %s\n", record->inputHash, record->outputHash, record->outputSize, record->outputTime, record->fileName);
+
+        if (order <= 0) p++;
+        if (order >= 0) c++;
+    }
+
+    fclose(stateFile);
+    RL_FREE(current.records);
+
+    return true;
+}
+
+// Get conversion record for output file, NULL if not found
+// NOTE: State is not modified during conversion, lookups are thread-safe
+static const ConversionRecord *GetConversionRecord(const ConversionState *state, const char *fileName)
+{
+    ConversionRecord key = { .fileName = (char *)fileName };
+
+    return (const ConversionRecord *)bsearch(&key, state->records, state->count, sizeof(ConversionRecord), CompareConversionRecord);
+}
+
+// Check if output file matches record: same size and modification time, or same data hash if file was touched
+// NOTE: Record modification time is updated if data hash matches, file is not read again on next run
+static bool IsConversionOutputValid(ConversionRecord *record)
+{
+    struct stat fileStat = { 0 };
+
+    if ((stat(record->fileName, &fileStat) != 0) || ((long long)fileStat.st_size != record->outputSize)) return false;
+    if ((long long)fileStat.st_mtime == record->outputTime) return true;
+
+    bool valid = false;
+    FILE *file = fopen(record->fileName, "rb");
+
+    if (file != NULL)
+    {
+        unsigned char *fileData = (unsigned char *)RL_MALLOC((size_t)record->outputSize + 1);
+        size_t bytesRead = fread(fileData, 1, (size_t)record->outputSize, file);
+        fclose(file);
+
+        valid = ((bytesRead == (size_t)record->outputSize) && (GetDataHash(0xcbf29ce484222325ULL, fileData, (int)bytesRead) == record->outputHash));
+        if (valid) record->outputTime = (long long)fileStat.st_mtime;
+
+        RL_FREE(fileData);
+    }
+
+    return valid;
+}
+
+// Compare conversion records file name, used to sort records
+static int CompareConversionRecord(const void *a, const void *b)
+{
+    return strcmp(((const ConversionRecord *)a)->fileName, ((const ConversionRecord *)b)->fileName);
+}
+
+// Get data hash (FNV-1a 64 bit), chained from previous hash (initial value: 0xcbf29ce484222325)
+static unsigned long long GetDataHash(unsigned long long hash, const void *data, int size)
+{
+    const unsigned char *bytes = (const unsigned char *)data;
+
+    for (int i = 0; i < size; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ULL;
+    }
+
+    return hash;
+}
+
+// Merge conversion state files (shards or work queue processes), latest record kept per output file
+// NOTE: Records of same output are compared by output modification time, last converted is kept
+static bool MergeConversionStates(const char *fileName, const char **stateFileNames, int stateCount)
+{
+    ConversionState merged = { 0 };
+
+    for (int i = 0; i < stateCount; i++)
+    {
+        ConversionState state = LoadConversionState(stateFileNames[i]);
+
+        if (state.count == 0) LOG("WARNING: [%s] Conversion state file not found or with no records\n", stateFileNames[i]);
+        else
+        {
+            // NOTE: Records file names are moved to merged state
+            merged.records = (ConversionRecord *)RL_REALLOC(merged.records, (merged.count + state.count)*sizeof(ConversionRecord));
+            memcpy(merged.records + merged.count, state.records, state.count*sizeof(ConversionRecord));
+            merged.count += state.count;
+        }
+
+        RL_FREE(state.records);
+    }
+
+    qsort(merged.records, merged.count, sizeof(ConversionRecord), CompareConversionRecord);
+
+    int recordCount = 0;
+
+    for (int i = 0; i < merged.count; i++)
+    {
+        ConversionRecord *last = (recordCount > 0)? &merged.records[recordCount - 1] : NULL;
+
+        if ((last != NULL) && (strcmp(last->fileName, merged.records[i].fileName) == 0))
+        {
+            if (merged.records[i].outputTime > last->outputTime)
+            {
+                RL_FREE(last->fileName);
+                *last = merged.records[i];
+            }
+            else RL_FREE(merged.records[i].fileName);
+        }
+        else merged.records[recordCount++] = merged.records[i];
+    }
+
+    merged.count = recordCount;
+
+    bool success = SaveConversionState(fileName, merged, NULL, 0);
+    if (success) LOG("Merged %i conversion state files: %i records saved into %s\n", stateCount, merged.count, fileName);
+
+    UnloadConversionState(merged);
+
+    return success;
+}
+
+// Get conversion job hash: input file name as provided or manifest entry output file name (output directory not included)
+// NOTE: Used to select shard and to name work queue jobs, processes must be provided the same (relative) paths
+static unsigned long long GetConversionJobHash(const ConversionTask *task, const char *outDirectory, bool manifestEntry)
+{
+    const char *key = task->inFileName;
+
+    if (manifestEntry)
+    {
+        int length = (outDirectory != NULL)? (int)strlen(outDirectory) : 0;
+
+        key = task->outFileName;
+        if ((length > 0) && (strncmp(key, outDirectory, length) == 0)) key += length;
+    }
+
+    unsigned long long hash = GetDataHash(0xcbf29ce484222325ULL, key, (int)strlen(key));
+
+    // NOTE: FNV-1a low bits only depend on data low bits (file names numbering), bits are mixed for shard selection modulo
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+
+    return hash;
+}
+
+#if !defined(_WIN32)
+// Load conversion work queue: queue directories created, jobs created by first process loading queue
+// NOTE: Jobs are created on a temporal directory renamed as jobs directory (only one process succeeds),
+// jobs directory is never empty (.queue file), jobs claimed or done are never created again
+static bool LoadConversionQueue(const char *path, ConversionQueue *queue, ConversionTask *tasks, int taskCount)
+{
+    char hostName[64] = { 0 };
+    if (gethostname(hostName, 63) != 0) strcpy(hostName, "localhost");
+
+    snprintf(queue->path, 512, "%s", path);
+    snprintf(queue->claimId, 128, "%s.%i", hostName, (int)getpid());
+
+    static const char *dirNames[3] = { "claimed", "done", "failed" };
+    char dirPath[600] = { 0 };
+
+    if ((mkdir(path, 0755) != 0) && (errno != EEXIST)) return false;
+
+    for (int i = 0; i < 3; i++)
+    {
+        snprintf(dirPath, 600, "%s/%s", path, dirNames[i]);
+        if ((mkdir(dirPath, 0755) != 0) && (errno != EEXIST)) return false;
+    }
+
+    char jobsPath[600] = { 0 };
+    snprintf(jobsPath, 600, "%s/jobs", path);
+
+    if (DirectoryExists(jobsPath)) return true;
+
+    char tempPath[700] = { 0 };
+    char jobFileName[800] = { 0 };
+    snprintf(tempPath, 700, "%s/jobs.%s.tmp", path, queue->claimId);
+
+    if (mkdir(tempPath, 0755) != 0) return false;
+
+    // Job file data: input file name and output file name (manifest entries), useful to inspect queue
+    for (int i = -1; i < taskCount; i++)
+    {
+        if (i < 0) snprintf(jobFileName, 800, "%s/.queue", tempPath);
+        else snprintf(jobFileName, 800, "%s/%016llx.job", tempPath, tasks[i].jobHash);
+
+        FILE *jobFile = fopen(jobFileName, "wt");
+
+        if (jobFile != NULL)
+        {
+            if (i >= 0) fprintf(jobFile, "%s\n%s\n", tasks[i].inFileName, (tasks[i].outFileName != NULL)? tasks[i].outFileName : "");
+            fclose(jobFile);
+        }
+    }
+
+    if (rename(tempPath, jobsPath) == 0) LOG("Work queue: %i jobs created (%s)\n", taskCount, jobsPath);
+    else
+    {
+        // Jobs directory created by another process first, temporal jobs removed
+        for (int i = -1; i < taskCount; i++)
+        {
+            if (i < 0) snprintf(jobFileName, 800, "%s/.queue", tempPath);
+            else snprintf(jobFileName, 800, "%s/%016llx.job", tempPath, tasks[i].jobHash);
+
+            remove(jobFileName);
+        }
+
+        rmdir(tempPath);
+    }
+
+    return DirectoryExists(jobsPath);
+}
+
+// Queued conversion task function: job claimed renaming job file into claimed directory, converted and moved to done/failed
+// NOTE: rename() is atomic, only one process claims every job, jobs claimed by other processes are not converted.
+// Jobs left on claimed directory (process stopped) can be moved back to jobs directory to be converted
+static void QueuedConversionTaskFunc(void *data)
+{
+    ConversionTask *conversion = (ConversionTask *)data;
+    const ConversionQueue *queue = conversion->queue;
+
+    char jobFileName[600] = { 0 };
+    char claimedFileName[800] = { 0 };
+    snprintf(jobFileName, 600, "%s/jobs/%016llx.job", queue->path, conversion->jobHash);
+    snprintf(claimedFileName, 800, "%s/claimed/%016llx.%s.job", queue->path, conversion->jobHash, queue->claimId);
+
+    if (rename(jobFileName, claimedFileName) != 0) return;
+
+    conversion->claimed = true;
+
+    ConversionTaskFunc(conversion);
+
+    char endFileName[600] = { 0 };
+    snprintf(endFileName, 600, "%s/%s/%016llx.job", queue->path, conversion->success? "done" : "failed", conversion->jobHash);
+    rename(claimedFileName, endFileName);
+}
+
+// Get conversion work queue jobs count on directory: jobs, claimed, done or failed
+static int GetConversionQueueCount(const ConversionQueue *queue, const char *dirName)
+{
+    char dirPath[600] = { 0 };
+    snprintf(dirPath, 600, "%s/%s", queue->path, dirName);
+
+    int count = 0;
+    DIR *dir = opendir(dirPath);
+
+    if (dir != NULL)
+    {
+        for (struct dirent *entry = readdir(dir); entry != NULL; entry = readdir(dir)) if (IsFileExtension(entry->d_name, ".job")) count++;
+
+        closedir(dir);
+    }
+
+    return count;
+}
+#else
+// Load conversion work queue, not supported: POSIX rename() and directories required
+static bool LoadConversionQueue(const char *path, ConversionQueue *queue, ConversionTask *tasks, int taskCount)
+{
+    LOG("WARNING: Work queue not supported on this platform\n");
+    return false;
+}
+
+// Queued conversion task function, not supported
+static void QueuedConversionTaskFunc(void *data) { ConversionTaskFunc(data); }
+
+// Get conversion work queue jobs count on directory, not supported
+static int GetConversionQueueCount(const ConversionQueue *queue, const char *dirName) { return 0; }
+#endif
+#endif      // PLATFORM_DESKTOP
+
+#if !defined(COMMAND_LINE_ONLY)
+//--------------------------------------------------------------------------------------------
+// Sound slots functions
+//--------------------------------------------------------------------------------------------
+
+// Load sound slots list with a cache memory budget
+static SoundSlots LoadSoundSlots(int count, unsigned int cacheBudget)
+{
+    SoundSlots slots = { 0 };
+
+    slots.cacheBudget = cacheBudget;
+
+    for (int i = 0; i < count; i++) AddSoundSlot(&slots);
+
+    return slots;
+}
+
+// Unload sound slots list and cached data
+static void UnloadSoundSlots(SoundSlots *slots)
+{
+    // NOTE: Spectrogram and load tasks are expected to be done
+    while (slots->loadTasks != NULL)
+    {
+        SoundSlotLoadTask *task = slots->loadTasks;
+        slots->loadTasks = task->next;
+
+        UnloadWave(task->wave);
+        UnloadWavePeaks(&task->peaks);
+        RL_FREE(task);
+    }
+
+    slots->loadingCount = 0;
+
+    for (int i = 0; i < slots->count; i++)
+    {
+        UnloadSoundSlotCache(slots, i);
+
+        if (slots->slots[i].spectrogramTask != NULL)
+        {
+            RL_FREE(slots->slots[i].spectrogramTask->samples);
+            RL_FREE(slots->slots[i].spectrogramTask);
+        }
+    }
+
+    RL_FREE(slots->slots);
+
+    slots->slots = NULL;
+    slots->count = 0;
+    slots->capacity = 0;
+}
+
+// Add a new sound slot, returns slot index
+// NOTE: Slot is empty until generated, only wave parameters are stored
+static int AddSoundSlot(SoundSlots *slots)
+{
+    if (slots->count >= slots->capacity)
+    {
+        int capacity = (slots->capacity == 0)? SOUND_SLOTS_DEFAULT : slots->capacity*2;
+        SoundSlot *newSlots = (SoundSlot *)RL_REALLOC(slots->slots, capacity*sizeof(SoundSlot));
+
+        if (newSlots == NULL) return slots->count - 1;
+
+        slots->slots = newSlots;
+        slots->capacity = capacity;
+    }
+
+    SoundSlot *slot = &slots->slots[slots->count];
+    memset(slot, 0, sizeof(SoundSlot));
+
+    // Reset generation parameters
+    // NOTE: Random seed for generation is set
+    ResetWaveParams(&slot->params);
+
+    // Empty slot wave, default values
+    slot->wave.sampleRate = 44100;
+    slot->wave.sampleSize = 32;     // 32 bit -> float
+    slot->wave.channels = 1;        // 1 channel -> mono
+
+    slots->count++;
+
+    return slots->count - 1;
+}
+
+// Get sound slot, wave and sound regenerated on demand
+static SoundSlot *GetSoundSlot(SoundSlots *slots, int index)
+{
+    SoundSlot *slot = &slots->slots[index];
+
+    slots->tick++;
+    slot->lastUsed = slots->tick;
+
+    // NOTE: Slots being loaded are generated by load task
+    if (slot->generated && !slot->cached && (slot->loadTask == NULL))
+    {
+        // NOTE: Edited parameters are not saved into render cache, only loaded files waves
+        PROFILE_TIME(generateStartTime);
+        Wave wave = LoadRenderCacheWave(&renderCache, slot->params, WAVE_SAMPLE_RATE, 32, 1);
+        if (wave.data == NULL) wave = GenerateWave(slot->params);   // Generate wave from parameters
+        PROFILE_SAMPLE(PROFILE_GENERATE_WAVE, generateStartTime);
+        LoadSoundSlotWave(slots, index, wave, LoadWavePeaks(wave));
+    }
+
+    return slot;
+}
+
+// Load generated wave into sound slot cache, wave and peaks ownership is transferred to slot
+// NOTE: Least recently used slots are evicted from cache to keep memory under budget
+static void LoadSoundSlotWave(SoundSlots *slots, int index, Wave wave, WavePeaks peaks)
+{
+    SoundSlot *slot = &slots->slots[index];
+
+    UnloadSoundSlotCache(slots, index);
+
+    slot->wave = wave;
+    PROFILE_TIME(uploadStartTime);
+    slot->sound = LoadSoundFromWave(slot->wave);    // Load sound from new wave
+    PROFILE_SAMPLE(PROFILE_SOUND_UPLOAD, uploadStartTime);
+    slot->peaks = peaks;
+    slot->cached = true;
+
+    slots->waveCounter++;
+    slot->waveId = slots->waveCounter;
+
+    // Estimate cached data size: wave, device sound and peaks
+    slot->cacheSize = slot->wave.frameCount*sizeof(float)*(1 + SOUND_DEVICE_CHANNELS);
+    for (int i = 0; i < slot->peaks.levelCount; i++) slot->cacheSize += slot->peaks.blockCount[i]*2*sizeof(float);
+
+    slots->cacheSize += slot->cacheSize;
+
+    // Evict least recently used slots while over budget
+    // NOTE: Loaded slot and playing sounds are never evicted
+    while (slots->cacheSize > slots->cacheBudget)
+    {
+        int lruIndex = -1;
+
+        for (int i = 0; i < slots->count; i++)
+        {
+            if ((i != index) && slots->slots[i].cached && !IsSoundPlaying(slots->slots[i].sound) &&
+                ((lruIndex == -1) || (slots->slots[i].lastUsed < slots->slots[lruIndex].lastUsed))) lruIndex = i;
+        }
+
+        if (lruIndex == -1) break;
+
+        UnloadSoundSlotCache(slots, lruIndex);
+    }
+}
+
+// Regenerate sound slot wave and sound from parameters
+static void RegenerateSoundSlot(SoundSlots *slots, int index)
+{
+    UnloadSoundSlotCache(slots, index);
+
+    // NOTE: Slot loading in progress is discarded, parameters have been changed
+    if (slots->slots[index].loadTask != NULL) slots->loadingCount--;
+    slots->slots[index].loadTask = NULL;
+    slots->slots[index].generated = true;
+
+    GetSoundSlot(slots, index);
+}
+
+// Reset sound slot to empty (no wave generated)
+static void ResetSoundSlot(SoundSlots *slots, int index)
+{
+    UnloadSoundSlotCache(slots, index);
+
+    if (slots->slots[index].loadTask != NULL) slots->loadingCount--;
+    slots->slots[index].loadTask = NULL;
+    slots->slots[index].generated = false;
+}
+
+// Unload sound slot cached wave and sound
+static void UnloadSoundSlotCache(SoundSlots *slots, int index)
+{
+    SoundSlot *slot = &slots->slots[index];
+
+    if (slot->cached)
+    {
+        slots->cacheSize -= slot->cacheSize;
+        slot->cacheSize = 0;
+
+        UnloadSound(slot->sound);
+        UnloadWave(slot->wave);
+        UnloadWavePeaks(&slot->peaks);
+        if (slot->spectrogramWaveId != 0) UnloadTexture(slot->spectrogram);
+
+        slot->cached = false;
+    }
+
+    // NOTE: Spectrogram task in progress is kept, result is discarded when done
+    slot->spectrogramWaveId = 0;
+    memset(&slot->spectrogram, 0, sizeof(Texture2D));
+
+    // Empty slot wave, default values
+    slot->waveId = 0;
+    memset(&slot->sound, 0, sizeof(Sound));
+    memset(&slot->wave, 0, sizeof(Wave));
+    slot->wave.sampleRate = 44100;
+    slot->wave.sampleSize = 32;
+    slot->wave.channels = 1;
+}
+
+// Load wave parameters files into consecutive slots, starting at index (async)
+// NOTE: Required slots are added, parameters loading and wave generation are processed
+// by worker threads, returns number of slots to be loaded
+static int LoadSoundSlotsFromFiles(SoundSlots *slots, int index, const char **fileNames, int fileCount, WorkerPool *pool)
+{
+    int loadCount = 0;
+
+    for (int i = 0; i < fileCount; i++)
+    {
+        while ((index + i) >= slots->count)
+        {
+            if (AddSoundSlot(slots) != (slots->count - 1)) return loadCount;    // Slot could not be added
+        }
+
+        ResetSoundSlot(slots, index + i);
+
+        SoundSlotLoadTask *task = (SoundSlotLoadTask *)RL_CALLOC(1, sizeof(SoundSlotLoadTask));
+
+        task->slotIndex = index + i;
+        strncpy(task->fileName, fileNames[i], sizeof(task->fileName) - 1);
+        task->task.func = SoundSlotLoadTaskFunc;
+        task->task.data = task;
+
+        task->next = slots->loadTasks;
+        slots->loadTasks = task;
+
+        slots->slots[index + i].loadTask = task;
+        slots->loadingCount++;
+        loadCount++;
+
+        WorkerPoolPush(pool, &task->task);
+    }
+
+    return loadCount;
+}
+
+// Update sound slots loading, finished slots are loaded
+// NOTE: Slots reset or regenerated while loading discard load task result
+static void UpdateSoundSlotsLoading(SoundSlots *slots, WorkerPool *pool)
+{
+    SoundSlotLoadTask **taskPtr = &slots->loadTasks;
+
+    while (*taskPtr != NULL)
+    {
+        SoundSlotLoadTask *task = *taskPtr;
+
+        if (!IsWorkerTaskDone(pool, &task->task))
+        {
+            taskPtr = &task->next;
+            continue;
+        }
+
+        *taskPtr = task->next;      // Remove task from list
+
+        if ((task->slotIndex < slots->count) && (slots->slots[task->slotIndex].loadTask == task))
+        {
+            SoundSlot *slot = &slots->slots[task->slotIndex];
+
+            slot->params = task->params;
+            slot->generated = true;
+            slot->loadTask = NULL;
+            slots->loadingCount--;
+
+            slots->tick++;
+            slot->lastUsed = slots->tick;
+
+            LoadSoundSlotWave(slots, task->slotIndex, task->wave, task->peaks);
+        }
+        else
+        {
+            UnloadWave(task->wave);
+            UnloadWavePeaks(&task->peaks);
+        }
+
+        RL_FREE(task);
+    }
+}
+
+// Sound slot load task function, processed on a worker thread
+static void SoundSlotLoadTaskFunc(void *data)
+{
+    SoundSlotLoadTask *task = (SoundSlotLoadTask *)data;
+
+    task->params = LoadWaveParamsRFX(task->fileName);
+    task->wave = GenerateWaveCached(task->params, WAVE_SAMPLE_RATE, 32, 1, NULL);
+    task->peaks = LoadWavePeaks(task->wave);
+}
+
+// Update sound slot spectrogram, computed on a worker thread
+// NOTE: Spectrogram task is pushed when slot wave changes, texture is loaded once task is done
+static void UpdateSoundSlotSpectrogram(SoundSlots *slots, int index, WorkerPool *pool)
+{
+    SoundSlot *slot = &slots->slots[index];
+
+    if (slot->spectrogramTask != NULL)
+    {
+        if (!IsWorkerTaskDone(pool, &slot->spectrogramTask->task)) return;
+
+        SpectrogramTask *task = slot->spectrogramTask;
+
+        // Load spectrogram texture, only if wave has not changed while computing
+        if (slot->cached && (task->waveId == slot->waveId))
+        {
+            // NOTE: Levels are used as alpha, texture is tinted with style color on drawing
+            Image image = { 0 };
+            image.width = SPECTROGRAM_WIDTH;
+            image.height = SPECTROGRAM_HEIGHT;
+            image.mipmaps = 1;
+            image.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+            image.data = RL_MALLOC(SPECTROGRAM_WIDTH*SPECTROGRAM_HEIGHT*2);
+
+            for (int i = 0; i < SPECTROGRAM_WIDTH*SPECTROGRAM_HEIGHT; i++)
+            {
+                ((unsigned char *)image.data)[i*2] = 255;
+                ((unsigned char *)image.data)[i*2 + 1] = task->levels[i];
+            }
+
+            slot->spectrogram = LoadTextureFromImage(image);
+            SetTextureFilter(slot->spectrogram, TEXTURE_FILTER_BILINEAR);
+            slot->spectrogramWaveId = task->waveId;
+            UnloadImage(image);
+
+            slot->cacheSize += SPECTROGRAM_WIDTH*SPECTROGRAM_HEIGHT*2;
+            slots->cacheSize += SPECTROGRAM_WIDTH*SPECTROGRAM_HEIGHT*2;
+        }
+
+        RL_FREE(task->samples);
+        RL_FREE(task);
+        slot->spectrogramTask = NULL;
+    }
+
+    if (slot->cached && (slot->wave.frameCount > 0) && (slot->spectrogramWaveId != slot->waveId))
+    {
+        SpectrogramTask *task = (SpectrogramTask *)RL_CALLOC(1, sizeof(SpectrogramTask));
+
+        task->waveId = slot->waveId;
+        task->frameCount = (int)slot->wave.frameCount;
+        task->samples = (float *)RL_MALLOC(slot->wave.frameCount*sizeof(float));
+        memcpy(task->samples, slot->wave.data, slot->wave.frameCount*sizeof(float));
+
+        task->task.func = SpectrogramTaskFunc;
+        task->task.data = task;
+
+        slot->spectrogramTask = task;
+        WorkerPoolPush(pool, &task->task);
+    }
+}
+
+//--------------------------------------------------------------------------------------------
+// Spectrogram functions
+//--------------------------------------------------------------------------------------------
+
+// Load FFT plan for real input of provided size (power of 2, >= 4)
+// NOTE: Real input is processed as a complex FFT of half size, using radix-4 stages
+// (and one radix-2 stage if required), data is kept in separate real/imaginary arrays
+static FFTPlan LoadFFTPlan(int size)
+{
+    FFTPlan plan = { 0 };
+    int half = size/2;
+
+    plan.size = size;
+    while ((1 << plan.bits) < half) plan.bits++;
+
+    plan.data = (float *)RL_CALLOC(half*6, sizeof(float));
+    plan.twiddleRe = plan.data;
+    plan.twiddleIm = plan.data + half;
+    plan.splitRe = plan.data + half*2;
+    plan.splitIm = plan.data + half*3;
+    plan.re = plan.data + half*4;
+    plan.im = plan.data + half*5;
+    plan.bitReverse = (int *)RL_CALLOC(half, sizeof(int));
+
+    for (int i = 0; i < half; i++)
+    {
+        // Complex FFT twiddles: e^(-2*pi*i*k/half)
+        plan.twiddleRe[i] = (float)cos(2.0*PI*i/half);
+        plan.twiddleIm[i] = (float)-sin(2.0*PI*i/half);
+
+        // Real split twiddles: e^(-2*pi*i*k/size)
+        plan.splitRe[i] = (float)cos(2.0*PI*i/size);
+        plan.splitIm[i] = (float)-sin(2.0*PI*i/size);
+
+        for (int b = 0; b < plan.bits; b++) if (i & (1 << b)) plan.bitReverse[i] |= 1 << (plan.bits - 1 - b);
+    }
+
+    return plan;
+}
+
+// Unload FFT plan
+static void UnloadFFTPlan(FFTPlan *plan)
+{
+    RL_FREE(plan->data);
+    RL_FREE(plan->bitReverse);
+    memset(plan, 0, sizeof(FFTPlan));
+}
+
+// Compute FFT of real input, plan.size/2 + 1 bins are returned (DC to Nyquist)
+// NOTE: Plan work buffers are used, a plan can not be shared between threads
+static void ComputeFFT(FFTPlan *plan, const float *input, float *outRe, float *outIm)
+{
+    int half = plan->size/2;
+    float *re = plan->re;
+    float *im = plan->im;
+
+    // Pack even/odd samples as complex values, bit-reversed order
+    for (int i = 0; i < half; i++)
+    {
+        re[plan->bitReverse[i]] = input[2*i];
+        im[plan->bitReverse[i]] = input[2*i + 1];
+    }
+
+    int length = 1;     // Current sub-transforms length
+
+    // Radix-2 stage, only required for odd number of bits
+    if (plan->bits & 1)
+    {
+        for (int i = 0; i < half; i += 2)
+        {
+            float ar = re[i], ai = im[i];
+            float br = re[i + 1], bi = im[i + 1];
+
+            re[i] = ar + br; im[i] = ai + bi;
+            re[i + 1] = ar - br; im[i + 1] = ai - bi;
+        }
+
+        length = 2;
+    }
+
+    // Radix-4 stages, four sub-transforms of current length are combined
+    // NOTE: Because of bit-reversed input, sub-transforms are ordered as residues 0, 2, 1, 3
+    for (; length < half; length *= 4)
+    {
+        int stride = half/(length*4);
+
+        for (int group = 0; group < half; group += length*4)
+        {
+            float *re0 = re + group, *im0 = im + group;
+            float *re1 = re0 + length, *im1 = im0 + length;
+            float *re2 = re1 + length, *im2 = im1 + length;
+            float *re3 = re2 + length, *im3 = im2 + length;
+
+            for (int k = 0; k < length; k++)
+            {
+                float w1r = plan->twiddleRe[k*stride], w1i = plan->twiddleIm[k*stride];
+                float w2r = plan->twiddleRe[2*k*stride], w2i = plan->twiddleIm[2*k*stride];
+                float w3r = plan->twiddleRe[3*k*stride], w3i = plan->twiddleIm[3*k*stride];
+
+                float ar = re0[k], ai = im0[k];
+                float br = re1[k]*w2r - im1[k]*w2i, bi = re1[k]*w2i + im1[k]*w2r;
+                float cr = re2[k]*w1r - im2[k]*w1i, ci = re2[k]*w1i + im2[k]*w1r;
+                float dr = re3[k]*w3r - im3[k]*w3i, di = re3[k]*w3i + im3[k]*w3r;
+
+                float t0r = ar + br, t0i = ai + bi;
+                float t1r = ar - br, t1i = ai - bi;
+                float t2r = cr + dr, t2i = ci + di;
+                float t3r = cr - dr, t3i = ci - di;
+
+                re0[k] = t0r + t2r; im0[k] = t0i + t2i;
+                re1[k] = t1r + t3i; im1[k] = t1i - t3r;     // t1 - i*t3
+                re2[k] = t0r - t2r; im2[k] = t0i - t2i;
+                re3[k] = t1r - t3i; im3[k] = t1i + t3r;     // t1 + i*t3
+            }
+        }
+    }
+
+    // Split complex result into real input spectrum
+    outRe[0] = re[0] + im[0]; outIm[0] = 0.0f;
+    outRe[half] = re[0] - im[0]; outIm[half] = 0.0f;
+
+    for (int k = 1; k < half; k++)
+    {
+        float zr = re[k], zi = im[k];
+        float cr = re[half - k], ci = -im[half - k];    // Conjugate of mirrored bin
+
+        float evenRe = 0.5f*(zr + cr), evenIm = 0.5f*(zi + ci);     // Even samples spectrum
+        float oddRe = 0.5f*(zi - ci), oddIm = -0.5f*(zr - cr);      // Odd samples spectrum
+
+        outRe[k] = evenRe + plan->splitRe[k]*oddRe - plan->splitIm[k]*oddIm;
+        outIm[k] = evenIm + plan->splitRe[k]*oddIm + plan->splitIm[k]*oddRe;
+    }
+}
+
+// Spectrogram task function, processed on a worker thread
+// NOTE: Every column covers a Hann-windowed FFT centered on its frames position,
+// levels are mapped in dBFS from SPECTROGRAM_MIN_DB to 0, highest frequencies on first row
+static void SpectrogramTaskFunc(void *data)
+{
+    SpectrogramTask *task = (SpectrogramTask *)data;
+
+    FFTPlan plan = LoadFFTPlan(SPECTROGRAM_FFT_SIZE);
+
+    float window[SPECTROGRAM_FFT_SIZE] = { 0 };
+    float input[SPECTROGRAM_FFT_SIZE] = { 0 };
+    float outRe[SPECTROGRAM_FFT_SIZE/2 + 1] = { 0 };
+    float outIm[SPECTROGRAM_FFT_SIZE/2 + 1] = { 0 };
+    float windowSum = 0.0f;
+
+    for (int i = 0; i < SPECTROGRAM_FFT_SIZE; i++)
+    {
+        window[i] = 0.5f - 0.5f*(float)cos(2.0*PI*i/SPECTROGRAM_FFT_SIZE);
+        windowSum += window[i];
+    }
+
+    for (int x = 0; x < SPECTROGRAM_WIDTH; x++)
+    {
+        int start = (int)((long long)x*task->frameCount/SPECTROGRAM_WIDTH) - SPECTROGRAM_FFT_SIZE/2;
+
+        for (int i = 0; i < SPECTROGRAM_FFT_SIZE; i++)
+        {
+            int frame = start + i;
+            input[i] = ((frame >= 0) && (frame < task->frameCount))? task->samples[frame]*window[i] : 0.0f;
+        }
+
+        ComputeFFT(&plan, input, outRe, outIm);
+
+        // NOTE: Nyquist bin is discarded, SPECTROGRAM_HEIGHT bins are used
+        for (int y = 0; y < SPECTROGRAM_HEIGHT; y++)
+        {
+            float magnitude = 2.0f*sqrtf(outRe[y]*outRe[y] + outIm[y]*outIm[y])/windowSum;
+            float level = (magnitude > 0.0f)? 20.0f*log10f(magnitude) : SPECTROGRAM_MIN_DB;
+
+            level = (level - SPECTROGRAM_MIN_DB)/-SPECTROGRAM_MIN_DB;
+            if (level < 0.0f) level = 0.0f;
+            else if (level > 1.0f) level = 1.0f;
+
+            task->levels[(SPECTROGRAM_HEIGHT - 1 - y)*SPECTROGRAM_WIDTH + x] = (unsigned char)(level*255.0f);
+        }
+    }
+
+    UnloadFFTPlan(&plan);
+}
+#endif      // !COMMAND_LINE_ONLY
+
+//--------------------------------------------------------------------------------------------
+// Render cache functions
+//--------------------------------------------------------------------------------------------
+
+// Generate wave with provided format, render cache checked first and updated on generation
+// NOTE: Thread-safe, render cache is not modified once loaded
+static Wave GenerateWaveCached(WaveParams params, int sampleRate, int sampleSize, int channels, bool *cached)
+{
+    Wave wave = LoadRenderCacheWave(&renderCache, params, sampleRate, sampleSize, channels);
+
+    if (cached != NULL) *cached = (wave.data != NULL);
+
+    if (wave.data == NULL)
+    {
+        wave = GenerateWave(params);
+        WaveFormat(&wave, sampleRate, sampleSize, channels);
+        SaveRenderCacheWave(&renderCache, params, wave);
+    }
+
+    return wave;
+}
+
+//--------------------------------------------------------------------------------------------
+// Profiling functions
+//--------------------------------------------------------------------------------------------
+
+// Get profiler time in seconds, high resolution monotonic clock
+static double GetProfilerTime(void)
+{
+#if defined(_WIN32)
+    long long counter = 0;
+    long long frequency = 1;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+
+    return (double)counter/(double)frequency;
+#elif defined(PLATFORM_WEB)
+    return emscripten_get_now()/1000.0;
+#else
+    struct timespec now = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (double)now.tv_sec + (double)now.tv_nsec*1e-9;
+#endif
+}
+
+#if defined(SUPPORT_PROFILING)
+#if !defined(COMMAND_LINE_ONLY)
+// Add profile sample to stat rolling history
+// NOTE: Profile stats are expected to be updated from main thread only
+static void AddProfileSample(int stat, double seconds)
+{
+    ProfileStat *profile = &profileStats[stat];
+
+    profile->samples[profile->index] = (float)(seconds*1000.0);
+    profile->index = (profile->index + 1)%PROFILE_HISTORY_SIZE;
+    if (profile->sampleCount < PROFILE_HISTORY_SIZE) profile->sampleCount++;
+}
+
+// Draw profiler HUD: timings rolling histograms and slots memory
+static void DrawProfilerHUD(Rectangle bounds, SoundSlots *slots)
+{
+    Color textColor = GetColor(GuiGetStyle(DEFAULT, TEXT_COLOR_NORMAL));
+    Color barColor = GetColor(GuiGetStyle(DEFAULT, TEXT_COLOR_PRESSED));
+    int posY = (int)bounds.y + 8;
+
+    DrawRectangleRec(bounds, Fade(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)), 0.95f));
+    DrawRectangleLinesEx(bounds, 1, GetColor(GuiGetStyle(DEFAULT, LINE_COLOR)));
+
+    GuiLabel((Rectangle){ bounds.x + 8, (float)posY, bounds.width - 16, 16 }, "#152#Performance HUD (F4) - Last/Avg/Max (ms)");
+    posY += 20;
+
+    for (int i = 0; i < PROFILE_STAT_COUNT; i++)
+    {
+        ProfileStat *profile = &profileStats[i];
+        float last = 0.0f, avg = 0.0f, max = 0.0f;
+        int histogram[PROFILE_HISTOGRAM_BINS] = { 0 };
+        int histogramMax = 1;
+
+        for (int s = 0; s < profile->sampleCount; s++)
+        {
+            float sample = profile->samples[s];
+            avg += sample;
+            if (sample > max) max = sample;
+
+            // Histogram bin, log2 scale: bin 0 covers up to 2 us
+            int bin = 0;
+            for (float us = sample*1000.0f; (us >= 2.0f) && (bin < (PROFILE_HISTOGRAM_BINS - 1)); us /= 2.0f) bin++;
+
+            histogram[bin]++;
+            if (histogram[bin] > histogramMax) histogramMax = histogram[bin];
+        }
+
+        if (profile->sampleCount > 0)
+        {
+            last = profile->samples[(profile->index + PROFILE_HISTORY_SIZE - 1)%PROFILE_HISTORY_SIZE];
+            avg /= profile->sampleCount;
+        }
+
+        GuiLabel((Rectangle){ bounds.x + 8, (float)posY, 120, 16 }, profile->name);
+        GuiLabel((Rectangle){ bounds.x + 128, (float)posY, bounds.width - 136, 16 }, TextFormat("%7.3f / %7.3f / %7.3f", last, avg, max));
+        posY += 16;
+
+        // Draw rolling histogram, samples distribution from 1 us to 32 ms
+        int binWidth = ((int)bounds.width - 16 - 64)/PROFILE_HISTOGRAM_BINS;
+        DrawText("1us", (int)bounds.x + 8, posY + 6, 10, textColor);
+        DrawText("32ms", (int)bounds.x + 8 + 32 + binWidth*PROFILE_HISTOGRAM_BINS + 4, posY + 6, 10, textColor);
+
+        for (int b = 0; b < PROFILE_HISTOGRAM_BINS; b++)
+        {
+            int height = histogram[b]*16/histogramMax;
+            DrawRectangle((int)bounds.x + 8 + 32 + b*binWidth, posY + 16 - height, binWidth - 1, height, barColor);
+        }
+
+        DrawRectangle((int)bounds.x + 8 + 32, posY + 16, binWidth*PROFILE_HISTOGRAM_BINS, 1, textColor);
+        posY += 22;
+    }
+
+    GuiLine((Rectangle){ bounds.x, (float)posY, bounds.width, 12 }, NULL);
+    posY += 12;
+
+    // Draw slots memory: wave PCM data and device sound buffer (estimated)
+    GuiLabel((Rectangle){ bounds.x + 8, (float)posY, bounds.width - 16, 16 }, "Slots memory: PCM / device (KB)");
+    posY += 16;
+
+    int slotLines = 0;
+    int maxSlotLines = ((int)(bounds.y + bounds.height) - posY - 24)/14;
+
+    for (int i = 0; i < slots->count; i++)
+    {
+        if (!slots->slots[i].cached) continue;
+
+        if (slotLines < maxSlotLines)
+        {
+            unsigned int pcmSize = slots->slots[i].wave.frameCount*sizeof(float);
+            unsigned int deviceSize = slots->slots[i].wave.frameCount*sizeof(float)*SOUND_DEVICE_CHANNELS;
+
+            GuiLabel((Rectangle){ bounds.x + 8, (float)posY, bounds.width - 16, 14 }, TextFormat("Slot %02i: %6i / %6i", i + 1, pcmSize/1024, deviceSize/1024));
+            posY += 14;
+        }
+
+        slotLines++;
+    }
+
+    if (slotLines > maxSlotLines)
+    {
+        GuiLabel((Rectangle){ bounds.x + 8, (float)posY, bounds.width - 16, 14 }, TextFormat("... %i more cached slots", slotLines - maxSlotLines));
+        posY += 14;
+    }
+
+    GuiLabel((Rectangle){ bounds.x + 8, (float)posY + 4, bounds.width - 16, 16 }, TextFormat("Cache: %.2f / %.2f MB", (float)slots->cacheSize/(1024*1024), (float)slots->cacheBudget/(1024*1024)));
+}
+#endif  // !COMMAND_LINE_ONLY
+
+// Profile wave generation stages, results are logged
+// NOTE: Every stage mark cost is included into measured stage, so generation is measured twice:
+// with single and with doubled marks, stage work is estimated as: 2*single - doubled
+// Stages ticks are converted to nanoseconds using single marks runs total time
+static void ProfileGenerateWave(WaveParams params)
+{
+    GenerationProfile profile = { .markRepeat = 1 };
+    GenerationProfile doubledProfile = { .markRepeat = 2 };
+    double baseTime = 0.0;
+    double profiledTime = 0.0;
+    int frameCount = 0;
+
+    // Warm-up generation
+    Wave wave = GenerateWave(params);
+    frameCount = wave.frameCount;
+    UnloadWave(wave);
+
+    if (frameCount == 0)
+    {
+        LOG("WARNING: Generated wave is empty, nothing to profile\n");
+        return;
+    }
+
+    double startTime = GetProfilerTime();
+    for (int i = 0; i < PROFILE_GENERATION_RUNS; i++) UnloadWave(GenerateWave(params));
+    baseTime = GetProfilerTime() - startTime;
+
+    // NOTE: Single and doubled marks runs are interleaved to share same machine conditions
+    for (int i = 0; i < PROFILE_GENERATION_RUNS; i++)
+    {
+        SetGenerationProfile(&profile);
+        startTime = GetProfilerTime();
+        UnloadWave(GenerateWave(params));
+        profiledTime += GetProfilerTime() - startTime;
+
+        SetGenerationProfile(&doubledProfile);
+        UnloadWave(GenerateWave(params));
+    }
+
+    SetGenerationProfile(NULL);
+
+    // NOTE: Stage marks cover the whole generation, stages ticks sum is the instrumented runs total ticks
+    unsigned long long totalTicks = 0;
+    for (int i = 0; i < GENERATION_STAGE_COUNT; i++) totalTicks += profile.ticks[i];
+
+    static const char *stageNames[GENERATION_STAGE_COUNT] = {
+        "Setup", "Frequency/arpeggio/slide", "Envelope", "Oscillator", "LPF", "HPF", "Phaser", "Final accumulation"
+    };
+
+    double samples = (double)frameCount*PROFILE_GENERATION_RUNS;
+    double nsPerTick = (totalTicks > 0)? profiledTime*1e9/totalTicks : 0.0;
+    double stageTicks[GENERATION_STAGE_COUNT] = { 0 };
+    double stagesTicks = 0.0;
+
+    for (int i = 0; i < GENERATION_STAGE_COUNT; i++)
+    {
+        stageTicks[i] = 2.0*profile.ticks[i] - (double)doubledProfile.ticks[i];
+        if (stageTicks[i] < 0.0) stageTicks[i] = 0.0;
+        stagesTicks += stageTicks[i];
+    }
+
+    LOG("Generation profile: %i frames, %i runs, stage marks cost subtracted\n\n", frameCount, PROFILE_GENERATION_RUNS);
+    LOG("    %-26s %14s %12s %8s\n", "Stage", "ticks/sample", "ns/sample", "%");
+    LOG("    --------------------------------------------------------------\n");
+
+    for (int i = 0; i < GENERATION_STAGE_COUNT; i++)
+    {
+        LOG("    %-26s %14.2f %12.2f %7.2f%%\n", stageNames[i], stageTicks[i]/samples, stageTicks[i]*nsPerTick/samples,
+            (stagesTicks > 0.0)? 100.0*stageTicks[i]/stagesTicks : 0.0);
+    }
+
+    LOG("    --------------------------------------------------------------\n");
+    LOG("    %-26s %14.2f %12.2f\n", "Total (stages)", stagesTicks/samples, stagesTicks*nsPerTick/samples);
+    LOG("    %-26s %14s %12.2f\n", "Total (instrumented)", "", profiledTime*1e9/samples);
+    LOG("    %-26s %14s %12.2f\n\n", "Total (not instrumented)", "", baseTime*1e9/samples);
+}
+#endif  // SUPPORT_PROFILING
+
+#if !defined(COMMAND_LINE_ONLY)
+//--------------------------------------------------------------------------------------------
+// Auxiliar functions
+//--------------------------------------------------------------------------------------------
+// Load wave min/max peaks pyramid (32bit float mono wave)
+// NOTE: Computed once per wave generation, reductions use SSE if available
+static WavePeaks LoadWavePeaks(Wave wave)
+{
+    WavePeaks peaks = { 0 };
+
+    if ((wave.frameCount == 0) || (wave.data == NULL)) return peaks;
+
+    const float *samples = (const float *)wave.data;
+    int frameCount = (int)wave.frameCount;
+
+    // Compute levels and total data size
+    int totalBlocks = 0;
+    int blockCount = (frameCount + WAVE_PEAKS_BLOCK_SIZE - 1)/WAVE_PEAKS_BLOCK_SIZE;
+
+    while (peaks.levelCount < WAVE_PEAKS_MAX_LEVELS)
+    {
+        peaks.blockCount[peaks.levelCount] = blockCount;
+        totalBlocks += blockCount;
+        peaks.levelCount++;
+
+        if (blockCount == 1) break;
+        blockCount = (blockCount + 1)/2;
+    }
+
+    peaks.data = (float *)RL_CALLOC(totalBlocks*2, sizeof(float));
+
+    for (int i = 0, offset = 0; i < peaks.levelCount; i++)
+    {
+        peaks.min[i] = peaks.data + offset;
+        peaks.max[i] = peaks.data + offset + peaks.blockCount[i];
+        offset += peaks.blockCount[i]*2;
+    }
+
+    // Base level: reduce blocks of samples
+    int b = 0;
+
+#if defined(WAVE_PEAKS_SSE) && (WAVE_PEAKS_BLOCK_SIZE == 8)
+    for (; b < frameCount/WAVE_PEAKS_BLOCK_SIZE; b++)
+    {
+        __m128 s0 = _mm_loadu_ps(samples + b*8);
+        __m128 s1 = _mm_loadu_ps(samples + b*8 + 4);
+        __m128 vmin = _mm_min_ps(s0, s1);
+        __m128 vmax = _mm_max_ps(s0, s1);
+
+        // Horizontal reduction
+        vmin = _mm_min_ps(vmin, _mm_shuffle_ps(vmin, vmin, _MM_SHUFFLE(2, 3, 0, 1)));
+        vmin = _mm_min_ps(vmin, _mm_shuffle_ps(vmin, vmin, _MM_SHUFFLE(1, 0, 3, 2)));
+        vmax = _mm_max_ps(vmax, _mm_shuffle_ps(vmax, vmax, _MM_SHUFFLE(2, 3, 0, 1)));
+        vmax = _mm_max_ps(vmax, _mm_shuffle_ps(vmax, vmax, _MM_SHUFFLE(1, 0, 3, 2)));
+
+        _mm_store_ss(&peaks.min[0][b], vmin);
+        _mm_store_ss(&peaks.max[0][b], vmax);
+    }
+#endif
+    for (; b < peaks.blockCount[0]; b++)
+    {
+        int first = b*WAVE_PEAKS_BLOCK_SIZE;
+        int last = ((first + WAVE_PEAKS_BLOCK_SIZE) < frameCount)? first + WAVE_PEAKS_BLOCK_SIZE : frameCount;
+        float min = samples[first];
+        float max = samples[first];
+
+        for (int i = first + 1; i < last; i++)
+        {
+            if (samples[i] < min) min = samples[i];
+            if (samples[i] > max) max = samples[i];
+        }
+
+        peaks.min[0][b] = min;
+        peaks.max[0][b] = max;
+    }
+
+    // Next levels: reduce pairs of blocks from previous level
+    for (int level = 1; level < peaks.levelCount; level++)
+    {
+        const float *prevMin = peaks.min[level - 1];
+        const float *prevMax = peaks.max[level - 1];
+        int prevCount = peaks.blockCount[level - 1];
+        int i = 0;
+
+#if defined(WAVE_PEAKS_SSE)
+        for (; ((i + 4)*2) <= prevCount; i += 4)
+        {
+            __m128 m0 = _mm_loadu_ps(prevMin + i*2);
+            __m128 m1 = _mm_loadu_ps(prevMin + i*2 + 4);
+            __m128 x0 = _mm_loadu_ps(prevMax + i*2);
+            __m128 x1 = _mm_loadu_ps(prevMax + i*2 + 4);
+
+            // Deinterleave even/odd blocks and reduce them
+            _mm_storeu_ps(peaks.min[level] + i, _mm_min_ps(_mm_shuffle_ps(m0, m1, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(m0, m1, _MM_SHUFFLE(3, 1, 3, 1))));
+            _mm_storeu_ps(peaks.max[level] + i, _mm_max_ps(_mm_shuffle_ps(x0, x1, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(x0, x1, _MM_SHUFFLE(3, 1, 3, 1))));
+        }
+#endif
+        for (; i < peaks.blockCount[level]; i++)
+        {
+            float min = prevMin[i*2];
+            float max = prevMax[i*2];
+
+            if ((i*2 + 1) < prevCount)
+            {
+                if (prevMin[i*2 + 1] < min) min = prevMin[i*2 + 1];
+                if (prevMax[i*2 + 1] > max) max = prevMax[i*2 + 1];
+            }
+
+            peaks.min[level][i] = min;
+            peaks.max[level][i] = max;
+        }
+    }
+
+    return peaks;
+}
+
+// Unload wave peaks data
+static void UnloadWavePeaks(WavePeaks *peaks)
+{
+    RL_FREE(peaks->data);
+    memset(peaks, 0, sizeof(WavePeaks));
+}
+
+// Draw wave data using min/max peaks
+// NOTE: For proper visualization, MSAA x4 is recommended but it could be costly for the GPU
+// Alternative: Rendered to a bigger texture and scale down with bilinear/trilinear texture filtering
+// Every pixel column draws the min/max range of the frames it covers, peaks level is selected
+// depending on the number of frames covered, raw samples are used when zoomed in
+static void DrawWave(Wave *wave, WavePeaks *peaks, Rectangle bounds, int viewFrame, int viewFrameCount, Color color)
+{
+    if ((wave->frameCount == 0) || (peaks->levelCount == 0) || (viewFrameCount <= 0)) return;  // Empty wave, nothing to draw
+
+    const float *samples = (const float *)wave->data;
+    int columns = (int)bounds.width;
+    float framesPerColumn = (float)viewFrameCount/columns;
+    float sampleScale = (float)bounds.height;
+
+    // Select peaks level: biggest blocks still smaller than a column
+    int level = -1;
+    while (((level + 1) < peaks->levelCount) && ((WAVE_PEAKS_BLOCK_SIZE << (level + 1)) <= framesPerColumn)) level++;
+
+    for (int x = 0; x < columns; x++)
+    {
+        // Frames range covered by column, previous column last frame included to keep lines connected
+        int first = viewFrame + (int)(x*framesPerColumn) - 1;
+        int last = viewFrame + (int)((x + 1)*framesPerColumn);
+
+        if (first < 0) first = 0;
+        if (last <= first) last = first + 1;
+        if (last > (int)wave->frameCount) last = wave->frameCount;
+        if (first >= last) break;
+
+        float min = 0.0f;
+        float max = 0.0f;
+
+        if (level < 0)
+        {
+            // Zoomed in, use raw samples
+            min = samples[first];
+            max = samples[first];
+
+            for (int i = first + 1; i < last; i++)
+            {
+                if (samples[i] < min) min = samples[i];
+                if (samples[i] > max) max = samples[i];
+            }
+        }
+        else
+        {
+            int blockSize = WAVE_PEAKS_BLOCK_SIZE << level;
+            int lastBlock = (last - 1)/blockSize;
+
+            min = peaks->min[level][first/blockSize];
+            max = peaks->max[level][first/blockSize];
+
+            for (int i = first/blockSize + 1; i <= lastBlock; i++)
+            {
+                if (peaks->min[level][i] < min) min = peaks->min[level][i];
+                if (peaks->max[level][i] > max) max = peaks->max[level][i];
+            }
+        }
+
+        min *= sampleScale;
+        max *= sampleScale;
+
+        if (min < -bounds.height/2) min = -bounds.height/2;
+        if (max > bounds.height/2) max = bounds.height/2;
+        if (min > max) min = max;
+
+        // NOTE: Render texture is drawn vertically flipped, positive samples end up on top
+        DrawLineV((Vector2){ bounds.x + (float)x + 0.5f, bounds.y + bounds.height/2 + min },
+                  (Vector2){ bounds.x + (float)x + 0.5f, bounds.y + bounds.height/2 + max + 1.0f }, color);
+    }
+}
 
 // Draw help window with the provided lines
 static int GuiHelpWindow(Rectangle bounds, const char *title, const char **helpLines, int helpLinesCount)
@@ -2032,58 +5317,166 @@ static int GuiHelpWindow(Rectangle bounds, const char *title, const char **helpL
     return helpWindowActive;
 }
 
+// Split file names list in place, separator characters are replaced by '\0'
+// NOTE: Returns number of file names, fileNames pointers point into text
+static int SplitFileNames(char *text, char separator, const char **fileNames, int maxCount)
+{
+    int count = 0;
+
+    if ((text == NULL) || (text[0] == '\0')) return 0;
+
+    fileNames[count++] = text;
+
+    for (int i = 0; (text[i] != '\0') && (count < maxCount); i++)
+    {
+        if (text[i] == separator)
+        {
+            text[i] = '\0';
+            if (text[i + 1] != '\0') fileNames[count++] = text + i + 1;
+        }
+    }
+
+    return count;
+}
+#endif      // !COMMAND_LINE_ONLY
+
 #if defined(PLATFORM_DESKTOP)
-// Simple time wait in milliseconds
-static void WaitTimePlayer(int ms)
+// CLI player audio stream callback, wave frames provided to device
+// NOTE: Called from audio thread, frames are copied from player wave or generated on demand from
+// player wave generator (if no wave data), silence is provided after wave end (32bit float samples)
+static void PlayerAudioCallback(void *bufferData, unsigned int frames)
+{
+    unsigned int framesPlayed = playerFramesPlayed;
+    unsigned int frameSize = ((playerWave.data != NULL)? playerWave.channels : 1)*sizeof(float);
+    unsigned int frameCount = 0;
+
+    if (!playerFinished)
+    {
+        if (playerWave.data != NULL)
+        {
+            unsigned int framesAvailable = playerWave.frameCount - framesPlayed;
+            frameCount = (frames < framesAvailable)? frames : framesAvailable;
+
+            memcpy(bufferData, (unsigned char *)playerWave.data + framesPlayed*frameSize, frameCount*frameSize);
+            if (frameCount == framesAvailable) playerFinished = true;
+        }
+        else
+        {
+            frameCount = GenerateWaveFrames(&playerGenerator, (float *)bufferData, frames);
+            if (playerGenerator.finished) playerFinished = true;
+        }
+    }
+
+    if (frameCount < frames) memset((unsigned char *)bufferData + frameCount*frameSize, 0, (frames - frameCount)*frameSize);
+
+    playerFramesPlayed = framesPlayed + frameCount;
+}
+
+// Wait while CLI player is playing, until finished or ENTER/ESCAPE pressed
+// NOTE: Input is waited blocking with a timeout (no busy-wait), progress is audio device playback position,
+// wall clock is only used to let device play last frames and to stop if device does not play
+static void WaitPlayerCLI(int sampleRate)
 {
-    if (ms > 0)
+#if !defined(_WIN32)
+    // Terminal input mode set once: no line buffering and no echo
+    struct termios oldTerminal = { 0 };
+    bool terminal = (isatty(STDIN_FILENO) && (tcgetattr(STDIN_FILENO, &oldTerminal) == 0));
+
+    if (terminal)
+    {
+        struct termios newTerminal = oldTerminal;
+        newTerminal.c_lflag &= ~(ICANON | ECHO);
+        tcsetattr(STDIN_FILENO, TCSANOW, &newTerminal);
+    }
+
+    bool inputAvailable = true;     // Input closed (EOF) is not waited any more, only timeout
+#endif
+
+    double startTime = GetProfilerTime();
+    double endTime = 0.0;           // Time last wave frame was provided to device
+    double maxTime = (double)playerFrameCount/sampleRate + PLAYER_TIMEOUT_MARGIN;
+    int prevPercent = -1;
+
+    while (true)
     {
-        int currentTime = clock()*1000/CLOCKS_PER_SEC;  // Current time in milliseconds
-        int totalTime = currentTime + ms;               // Total required time in ms to return from this timeout
+        bool finished = playerFinished;
+        unsigned int framesPlayed = playerFramesPlayed;
+        double currentTime = GetProfilerTime();
 
-        int percent = 0;
-        int prevPercent = percent;
+        // Print console time bar, only on progress change
+        // NOTE: Generated waves could finish before max frames count
+        int percent = finished? 100 : (int)((unsigned long long)framesPlayed*100/playerFrameCount);
+        if (percent > 100) percent = 100;
 
-        // Wait until current ms time matches total ms time
-        while (currentTime <= totalTime)
+        if (percent != prevPercent)
         {
-            // Check for key pressed to stop playing
-            if (kbhit())
+            LOG("\r[");
+            for (int j = 0; j < 50; j++)
             {
-                int key = getch();
-                if ((key == 13) || (key == 27)) break;    // KEY_ENTER || KEY_ESCAPE
+                if (j < percent/2) LOG("=");
+                else LOG(" ");
             }
+            LOG("] [%02i%%]", percent);
+            fflush(stdout);
 
-            currentTime = clock()*1000/CLOCKS_PER_SEC;
-
-            // Print console time bar
-            percent = (int)(((float)currentTime/totalTime)*100.0f);
+            prevPercent = percent;
+        }
 
-            if (percent != prevPercent)
-            {
-                LOG("\r[");
-                for (int j = 0; j < 50; j++)
-                {
-                    if (j < percent/2) LOG("=");
-                    else LOG(" ");
-                }
-                LOG("] [%02i%%]", percent);
+        if (finished)
+        {
+            if (endTime == 0.0) endTime = currentTime;
+            else if ((currentTime - endTime) >= PLAYER_DRAIN_TIME) break;
+        }
 
-                prevPercent = percent;
-            }
+        if ((currentTime - startTime) > maxTime)
+        {
+            LOG("\nWARNING: Audio device is not playing");
+            break;
         }
 
-        LOG("\n\n");
+        // Wait for a key pressed to stop playing, progress updated on timeout
+        int key = 0;
+#if defined(_WIN32)
+        Sleep(PLAYER_UPDATE_TIME);
+        if (kbhit()) key = getch();
+#else
+        struct pollfd input = { .fd = STDIN_FILENO, .events = POLLIN };
+
+        if (poll(inputAvailable? &input : NULL, inputAvailable? 1 : 0, PLAYER_UPDATE_TIME) > 0)
+        {
+            unsigned char character = 0;
+
+            if (read(STDIN_FILENO, &character, 1) == 1) key = character;
+            else inputAvailable = false;
+        }
+#endif
+        if ((key == '\n') || (key == '\r') || (key == 27)) break;    // KEY_ENTER || KEY_ESCAPE
     }
+
+    LOG("\n\n");
+
+#if !defined(_WIN32)
+    if (terminal) tcsetattr(STDIN_FILENO, TCSANOW, &oldTerminal);
+#endif
 }
 
-// Play provided wave through CLI
-static void PlayWaveCLI(Wave wave)
+// Run CLI player, frames source (player wave or generator) must be set
+// NOTE: Audio device is only initialized here, frames are played as 32bit float audio stream
+static void RunPlayerCLI(int sampleRate, int channels)
 {
-    float waveTimeMs = (float)wave.frameCount*1000.0f/wave.sampleRate;
-
     InitAudioDevice();                  // Init audio device
-    Sound fx = LoadSoundFromWave(wave); // Load audio wave
+
+    if (!IsAudioDeviceReady())
+    {
+        LOG("WARNING: Audio device could not be initialized\n");
+        return;
+    }
+
+    playerFramesPlayed = 0;
+    playerFinished = false;
+
+    AudioStream stream = LoadAudioStream(sampleRate, 32, channels);
+    SetAudioStreamCallback(stream, PlayerAudioCallback);
 
     printf("\n//////////////////////////////////////////////////////////////////////////////////\n");
     printf("//                                                                              //\n");
@@ -2095,42 +5488,211 @@ static void PlayWaveCLI(Wave wave)
     printf("//                                                                              //\n");
     printf("//////////////////////////////////////////////////////////////////////////////////\n\n");
 
-    printf("Playing sound [%.2f sec.]. Press ENTER to finish.\n", waveTimeMs/1000.0f);
+    printf("Playing sound [%.2f sec.]. Press ENTER to finish.\n", (float)playerFrameCount/sampleRate);
 
-    PlaySound(fx);                      // Play sound
-    WaitTimePlayer(waveTimeMs);         // Wait while audio is playing
-    UnloadSound(fx);                    // Unload sound data
+    PlayAudioStream(stream);            // Play audio stream, frames requested by device
+    WaitPlayerCLI(sampleRate);          // Wait while audio is playing
+    UnloadAudioStream(stream);          // Unload audio stream, callback not called any more
     CloseAudioDevice();                 // Close audio device
 }
 
-#if !defined(_WIN32)
-// Check if a key has been pressed
-static int kbhit(void)
+// Play provided wave through CLI
+static void PlayWaveCLI(Wave wave)
+{
+    if ((wave.data == NULL) || (wave.frameCount == 0))
+    {
+        LOG("WARNING: No sound data to play\n");
+        return;
+    }
+
+    playerWave = WaveCopy(wave);
+    WaveFormat(&playerWave, playerWave.sampleRate, 32, playerWave.channels);
+    playerFrameCount = playerWave.frameCount;
+
+    RunPlayerCLI(playerWave.sampleRate, playerWave.channels);
+
+    UnloadWave(playerWave);             // Unload played wave copy
+    playerWave = (Wave){ 0 };
+}
+
+// Play provided wave parameters through CLI, wave generated while playing
+// NOTE: Frames are generated on audio stream requests, no full length wave buffer required
+static void PlayWaveParamsCLI(WaveParams params)
+{
+    playerGenerator = InitWaveGenerator(params);
+    playerFrameCount = playerGenerator.maxFrameCount;
+
+    RunPlayerCLI(WAVE_SAMPLE_RATE, 1);
+}
+#endif      // PLATFORM_DESKTOP
+
+#if defined(COMMAND_LINE_ONLY)
+//--------------------------------------------------------------------------------------------
+// raylib core functions, required on command line only builds (rcore and rtext not linked)
+// NOTE: Same behaviour as raylib ones, only functions used by tool and raudio/utils modules
+//--------------------------------------------------------------------------------------------
+#define MAX_TEXT_BUFFER_LENGTH      1024    // Size of internal static buffers used on some functions
+#define MAX_TEXTFORMAT_BUFFERS         4    // Max number of static buffers for text formatting
+#define MAX_TEXTSPLIT_COUNT          128    // Maximum number of substrings to split
+
+// Set the seed for the random number generator
+void SetRandomSeed(unsigned int seed)
+{
+    srand(seed);
+}
+
+// Get a random value between min and max (both included)
+int GetRandomValue(int min, int max)
+{
+    if (min > max)
+    {
+        int tmp = max;
+        max = min;
+        min = tmp;
+    }
+
+    return (rand()%(abs(max - min) + 1) + min);
+}
+
+// Get pointer to extension for a filename string (includes the dot: .png)
+const char *GetFileExtension(const char *fileName)
 {
-    struct termios oldt = { 0 };
-    struct termios newt = { 0 };
-    int ch = 0;
-    int oldf = 0;
+    const char *dot = strrchr(fileName, '.');
+
+    if (!dot || (dot == fileName)) return NULL;
 
-    tcgetattr(STDIN_FILENO, &oldt);
-    newt = oldt;
-    newt.c_lflag &= ~(ICANON | ECHO);
-    tcsetattr(STDIN_FILENO, TCSANOW, &newt);
-    oldf = fcntl(STDIN_FILENO, F_GETFL, 0);
-    fcntl(STDIN_FILENO, F_SETFL, oldf | O_NONBLOCK);
+    return dot;
+}
 
-    ch = getchar();
+// Check file extension (including point: .png, .wav), multiple extensions separated by ';'
+// NOTE: Extensions checking is not case-sensitive, no internal buffers used (thread-safe)
+bool IsFileExtension(const char *fileName, const char *ext)
+{
+    const char *fileExt = GetFileExtension(fileName);
+    if (fileExt == NULL) return false;
 
-    tcsetattr(STDIN_FILENO, TCSANOW, &oldt);
-    fcntl(STDIN_FILENO, F_SETFL, oldf);
+    int fileExtLength = (int)strlen(fileExt);
 
-    if (ch != EOF)
+    for (const char *check = ext; *check != '\0';)
     {
-        ungetc(ch, stdin);
-        return 1;
+        int checkLength = 0;
+        while ((check[checkLength] != '\0') && (check[checkLength] != ';')) checkLength++;
+
+        if (checkLength == fileExtLength)
+        {
+            int i = 0;
+            for (; i < checkLength; i++)
+            {
+                char a = fileExt[i];
+                char b = check[i];
+                if ((a >= 'A') && (a <= 'Z')) a += 32;
+                if ((b >= 'A') && (b <= 'Z')) b += 32;
+                if (a != b) break;
+            }
+
+            if (i == checkLength) return true;
+        }
+
+        check += checkLength;
+        if (*check == ';') check++;
     }
 
-    return 0;
+    return false;
 }
-#endif
-#endif      // PLATFORM_DESKTOP
+
+// Get pointer to filename for a path string
+const char *GetFileName(const char *filePath)
+{
+    const char *fileName = filePath;
+
+    for (const char *c = filePath; *c != '\0'; c++) if ((*c == '/') || (*c == '\\')) fileName = c + 1;
+
+    return fileName;
+}
+
+// Get filename string without extension (uses static string)
+const char *GetFileNameWithoutExt(const char *filePath)
+{
+    static char fileName[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    memset(fileName, 0, MAX_TEXT_BUFFER_LENGTH);
+
+    strncpy(fileName, GetFileName(filePath), MAX_TEXT_BUFFER_LENGTH - 1);
+
+    char *dot = strrchr(fileName, '.');
+    if (dot != NULL) *dot = '\0';
+
+    return fileName;
+}
+
+// Formatting of text with variables to 'embed'
+// WARNING: String returned will expire after this function is called MAX_TEXTFORMAT_BUFFERS times
+const char *TextFormat(const char *text, ...)
+{
+    static char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    static int index = 0;
+
+    char *currentBuffer = buffers[index];
+    memset(currentBuffer, 0, MAX_TEXT_BUFFER_LENGTH);
+
+    va_list args;
+    va_start(args, text);
+    vsnprintf(currentBuffer, MAX_TEXT_BUFFER_LENGTH, text, args);
+    va_end(args);
+
+    index += 1;
+    if (index >= MAX_TEXTFORMAT_BUFFERS) index = 0;
+
+    return currentBuffer;
+}
+
+// Split text into multiple strings (uses static buffers)
+const char **TextSplit(const char *text, char delimiter, int *count)
+{
+    static const char *result[MAX_TEXTSPLIT_COUNT] = { NULL };
+    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+
+    result[0] = buffer;
+    int counter = 0;
+
+    if (text != NULL)
+    {
+        counter = 1;
+
+        // Count how many substrings we have on text and point to every one
+        for (int i = 0; i < MAX_TEXT_BUFFER_LENGTH - 1; i++)
+        {
+            buffer[i] = text[i];
+            if (buffer[i] == '\0') break;
+            else if (buffer[i] == delimiter)
+            {
+                buffer[i] = '\0';   // Set an end of string at this point
+                result[counter] = buffer + i + 1;
+                counter++;
+
+                if (counter == MAX_TEXTSPLIT_COUNT) break;
+            }
+        }
+    }
+
+    *count = counter;
+    return result;
+}
+
+// Get integer value from text (negative values supported)
+int TextToInteger(const char *text)
+{
+    int value = 0;
+    int sign = 1;
+
+    if ((text[0] == '+') || (text[0] == '-'))
+    {
+        if (text[0] == '-') sign = -1;
+        text++;
+    }
+
+    for (int i = 0; ((text[i] >= '0') && (text[i] <= '9')); i++) value = value*10 + (int)(text[i] - '0');
+
+    return value*sign;
+}
+#endif      // COMMAND_LINE_ONLY
@@ -0,0 +1,1597 @@
+/*******************************************************************************************
+*
+*   rFXGen - Sound effects generation library (based on Tomas Petterson sfxr)
+*
+*   MODULE USAGE:
+*       #define RFXGEN_IMPLEMENTATION
+*       #include "rfxgen.h"
+*
+*       WaveParams params = GenPickupCoin();    // Generate sound parameters (or LoadWaveParams())
+*       Wave wave = GenerateWave(params);       // Generate wave: 44100 Hz, 32 bit float, mono
+*
+*       WaveGenerator generator = InitWaveGenerator(params);    // Or generate wave incrementally (streaming)
+*       while ((count = GenerateWaveFrames(&generator, frames, 1024)) > 0) { ... }
+*
+*   CONFIGURATION:
+*
+*   #define RFXGEN_SUPPORT_PROFILING
+*       Enable GenerateWave() stages instrumentation, stages ticks are recorded
+*       into the generation profile set with SetGenerationProfile()
+*       NOTE: Instrumentation is compiled out if not defined
+*
+*   NOTE: GenerateWave(), GenerateWaveFrames() and LoadWaveParamsRFX() are thread-safe, wave generation
+*   uses a local random generator seeded with wave parameters random seed
+*
+*   NOTE: CanonicalizeWaveParams() returns parameters generating the same wave with values not used by
+*   generation zeroed and values quantized, GetWaveParamsHash() hashes them: parameters with the same
+*   hash generate the same wave (used as key for generated waves caching and deduplication)
+*
+*   DEPENDENCIES:
+*       raylib 4.2      - Wave type, GetRandomValue(), RL_CALLOC()/RL_FREE() memory allocators
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2014-2022 raylib technologies (@raylibtech) / Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#ifndef RFXGEN_H
+#define RFXGEN_H
+
+#include "raylib.h"         // Required for: Wave, GetRandomValue(), RL_CALLOC(), RL_FREE()
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+// Wave generation version, increased when generated waves change for same parameters
+// NOTE: Used to invalidate previously generated outputs (command line incremental conversion)
+#define RFXGEN_GENERATION_VERSION    1
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Wave parameters type (96 bytes)
+typedef struct WaveParams {
+
+    // Random seed used to generate the wave
+    int randSeed;
+
+    // Wave type (square, sawtooth, sine, noise)
+    int waveTypeValue;
+
+    // Wave envelope parameters
+    float attackTimeValue;
+    float sustainTimeValue;
+    float sustainPunchValue;
+    float decayTimeValue;
+
+    // Frequency parameters
+    float startFrequencyValue;
+    float minFrequencyValue;
+    float slideValue;
+    float deltaSlideValue;
+    float vibratoDepthValue;
+    float vibratoSpeedValue;
+    //float vibratoPhaseDelayValue;
+
+    // Tone change parameters
+    float changeAmountValue;
+    float changeSpeedValue;
+
+    // Square wave parameters
+    float squareDutyValue;
+    float dutySweepValue;
+
+    // Repeat parameters
+    float repeatSpeedValue;
+
+    // Phaser parameters
+    float phaserOffsetValue;
+    float phaserSweepValue;
+
+    // Filter parameters
+    float lpfCutoffValue;
+    float lpfCutoffSweepValue;
+    float lpfResonanceValue;
+    float hpfCutoffValue;
+    float hpfCutoffSweepValue;
+
+} WaveParams;
+
+// Random numbers generator state, additive feedback generator (glibc random() compatible)
+// NOTE: Used on wave generation instead of rand(), it keeps generation thread-safe
+// and generated waves equivalent between platforms
+typedef struct RandomState {
+    unsigned int table[31];     // Generator state table
+    int front;                  // Front index in table
+    int rear;                   // Rear index in table
+} RandomState;
+
+// Wave generator type, incremental wave generation state (44100 Hz, 32 bit float, mono)
+// NOTE: No memory allocated, frames are generated into user provided buffers
+typedef struct WaveGenerator {
+    WaveParams params;          // Wave parameters, sanitized for generation
+    RandomState randomState;    // Random numbers generator state, seeded with parameters random seed
+    int frameIndex;             // Frames generated
+    int maxFrameCount;          // Max frames generated: envelope length limited to max wave length (10 seconds)
+    bool finished;              // Generation finished: envelope end, frequency cut-off or max length
+
+    // Frequency, duty and envelope state
+    int phase;
+    double fperiod;
+    double fmaxperiod;
+    double fslide;
+    double fdslide;
+    int period;
+    float squareDuty;
+    float squareSlide;
+    int envelopeStage;
+    int envelopeTime;
+    int envelopeLength[3];
+    float envelopeVolume;
+
+    // Phaser, noise and filters state
+    float fphase;
+    float fdphase;
+    int iphase;
+    float phaserBuffer[1024];
+    int ipp;
+    float noiseBuffer[32];
+    float fltp;
+    float fltdp;
+    float fltw;
+    float fltwd;
+    float fltdmp;
+    float fltphp;
+    float flthp;
+    float flthpd;
+
+    // Vibrato, repeat and arpeggio state
+    float vibratoPhase;
+    float vibratoSpeed;
+    float vibratoAmplitude;
+    int repeatTime;
+    int repeatLimit;
+    int arpeggioTime;
+    int arpeggioLimit;
+    double arpeggioModulation;
+} WaveGenerator;
+
+// Wave generation stages, measured on GenerateWave() profiling
+typedef enum {
+    GENERATION_STAGE_SETUP = 0,     // Parameters setup and buffers allocation
+    GENERATION_STAGE_FREQUENCY,     // Repeat, arpeggio, frequency slide, vibrato and duty sweep
+    GENERATION_STAGE_ENVELOPE,      // Volume envelope
+    GENERATION_STAGE_OSCILLATOR,    // Base waveform oscillator (supersampled)
+    GENERATION_STAGE_LPF,           // Low-pass filter (supersampled)
+    GENERATION_STAGE_HPF,           // High-pass filter, including cutoff sweep
+    GENERATION_STAGE_PHASER,        // Phaser, including offset sweep
+    GENERATION_STAGE_ACCUMULATION,  // Final accumulation, scaling, clamping and wave copy
+    GENERATION_STAGE_COUNT
+} GenerationStage;
+
+// Wave generation profile, ticks accumulated per stage
+typedef struct GenerationProfile {
+    unsigned long long ticks[GENERATION_STAGE_COUNT];   // Ticks accumulated per stage
+    unsigned long long lastTicks;   // Ticks on last stage mark
+    int markRepeat;                 // Ticks reads per stage mark, repeated reads only add mark cost
+} GenerationProfile;
+
+#ifdef __cplusplus
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+// Load/Save/Generate functions
+WaveParams LoadWaveParams(const char *fileName);                // Load wave parameters from file
+WaveParams LoadWaveParamsRFX(const char *fileName);             // Load wave parameters from .rfx file (thread-safe)
+WaveParams LoadWaveParamsFromMemory(const unsigned char *fileData, unsigned int dataSize);  // Load wave parameters from .rfx file data (thread-safe)
+void SaveWaveParams(WaveParams params, const char *fileName);   // Save wave parameters to file
+void ResetWaveParams(WaveParams *params);                       // Reset wave parameters
+Wave GenerateWave(WaveParams params);                           // Generate wave data from parameters
+WaveGenerator InitWaveGenerator(WaveParams params);             // Init wave generator from parameters, frames generated incrementally
+int GenerateWaveFrames(WaveGenerator *generator, float *frames, int frameCount);    // Generate next wave frames, returns frames generated
+void SetGenerationProfile(GenerationProfile *profile);          // Set wave generation profile, NULL to stop recording
+WaveParams CanonicalizeWaveParams(WaveParams params);           // Get canonical wave parameters, same wave generated (thread-safe)
+unsigned long long GetWaveParamsHash(WaveParams params);        // Get wave parameters hash, computed from canonical parameters (thread-safe)
+
+// Sound generation functions
+WaveParams GenPickupCoin(void);         // Generate sound: Pickup/Coin
+WaveParams GenLaserShoot(void);         // Generate sound: Laser shoot
+WaveParams GenExplosion(void);          // Generate sound: Explosion
+WaveParams GenPowerup(void);            // Generate sound: Powerup
+WaveParams GenHitHurt(void);            // Generate sound: Hit/Hurt
+WaveParams GenJump(void);               // Generate sound: Jump
+WaveParams GenBlipSelect(void);         // Generate sound: Blip/Select
+WaveParams GenRandomize(void);          // Generate random sound
+void WaveMutate(WaveParams *params);    // Mutate current sound
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RFXGEN_H
+
+/***********************************************************************************
+*
+*   RFXGEN IMPLEMENTATION
+*
+************************************************************************************/
+#if defined(RFXGEN_IMPLEMENTATION)
+
+#include <math.h>           // Required for: sinf(), powf(), pow(), isnan(), isfinite()
+#include <stdlib.h>         // Required for: abs(), srand()
+#include <string.h>         // Required for: memcpy(), memset()
+#include <stddef.h>         // Required for: offsetof()
+#include <limits.h>         // Required for: INT_MAX
+#include <stdio.h>          // Required for: FILE, fopen(), fread(), fwrite(), fclose()
+#include <time.h>           // Required for: time()
+
+#if defined(RFXGEN_SUPPORT_PROFILING)
+    #if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        #include <intrin.h>         // Required for: __rdtsc()
+        #define RFXGEN_TICKS_RDTSC
+    #elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+        #include <x86intrin.h>      // Required for: __rdtsc()
+        #define RFXGEN_TICKS_RDTSC
+    #elif defined(_WIN32)
+        int __stdcall QueryPerformanceCounter(long long *count);        // High resolution counter (kernel32.lib)
+    #elif defined(__EMSCRIPTEN__)
+        #include <emscripten/emscripten.h>  // Required for: emscripten_get_now()
+    #endif
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#if !defined(RFXGEN_LOG)
+    #define RFXGEN_LOG(...) printf(__VA_ARGS__)
+#endif
+
+// rFX file format sizes: header (signature, version, parameters length) and wave parameters
+#define RFX_PARAMS_SIZE            96       // WaveParams: 2 int values and 22 float values
+#define RFX_FILE_SIZE   (8 + RFX_PARAMS_SIZE)
+
+// Float random number generation
+#define frnd(range) ((float)GetRandomValue(0, 10000)/10000.0f*range)
+
+// Wave generation random numbers, local generator state (randomState) is used
+#define rnd(n) (GetNextRandom(&randomState)%(n + 1))
+#define GetRandomFloat(range) ((float)rnd(10000)/10000*range)
+
+#define MAX_WAVE_LENGTH_SECONDS  10     // Max length for wave: 10 seconds
+#define WAVE_SAMPLE_RATE      44100     // Default sample rate
+
+#define MAX_WAVE_PARAMS_VALUE   16.0f   // Max wave parameters absolute value: envelope, arpeggio and phaser values fit in int
+
+#if defined(RFXGEN_SUPPORT_PROFILING)
+    // Wave generation stages instrumentation, only recorded if a generation profile is set
+    // NOTE: Ticks elapsed since previous stage mark are accumulated into provided stage,
+    // mark can be repeated to measure its own cost in place
+    #define RFXGEN_PROFILE_STAGE_BEGIN() do { if (generationProfile != NULL) generationProfile->lastTicks = GetGenerationTicks(); } while (0)
+    #define RFXGEN_PROFILE_STAGE(stage) do { if (generationProfile != NULL) { \
+        for (int mark = 0; mark < generationProfile->markRepeat; mark++) { \
+            unsigned long long ticks = GetGenerationTicks(); \
+            generationProfile->ticks[stage] += ticks - generationProfile->lastTicks; \
+            generationProfile->lastTicks = ticks; } } } while (0)
+#else
+    #define RFXGEN_PROFILE_STAGE_BEGIN()
+    #define RFXGEN_PROFILE_STAGE(stage)
+#endif
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+// Wave generation stages profile, only recorded if set
+// NOTE: Not thread-safe, it should be set only when generating waves from a single thread
+static GenerationProfile *generationProfile = NULL;
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static RandomState InitRandomState(unsigned int seed);  // Init random numbers generator state with seed
+static int GetNextRandom(RandomState *state);           // Get next random number [0..RAND_MAX]
+static WaveParams SanitizeWaveParams(WaveParams params);    // Sanitize wave parameters for generation: wave type and values range
+static double GetWaveParamsValueKey(WaveParams params, size_t offset);      // Get generation value derived from wave parameter value (canonicalization)
+static void QuantizeWaveParamsValue(WaveParams *params, size_t offset);     // Quantize wave parameter value, smallest magnitude with same derived value
+#if defined(RFXGEN_SUPPORT_PROFILING)
+static unsigned long long GetGenerationTicks(void);     // Get generation profile ticks: CPU timestamp counter if available, nanoseconds otherwise
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Load/Save/Generate functions
+//----------------------------------------------------------------------------------
+
+// Reset wave parameters
+void ResetWaveParams(WaveParams *params)
+{
+    // NOTE: Random seed is set to a random value
+    params->randSeed = GetRandomValue(0x1, 0xFFFE);
+    srand(params->randSeed);
+
+    // Wave type
+    params->waveTypeValue = 0;
+
+    // Wave envelope params
+    params->attackTimeValue = 0.0f;
+    params->sustainTimeValue = 0.3f;
+    params->sustainPunchValue = 0.0f;
+    params->decayTimeValue = 0.4f;
+
+    // Frequency params
+    params->startFrequencyValue = 0.3f;
+    params->minFrequencyValue = 0.0f;
+    params->slideValue = 0.0f;
+    params->deltaSlideValue = 0.0f;
+    params->vibratoDepthValue = 0.0f;
+    params->vibratoSpeedValue = 0.0f;
+    //params->vibratoPhaseDelay = 0.0f;
+
+    // Tone change params
+    params->changeAmountValue = 0.0f;
+    params->changeSpeedValue = 0.0f;
+
+    // Square wave params
+    params->squareDutyValue = 0.0f;
+    params->dutySweepValue = 0.0f;
+
+    // Repeat params
+    params->repeatSpeedValue = 0.0f;
+
+    // Phaser params
+    params->phaserOffsetValue = 0.0f;
+    params->phaserSweepValue = 0.0f;
+
+    // Filter params
+    params->lpfCutoffValue = 1.0f;
+    params->lpfCutoffSweepValue = 0.0f;
+    params->lpfResonanceValue = 0.0f;
+    params->hpfCutoffValue = 0.0f;
+    params->hpfCutoffSweepValue = 0.0f;
+}
+
+// Init wave generator from wave parameters, wave frames generated incrementally
+// NOTE: Frames are generated as 44100Hz, 32bit float, mono, same frames than GenerateWave()
+WaveGenerator InitWaveGenerator(WaveParams params)
+{
+    WaveGenerator generator = { 0 };
+
+    // NOTE: Local random generator state is used, generation is thread-safe
+    RandomState randomState = InitRandomState(params.randSeed);
+
+    RFXGEN_PROFILE_STAGE_BEGIN();
+
+    // Configuration parameters for generation
+    // NOTE: Those parameters are calculated from selected values
+    double fperiod = 0.0;
+    double fmaxperiod = 0.0;
+    double fslide = 0.0;
+    double fdslide = 0.0;
+    int period = 0;
+    float squareDuty = 0.0f;
+    float squareSlide = 0.0f;
+    float fphase = 0.0f;
+    float fdphase = 0.0f;
+    int iphase = 0;
+    float fltw = 0.0f;
+    float fltwd = 0.0f;
+    float fltdmp = 0.0f;
+    float flthp = 0.0f;
+    float flthpd = 0.0f;
+    float vibratoSpeed = 0.0f;
+    float vibratoAmplitude = 0.0f;
+    int repeatLimit = 0;
+    int arpeggioLimit = 0;
+    double arpeggioModulation = 0.0;
+
+    // Non-finite and overflowing values are sanitized, values out of sliders range generate the same wave than previous versions
+    params = SanitizeWaveParams(params);
+
+    // NOTE: Min frequency over start frequency stops generation on first sample (cut-off frequency),
+    // slide lower than delta slide is also limited, sounds saved with previous versions render the same
+    if (params.minFrequencyValue > params.startFrequencyValue) params.minFrequencyValue = params.startFrequencyValue;
+    if (params.slideValue < params.deltaSlideValue) params.slideValue = params.deltaSlideValue;
+
+    // Reset sample parameters
+    //----------------------------------------------------------------------------------------
+    fperiod = 100.0/(params.startFrequencyValue*params.startFrequencyValue + 0.001);
+    period = (int)fperiod;
+    fmaxperiod = 100.0/(params.minFrequencyValue*params.minFrequencyValue + 0.001);
+    fslide = 1.0 - pow((double)params.slideValue, 3.0)*0.01;
+    fdslide = -pow((double)params.deltaSlideValue, 3.0)*0.000001;
+    squareDuty = 0.5f - params.squareDutyValue*0.5f;
+    squareSlide = -params.dutySweepValue*0.00005f;
+
+    if (params.changeAmountValue >= 0.0f) arpeggioModulation = 1.0 - pow((double)params.changeAmountValue, 2.0)*0.9;
+    else arpeggioModulation = 1.0 + pow((double)params.changeAmountValue, 2.0)*10.0;
+
+    arpeggioLimit = (int)(powf(1.0f - params.changeSpeedValue, 2.0f)*20000 + 32);
+
+    if (params.changeSpeedValue == 1.0f) arpeggioLimit = 0;     // WATCH OUT: float comparison
+
+    // Reset filter parameters
+    fltw = powf(params.lpfCutoffValue, 3.0f)*0.1f;
+    fltwd = 1.0f + params.lpfCutoffSweepValue*0.0001f;
+    fltdmp = 5.0f/(1.0f + powf(params.lpfResonanceValue, 2.0f)*20.0f)*(0.01f + fltw);
+    if (fltdmp > 0.8f) fltdmp = 0.8f;
+    flthp = powf(params.hpfCutoffValue, 2.0f)*0.1f;
+    flthpd = 1.0f + params.hpfCutoffSweepValue*0.0003f;
+
+    // Reset vibrato
+    vibratoSpeed = powf(params.vibratoSpeedValue, 2.0f)*0.01f;
+    vibratoAmplitude = params.vibratoDepthValue*0.5f;
+
+    // Reset envelope
+    generator.envelopeLength[0] = (int)(params.attackTimeValue*params.attackTimeValue*100000.0f);
+    generator.envelopeLength[1] = (int)(params.sustainTimeValue*params.sustainTimeValue*100000.0f);
+    generator.envelopeLength[2] = (int)(params.decayTimeValue*params.decayTimeValue*100000.0f);
+
+    fphase = powf(params.phaserOffsetValue, 2.0f)*1020.0f;
+    if (params.phaserOffsetValue < 0.0f) fphase = -fphase;
+
+    fdphase = powf(params.phaserSweepValue, 2.0f)*1.0f;
+    if (params.phaserSweepValue < 0.0f) fdphase = -fdphase;
+
+    iphase = abs((int)fphase);
+
+    for (int i = 0; i < 32; i++) generator.noiseBuffer[i] = GetRandomFloat(2.0f) - 1.0f;      // WATCH OUT: GetRandomFloat()
+
+    repeatLimit = (int)(powf(1.0f - params.repeatSpeedValue, 2.0f)*20000 + 32);
+
+    if (params.repeatSpeedValue == 0.0f) repeatLimit = 0;
+
+    // Max frames generated: every envelope stage lasts its length plus one frame
+    generator.maxFrameCount = generator.envelopeLength[0] + generator.envelopeLength[1] + generator.envelopeLength[2] + 3;
+    if (generator.maxFrameCount > MAX_WAVE_LENGTH_SECONDS*WAVE_SAMPLE_RATE) generator.maxFrameCount = MAX_WAVE_LENGTH_SECONDS*WAVE_SAMPLE_RATE;
+
+    generator.params = params;
+    generator.randomState = randomState;
+    generator.fperiod = fperiod;
+    generator.fmaxperiod = fmaxperiod;
+    generator.fslide = fslide;
+    generator.fdslide = fdslide;
+    generator.period = period;
+    generator.squareDuty = squareDuty;
+    generator.squareSlide = squareSlide;
+    generator.fphase = fphase;
+    generator.fdphase = fdphase;
+    generator.iphase = iphase;
+    generator.fltw = fltw;
+    generator.fltwd = fltwd;
+    generator.fltdmp = fltdmp;
+    generator.flthp = flthp;
+    generator.flthpd = flthpd;
+    generator.vibratoSpeed = vibratoSpeed;
+    generator.vibratoAmplitude = vibratoAmplitude;
+    generator.repeatLimit = repeatLimit;
+    generator.arpeggioLimit = arpeggioLimit;
+    generator.arpeggioModulation = arpeggioModulation;
+
+    RFXGEN_PROFILE_STAGE(GENERATION_STAGE_SETUP);
+
+    return generator;
+}
+
+// Generate next wave frames into provided buffer, returns frames generated
+// NOTE: Less frames than requested are generated when wave finishes (envelope end, frequency cut-off or max length)
+int GenerateWaveFrames(WaveGenerator *generator, float *frames, int frameCount)
+{
+    if (generator->finished) return 0;
+
+    RFXGEN_PROFILE_STAGE_BEGIN();
+
+    // Generator state copied to local variables, kept in registers while generating
+    WaveParams params = generator->params;
+    RandomState randomState = generator->randomState;
+    const int *envelopeLength = generator->envelopeLength;
+    float *phaserBuffer = generator->phaserBuffer;
+    float *noiseBuffer = generator->noiseBuffer;
+    int phase = generator->phase;
+    double fperiod = generator->fperiod;
+    double fmaxperiod = generator->fmaxperiod;
+    double fslide = generator->fslide;
+    double fdslide = generator->fdslide;
+    int period = generator->period;
+    float squareDuty = generator->squareDuty;
+    float squareSlide = generator->squareSlide;
+    int envelopeStage = generator->envelopeStage;
+    int envelopeTime = generator->envelopeTime;
+    float envelopeVolume = generator->envelopeVolume;
+    float fphase = generator->fphase;
+    float fdphase = generator->fdphase;
+    int iphase = generator->iphase;
+    int ipp = generator->ipp;
+    float fltp = generator->fltp;
+    float fltdp = generator->fltdp;
+    float fltw = generator->fltw;
+    float fltwd = generator->fltwd;
+    float fltdmp = generator->fltdmp;
+    float fltphp = generator->fltphp;
+    float flthp = generator->flthp;
+    float flthpd = generator->flthpd;
+    float vibratoPhase = generator->vibratoPhase;
+    float vibratoSpeed = generator->vibratoSpeed;
+    float vibratoAmplitude = generator->vibratoAmplitude;
+    int repeatTime = generator->repeatTime;
+    int repeatLimit = generator->repeatLimit;
+    int arpeggioTime = generator->arpeggioTime;
+    int arpeggioLimit = generator->arpeggioLimit;
+    double arpeggioModulation = generator->arpeggioModulation;
+
+    // NOTE: Wave length is limited to max length, generation could finish before
+    if (frameCount > (MAX_WAVE_LENGTH_SECONDS*WAVE_SAMPLE_RATE - generator->frameIndex)) frameCount = MAX_WAVE_LENGTH_SECONDS*WAVE_SAMPLE_RATE - generator->frameIndex;
+
+    bool generatingSample = true;
+    int generated = 0;
+
+    for (; (generated < frameCount) && generatingSample; generated++)
+    {
+        // Generate sample using selected parameters
+        //------------------------------------------------------------------------------------
+        repeatTime++;
+
+        if ((repeatLimit != 0) && (repeatTime >= repeatLimit))
+        {
+            // Reset sample parameters (only some of them)
+            repeatTime = 0;
+
+            fperiod = 100.0/(params.startFrequencyValue*params.startFrequencyValue + 0.001);
+            period = (int)fperiod;
+            fmaxperiod = 100.0/(params.minFrequencyValue*params.minFrequencyValue + 0.001);
+            fslide = 1.0 - pow((double)params.slideValue, 3.0)*0.01;
+            fdslide = -pow((double)params.deltaSlideValue, 3.0)*0.000001;
+            squareDuty = 0.5f - params.squareDutyValue*0.5f;
+            squareSlide = -params.dutySweepValue*0.00005f;
+
+            if (params.changeAmountValue >= 0.0f) arpeggioModulation = 1.0 - pow((double)params.changeAmountValue, 2.0)*0.9;
+            else arpeggioModulation = 1.0 + pow((double)params.changeAmountValue, 2.0)*10.0;
+
+            arpeggioTime = 0;
+            arpeggioLimit = (int)(powf(1.0f - params.changeSpeedValue, 2.0f)*20000 + 32);
+
+            if (params.changeSpeedValue == 1.0f) arpeggioLimit = 0;     // WATCH OUT: float comparison
+        }
+
+        // Frequency envelopes/arpeggios
+        arpeggioTime++;
+
+        if ((arpeggioLimit != 0) && (arpeggioTime >= arpeggioLimit))
+        {
+            arpeggioLimit = 0;
+            fperiod *= arpeggioModulation;
+        }
+
+        fslide += fdslide;
+        fperiod *= fslide;
+
+        if (fperiod > fmaxperiod)
+        {
+            fperiod = fmaxperiod;
+
+            if (params.minFrequencyValue > 0.0f) generatingSample = false;
+        }
+
+        float rfperiod = (float)fperiod;
+
+        if (vibratoAmplitude > 0.0f)
+        {
+            vibratoPhase += vibratoSpeed;
+            rfperiod = (float)(fperiod*(1.0 + sinf(vibratoPhase)*vibratoAmplitude));
+        }
+
+        // NOTE: Period is limited before conversion, vibrato and arpeggio modulations out of range could overflow int
+        if (!(rfperiod > 8.0f)) period = 8;
+        else if (rfperiod >= (float)INT_MAX) period = INT_MAX;
+        else period = (int)rfperiod;
+
+        squareDuty += squareSlide;
+
+        if (squareDuty < 0.0f) squareDuty = 0.0f;
+        if (squareDuty > 0.5f) squareDuty = 0.5f;
+
+        RFXGEN_PROFILE_STAGE(GENERATION_STAGE_FREQUENCY);
+
+        // Volume envelope
+        envelopeTime++;
+
+        if (envelopeTime > envelopeLength[envelopeStage])
+        {
+            envelopeTime = 0;
+            envelopeStage++;
+
+            if (envelopeStage == 3) generatingSample = false;
+        }
+
+        // NOTE: Zero length stages last one sample, division by zero avoided (NaN propagated by filters)
+        if (envelopeStage == 0) envelopeVolume = (float)envelopeTime/envelopeLength[0];
+        if (envelopeStage == 1) envelopeVolume = 1.0f + powf(1.0f - ((envelopeLength[1] > 0)? (float)envelopeTime/envelopeLength[1] : 0.0f), 1.0f)*2.0f*params.sustainPunchValue;
+        if (envelopeStage == 2) envelopeVolume = 1.0f - ((envelopeLength[2] > 0)? (float)envelopeTime/envelopeLength[2] : 0.0f);
+
+        RFXGEN_PROFILE_STAGE(GENERATION_STAGE_ENVELOPE);
+
+        // Phaser step
+        fphase += fdphase;
+        iphase = abs((int)fphase);
+
+        if (iphase > 1023) iphase = 1023;
+
+        RFXGEN_PROFILE_STAGE(GENERATION_STAGE_PHASER);
+
+        if (flthpd != 0.0f)     // WATCH OUT!
+        {
+            flthp *= flthpd;
+            if (flthp < 0.00001f) flthp = 0.00001f;
+            if (flthp > 0.1f) flthp = 0.1f;
+        }
+
+        RFXGEN_PROFILE_STAGE(GENERATION_STAGE_HPF);
+
+        float ssample = 0.0f;
+
+        #define MAX_SUPERSAMPLING   8
+
+        // Supersampling x8
+        for (int si = 0; si < MAX_SUPERSAMPLING; si++)
+        {
+            float sample = 0.0f;
+            phase++;
+
+            if (phase >= period)
+            {
+                //phase = 0;
+                phase %= period;
+
+                if (params.waveTypeValue == 3)
+                {
+                    for (int i = 0;i < 32; i++) noiseBuffer[i] = GetRandomFloat(2.0f) - 1.0f;   // WATCH OUT: GetRandomFloat()
+                }
+            }
+
+            // base waveform
+            float fp = (float)phase/period;
+
+            switch (params.waveTypeValue)
+            {
+                case 0: // Square wave
+                {
+                    if (fp < squareDuty) sample = 0.5f;
+                    else sample = -0.5f;
+
+                } break;
+                case 1: sample = 1.0f - fp*2; break;    // Sawtooth wave
+                case 2: sample = sinf(fp*2*PI); break;  // Sine wave
+                case 3: sample = noiseBuffer[phase*32/period]; break; // Noise wave
+                default: break;
+            }
+
+            RFXGEN_PROFILE_STAGE(GENERATION_STAGE_OSCILLATOR);
+
+            // LP filter
+            float pp = fltp;
+            fltw *= fltwd;
+
+            if (fltw < 0.0f) fltw = 0.0f;
+            if (fltw > 0.1f) fltw = 0.1f;
+
+            if (params.lpfCutoffValue != 1.0f)  // WATCH OUT!
+            {
+                fltdp += (sample-fltp)*fltw;
+                fltdp -= fltdp*fltdmp;
+            }
+            else
+            {
+                fltp = sample;
+                fltdp = 0.0f;
+            }
+
+            fltp += fltdp;
+
+            RFXGEN_PROFILE_STAGE(GENERATION_STAGE_LPF);
+
+            // HP filter
+            fltphp += fltp - pp;
+            fltphp -= fltphp*flthp;
+            sample = fltphp;
+
+            RFXGEN_PROFILE_STAGE(GENERATION_STAGE_HPF);
+
+            // Phaser
+            phaserBuffer[ipp & 1023] = sample;
+            sample += phaserBuffer[(ipp - iphase + 1024) & 1023];
+            ipp = (ipp + 1) & 1023;
+
+            RFXGEN_PROFILE_STAGE(GENERATION_STAGE_PHASER);
+
+            // Final accumulation and envelope application
+            ssample += sample*envelopeVolume;
+
+            RFXGEN_PROFILE_STAGE(GENERATION_STAGE_ACCUMULATION);
+        }
+
+        #define SAMPLE_SCALE_COEFICIENT 0.2f    // NOTE: Used to scale sample value to [-1..1]
+
+        ssample = (ssample/MAX_SUPERSAMPLING)*SAMPLE_SCALE_COEFICIENT;
+        //------------------------------------------------------------------------------------
+
+        // Accumulate samples in the buffer
+        if (ssample > 1.0f) ssample = 1.0f;
+        if (ssample < -1.0f) ssample = -1.0f;
+
+        frames[generated] = ssample;
+
+        RFXGEN_PROFILE_STAGE(GENERATION_STAGE_ACCUMULATION);
+    }
+
+    generator->frameIndex += generated;
+    generator->finished = !generatingSample || (generator->frameIndex >= MAX_WAVE_LENGTH_SECONDS*WAVE_SAMPLE_RATE);
+    generator->randomState = randomState;
+    generator->phase = phase;
+    generator->fperiod = fperiod;
+    generator->fmaxperiod = fmaxperiod;
+    generator->fslide = fslide;
+    generator->fdslide = fdslide;
+    generator->period = period;
+    generator->squareDuty = squareDuty;
+    generator->squareSlide = squareSlide;
+    generator->envelopeStage = envelopeStage;
+    generator->envelopeTime = envelopeTime;
+    generator->envelopeVolume = envelopeVolume;
+    generator->fphase = fphase;
+    generator->fdphase = fdphase;
+    generator->iphase = iphase;
+    generator->ipp = ipp;
+    generator->fltp = fltp;
+    generator->fltdp = fltdp;
+    generator->fltw = fltw;
+    generator->fltwd = fltwd;
+    generator->fltdmp = fltdmp;
+    generator->fltphp = fltphp;
+    generator->flthp = flthp;
+    generator->flthpd = flthpd;
+    generator->vibratoPhase = vibratoPhase;
+    generator->vibratoSpeed = vibratoSpeed;
+    generator->vibratoAmplitude = vibratoAmplitude;
+    generator->repeatTime = repeatTime;
+    generator->repeatLimit = repeatLimit;
+    generator->arpeggioTime = arpeggioTime;
+    generator->arpeggioLimit = arpeggioLimit;
+    generator->arpeggioModulation = arpeggioModulation;
+
+    return generated;
+}
+
+// Generates new wave from wave parameters
+// NOTE: By default wave is generated as 44100Hz, 32bit float, mono
+Wave GenerateWave(WaveParams params)
+{
+    // NOTE: We reserve enough space for up to 10 seconds of wave audio at given sample rate
+    // By default we use float size samples, they are converted to desired sample size at the end
+    float *buffer = (float *)RL_CALLOC(MAX_WAVE_LENGTH_SECONDS*WAVE_SAMPLE_RATE, sizeof(float));
+
+    WaveGenerator generator = InitWaveGenerator(params);
+    int sampleCount = GenerateWaveFrames(&generator, buffer, MAX_WAVE_LENGTH_SECONDS*WAVE_SAMPLE_RATE);
+
+    Wave genWave = { 0 };
+    genWave.frameCount = sampleCount/1;    // Number of samples / channels
+    genWave.sampleRate = WAVE_SAMPLE_RATE; // By default 44100 Hz
+    genWave.sampleSize = 32;               // By default 32 bit float samples
+    genWave.channels = 1;                  // By default 1 channel (mono)
+
+    // NOTE: Wave can be converted to desired format after generation
+
+    genWave.data = (float *)RL_CALLOC(genWave.frameCount*genWave.channels, sizeof(float));
+    memcpy(genWave.data, buffer, genWave.frameCount*genWave.channels*sizeof(float));
+
+    RL_FREE(buffer);
+
+    RFXGEN_PROFILE_STAGE(GENERATION_STAGE_ACCUMULATION);
+
+    return genWave;
+}
+
+// Get canonical wave parameters: same wave generated, values not used by generation are zeroed
+// and values are quantized to the smallest magnitude generating the same wave
+// NOTE: Rules depend on InitWaveGenerator()/GenerateWaveFrames() generation, keep them in sync
+WaveParams CanonicalizeWaveParams(WaveParams params)
+{
+    // Sanitized values and limits applied as InitWaveGenerator() does
+    params = SanitizeWaveParams(params);
+
+    if (params.minFrequencyValue > params.startFrequencyValue) params.minFrequencyValue = params.startFrequencyValue;
+    if (params.slideValue < params.deltaSlideValue) params.slideValue = params.deltaSlideValue;
+
+    // Random seed only used by noise wave, seed 0 is considered as seed 1
+    if (params.waveTypeValue != 3) params.randSeed = 0;
+    else if (params.randSeed == 0) params.randSeed = 1;
+
+    // Square duty only used by square wave
+    if (params.waveTypeValue != 0)
+    {
+        params.squareDutyValue = 0.0f;
+        params.dutySweepValue = 0.0f;
+    }
+
+    // Low-pass filter bypassed with cutoff 1.0f
+    if (params.lpfCutoffValue == 1.0f)
+    {
+        params.lpfCutoffSweepValue = 0.0f;
+        params.lpfResonanceValue = 0.0f;
+    }
+
+    // Vibrato not applied without amplitude, no phase increment is also no vibrato (sinf(0.0f))
+    if ((params.vibratoDepthValue*0.5f <= 0.0f) || (powf(params.vibratoSpeedValue, 2.0f)*0.01f == 0.0f))
+    {
+        params.vibratoDepthValue = 0.0f;
+        params.vibratoSpeedValue = 0.0f;
+    }
+
+    // Arpeggio not applied without limit or with no period modulation
+    double arpeggioModulation = 0.0;
+    if (params.changeAmountValue >= 0.0f) arpeggioModulation = 1.0 - pow((double)params.changeAmountValue, 2.0)*0.9;
+    else arpeggioModulation = 1.0 + pow((double)params.changeAmountValue, 2.0)*10.0;
+
+    if ((params.changeSpeedValue == 1.0f) || (arpeggioModulation == 1.0))
+    {
+        params.changeAmountValue = 0.0f;
+        params.changeSpeedValue = 0.0f;
+    }
+
+    // Values quantized to the precision used by generation
+    // NOTE: Sweep values are quantized before the values using them (duty, cutoff)
+    // Frequency, slide, arpeggio amount, vibrato depth and punch are used in double precision or by
+    // several stages, they are not quantized
+    static const size_t quantizedOffsets[] = {
+        offsetof(WaveParams, attackTimeValue), offsetof(WaveParams, sustainTimeValue), offsetof(WaveParams, decayTimeValue),
+        offsetof(WaveParams, vibratoSpeedValue), offsetof(WaveParams, changeSpeedValue), offsetof(WaveParams, repeatSpeedValue),
+        offsetof(WaveParams, dutySweepValue), offsetof(WaveParams, squareDutyValue),
+        offsetof(WaveParams, phaserOffsetValue), offsetof(WaveParams, phaserSweepValue),
+        offsetof(WaveParams, lpfCutoffValue), offsetof(WaveParams, lpfCutoffSweepValue), offsetof(WaveParams, lpfResonanceValue),
+        offsetof(WaveParams, hpfCutoffSweepValue), offsetof(WaveParams, hpfCutoffValue)
+    };
+
+    for (int i = 0; i < (int)(sizeof(quantizedOffsets)/sizeof(quantizedOffsets[0])); i++) QuantizeWaveParamsValue(&params, quantizedOffsets[i]);
+
+    return params;
+}
+
+// Get wave parameters hash: FNV-1a 64 bit over canonical parameters
+// NOTE: Values are hashed as little-endian 32 bit words (same hash on every platform),
+// negative zero is kept (it could generate a different wave than zero)
+unsigned long long GetWaveParamsHash(WaveParams params)
+{
+    params = CanonicalizeWaveParams(params);
+
+    unsigned int words[RFX_PARAMS_SIZE/4] = { 0 };
+    memcpy(words, &params, RFX_PARAMS_SIZE);
+
+    unsigned long long hash = 14695981039346656037ULL;
+
+    for (int i = 0; i < RFX_PARAMS_SIZE/4; i++)
+    {
+        for (int b = 0; b < 4; b++)
+        {
+            hash ^= (words[i] >> (8*b)) & 0xff;
+            hash *= 1099511628211ULL;
+        }
+    }
+
+    // Generation version is hashed, waves generated by different versions are not the same
+    hash ^= RFXGEN_GENERATION_VERSION;
+    hash *= 1099511628211ULL;
+
+    return hash;
+}
+
+// Load .rfx (rFXGen) or .sfs (sfxr) sound parameters file
+WaveParams LoadWaveParams(const char *fileName)
+{
+    WaveParams params = { 0 };
+
+    if (IsFileExtension(fileName, ".rfx")) params = LoadWaveParamsRFX(fileName);
+    /*
+    else if (IsFileExtension(fileName, ".sfs"))
+    {
+        // NOTE: It seem .sfs loading has some issues,
+        // I can't see the point to keep supporting this format
+
+        FILE *sfsFile = fopen(fileName, "rb");
+
+        if (sfsFile == NULL) return params;
+
+        // Load .sfs sound parameters
+        int version = 0;
+        fread(&version, 1, sizeof(int), sfsFile);
+
+        if ((version == 100) || (version == 101) || (version == 102))
+        {
+            fread(&params.waveTypeValue, 1, sizeof(int), sfsFile);
+
+            volumeValue = 0.5f;
+
+            if (version == 102) fread(&volumeValue, 1, sizeof(float), sfsFile);
+
+            fread(&params.startFrequencyValue, 1, sizeof(float), sfsFile);
+            fread(&params.minFrequencyValue, 1, sizeof(float), sfsFile);
+            fread(&params.slideValue, 1, sizeof(float), sfsFile);
+
+            if (version >= 101) fread(&params.deltaSlideValue, 1, sizeof(float), sfsFile);
+
+            fread(&params.squareDutyValue, 1, sizeof(float), sfsFile);
+            fread(&params.dutySweepValue, 1, sizeof(float), sfsFile);
+
+            fread(&params.vibratoDepthValue, 1, sizeof(float), sfsFile);
+            fread(&params.vibratoSpeedValue, 1, sizeof(float), sfsFile);
+
+            float vibratoPhaseDelay = 0.0f;
+            fread(&vibratoPhaseDelay, 1, sizeof(float), sfsFile); // Not used
+
+            fread(&params.attackTimeValue, 1, sizeof(float), sfsFile);
+            fread(&params.sustainTimeValue, 1, sizeof(float), sfsFile);
+            fread(&params.decayTimeValue, 1, sizeof(float), sfsFile);
+            fread(&params.sustainPunchValue, 1, sizeof(float), sfsFile);
+
+            bool filterOn = false;
+            fread(&filterOn, 1, sizeof(bool), sfsFile); // Not used
+
+            fread(&params.lpfResonanceValue, 1, sizeof(float), sfsFile);
+            fread(&params.lpfCutoffValue, 1, sizeof(float), sfsFile);
+            fread(&params.lpfCutoffSweepValue, 1, sizeof(float), sfsFile);
+            fread(&params.hpfCutoffValue, 1, sizeof(float), sfsFile);
+            fread(&params.hpfCutoffSweepValue, 1, sizeof(float), sfsFile);
+
+            fread(&params.phaserOffsetValue, 1, sizeof(float), sfsFile);
+            fread(&params.phaserSweepValue, 1, sizeof(float), sfsFile);
+            fread(&params.repeatSpeedValue, 1, sizeof(float), sfsFile);
+
+            if (version >= 101)
+            {
+                fread(&params.changeSpeedValue, 1, sizeof(float), sfsFile);
+                fread(&params.changeAmountValue, 1, sizeof(float), sfsFile);
+            }
+        }
+        else RFXGEN_LOG("[%s] SFS file version not supported\n", fileName);
+
+        fclose(sfsFile);
+    }
+    */
+
+    return params;
+}
+
+// Load wave parameters from .rfx file
+// NOTE: File extension is not checked, it can be called from worker threads
+WaveParams LoadWaveParamsRFX(const char *fileName)
+{
+    WaveParams params = { 0 };
+
+    FILE *rfxFile = fopen(fileName, "rb");
+
+    if (rfxFile != NULL)
+    {
+        // NOTE: One byte over .rfx file size is read to detect unexpected trailing data
+        unsigned char fileData[RFX_FILE_SIZE + 1] = { 0 };
+        unsigned int dataSize = (unsigned int)fread(fileData, 1, RFX_FILE_SIZE + 1, rfxFile);
+
+        fclose(rfxFile);
+
+        if (dataSize == 0) RFXGEN_LOG("[%s] rFX file could not be read\n", fileName);
+        else params = LoadWaveParamsFromMemory(fileData, dataSize);
+    }
+
+    return params;
+}
+
+// Load wave parameters from .rfx file data
+// NOTE: Data is validated (size, signature, version, parameters length, wave type and finite values),
+// values are read as little-endian, empty parameters (all zero) are returned if data is not valid
+WaveParams LoadWaveParamsFromMemory(const unsigned char *fileData, unsigned int dataSize)
+{
+    #define READ_U16_LE(data) (unsigned short)((data)[0] | ((data)[1] << 8))
+    #define READ_U32_LE(data) ((unsigned int)(data)[0] | ((unsigned int)(data)[1] << 8) | ((unsigned int)(data)[2] << 16) | ((unsigned int)(data)[3] << 24))
+
+    WaveParams params = { 0 };
+
+    if ((fileData == NULL) || (dataSize < RFX_FILE_SIZE))
+    {
+        RFXGEN_LOG("rFX file data size not valid (%u bytes)\n", dataSize);
+        return params;
+    }
+
+    // Check for valid .rfx file (FormatCC)
+    if ((fileData[0] != 'r') || (fileData[1] != 'F') || (fileData[2] != 'X') || (fileData[3] != ' '))
+    {
+        RFXGEN_LOG("rFX file does not seem to be valid\n");
+        return params;
+    }
+
+    unsigned short version = READ_U16_LE(fileData + 4);
+    unsigned short length = READ_U16_LE(fileData + 6);
+
+    if (version != 200) RFXGEN_LOG("rFX file version not supported (%i)\n", version);
+    else if ((length != RFX_PARAMS_SIZE) || (dataSize != RFX_FILE_SIZE)) RFXGEN_LOG("Wrong rFX wave parameters size (%i)\n", length);
+    else
+    {
+        // Load wave generation parameters: 2 integer values and float values
+        // NOTE: Values are decoded to a temporal parameters struct, only returned if valid
+        WaveParams loaded = { 0 };
+        unsigned int values[RFX_PARAMS_SIZE/4] = { 0 };
+
+        for (int i = 0; i < RFX_PARAMS_SIZE/4; i++) values[i] = READ_U32_LE(fileData + 8 + i*4);
+
+        loaded.randSeed = (int)values[0];
+        loaded.waveTypeValue = (int)values[1];
+        memcpy(&loaded.attackTimeValue, &values[2], RFX_PARAMS_SIZE - 8);
+
+        bool valid = ((loaded.waveTypeValue >= 0) && (loaded.waveTypeValue <= 3));
+
+        const float *floatValues = &loaded.attackTimeValue;
+        for (int i = 0; (i < (RFX_PARAMS_SIZE - 8)/4) && valid; i++) if (!isfinite(floatValues[i])) valid = false;
+
+        if (valid) params = loaded;
+        else RFXGEN_LOG("rFX wave parameters not valid: wave type or non-finite values\n");
+    }
+
+    return params;
+}
+
+// Save .rfx sound parameters file
+void SaveWaveParams(WaveParams params, const char *fileName)
+{
+    if (IsFileExtension(fileName, ".rfx"))
+    {
+        // Fx Sound File Structure (.rfx)
+        // ------------------------------------------------------
+        // Offset | Size  | Type       | Description
+        // ------------------------------------------------------
+        // 0      | 4     | char       | Signature: "rFX "
+        // 4      | 2     | short      | Version: 200
+        // 6      | 2     | short      | Data length: 96 bytes
+        // 8      | 96    | WaveParams | Wave parameters
+        // ------------------------------------------------------
+
+        FILE *rfxFile = fopen(fileName, "wb");
+
+        if (rfxFile != NULL)
+        {
+            unsigned char signature[5] = "rFX ";
+            unsigned short version = 200;
+            unsigned short length = sizeof(WaveParams);
+
+            // Write .rfx file header
+            fwrite(signature, 4, sizeof(unsigned char), rfxFile);
+            fwrite(&version, 1, sizeof(unsigned short), rfxFile);
+            fwrite(&length, 1, sizeof(unsigned short), rfxFile);
+
+            // Write wave generation parameters
+            fwrite(&params, 1, sizeof(WaveParams), rfxFile);
+
+            fclose(rfxFile);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Sound generation functions
+//----------------------------------------------------------------------------------
+
+// Generate sound: Pickup/Coin
+WaveParams GenPickupCoin(void)
+{
+    WaveParams params = { 0 };
+    ResetWaveParams(&params);
+
+    params.startFrequencyValue = 0.4f + frnd(0.5f);
+    params.attackTimeValue = 0.0f;
+    params.sustainTimeValue = frnd(0.1f);
+    params.decayTimeValue = 0.1f + frnd(0.4f);
+    params.sustainPunchValue = 0.3f + frnd(0.3f);
+
+    if (GetRandomValue(0, 1))
+    {
+        params.changeSpeedValue = 0.5f + frnd(0.2f);
+        params.changeAmountValue = 0.2f + frnd(0.4f);
+    }
+
+    return params;
+}
+
+// Generate sound: Laser shoot
+WaveParams GenLaserShoot(void)
+{
+    WaveParams params = { 0 };
+    ResetWaveParams(&params);
+
+    params.waveTypeValue = GetRandomValue(0, 2);
+
+    if ((params.waveTypeValue == 2) && GetRandomValue(0, 1)) params.waveTypeValue = GetRandomValue(0, 1);
+
+    params.startFrequencyValue = 0.5f + frnd(0.5f);
+    params.minFrequencyValue = params.startFrequencyValue - 0.2f - frnd(0.6f);
+
+    if (params.minFrequencyValue < 0.2f) params.minFrequencyValue = 0.2f;
+
+    params.slideValue = -0.15f - frnd(0.2f);
+
+    if (GetRandomValue(0, 2) == 0)
+    {
+        params.startFrequencyValue = 0.3f + frnd(0.6f);
+        params.minFrequencyValue = frnd(0.1f);
+        params.slideValue = -0.35f - frnd(0.3f);
+    }
+
+    if (GetRandomValue(0, 1))
+    {
+        params.squareDutyValue = frnd(0.5f);
+        params.dutySweepValue = frnd(0.2f);
+    }
+    else
+    {
+        params.squareDutyValue = 0.4f + frnd(0.5f);
+        params.dutySweepValue = -frnd(0.7f);
+    }
+
+    params.attackTimeValue = 0.0f;
+    params.sustainTimeValue = 0.1f + frnd(0.2f);
+    params.decayTimeValue = frnd(0.4f);
+
+    if (GetRandomValue(0, 1)) params.sustainPunchValue = frnd(0.3f);
+
+    if (GetRandomValue(0, 2) == 0)
+    {
+        params.phaserOffsetValue = frnd(0.2f);
+        params.phaserSweepValue = -frnd(0.2f);
+    }
+
+    if (GetRandomValue(0, 1)) params.hpfCutoffValue = frnd(0.3f);
+
+    return params;
+}
+
+// Generate sound: Explosion
+WaveParams GenExplosion(void)
+{
+    WaveParams params = { 0 };
+    ResetWaveParams(&params);
+
+    params.waveTypeValue = 3;
+
+    if (GetRandomValue(0, 1))
+    {
+        params.startFrequencyValue = 0.1f + frnd(0.4f);
+        params.slideValue = -0.1f + frnd(0.4f);
+    }
+    else
+    {
+        params.startFrequencyValue = 0.2f + frnd(0.7f);
+        params.slideValue = -0.2f - frnd(0.2f);
+    }
+
+    params.startFrequencyValue *= params.startFrequencyValue;
+
+    if (GetRandomValue(0, 4) == 0) params.slideValue = 0.0f;
+    if (GetRandomValue(0, 2) == 0) params.repeatSpeedValue = 0.3f + frnd(0.5f);
+
+    params.attackTimeValue = 0.0f;
+    params.sustainTimeValue = 0.1f + frnd(0.3f);
+    params.decayTimeValue = frnd(0.5f);
+
+    if (GetRandomValue(0, 1) == 0)
+    {
+        params.phaserOffsetValue = -0.3f + frnd(0.9f);
+        params.phaserSweepValue = -frnd(0.3f);
+    }
+
+    params.sustainPunchValue = 0.2f + frnd(0.6f);
+
+    if (GetRandomValue(0, 1))
+    {
+        params.vibratoDepthValue = frnd(0.7f);
+        params.vibratoSpeedValue = frnd(0.6f);
+    }
+
+    if (GetRandomValue(0, 2) == 0)
+    {
+        params.changeSpeedValue = 0.6f + frnd(0.3f);
+        params.changeAmountValue = 0.8f - frnd(1.6f);
+    }
+
+    return params;
+}
+
+// Generate sound: Powerup
+WaveParams GenPowerup(void)
+{
+    WaveParams params = { 0 };
+    ResetWaveParams(&params);
+
+    if (GetRandomValue(0, 1)) params.waveTypeValue = 1;
+    else params.squareDutyValue = frnd(0.6f);
+
+    if (GetRandomValue(0, 1))
+    {
+        params.startFrequencyValue = 0.2f + frnd(0.3f);
+        params.slideValue = 0.1f + frnd(0.4f);
+        params.repeatSpeedValue = 0.4f + frnd(0.4f);
+    }
+    else
+    {
+        params.startFrequencyValue = 0.2f + frnd(0.3f);
+        params.slideValue = 0.05f + frnd(0.2f);
+
+        if (GetRandomValue(0, 1))
+        {
+            params.vibratoDepthValue = frnd(0.7f);
+            params.vibratoSpeedValue = frnd(0.6f);
+        }
+    }
+
+    params.attackTimeValue = 0.0f;
+    params.sustainTimeValue = frnd(0.4f);
+    params.decayTimeValue = 0.1f + frnd(0.4f);
+
+    return params;
+}
+
+// Generate sound: Hit/Hurt
+WaveParams GenHitHurt(void)
+{
+    WaveParams params = { 0 };
+    ResetWaveParams(&params);
+
+    params.waveTypeValue = GetRandomValue(0, 2);
+    if (params.waveTypeValue == 2) params.waveTypeValue = 3;
+    if (params.waveTypeValue == 0) params.squareDutyValue = frnd(0.6f);
+
+    params.startFrequencyValue = 0.2f + frnd(0.6f);
+    params.slideValue = -0.3f - frnd(0.4f);
+    params.attackTimeValue = 0.0f;
+    params.sustainTimeValue = frnd(0.1f);
+    params.decayTimeValue = 0.1f + frnd(0.2f);
+
+    if (GetRandomValue(0, 1)) params.hpfCutoffValue = frnd(0.3f);
+
+    return params;
+}
+
+// Generate sound: Jump
+WaveParams GenJump(void)
+{
+    WaveParams params = { 0 };
+    ResetWaveParams(&params);
+
+    params.waveTypeValue = 0;
+    params.squareDutyValue = frnd(0.6f);
+    params.startFrequencyValue = 0.3f + frnd(0.3f);
+    params.slideValue = 0.1f + frnd(0.2f);
+    params.attackTimeValue = 0.0f;
+    params.sustainTimeValue = 0.1f + frnd(0.3f);
+    params.decayTimeValue = 0.1f + frnd(0.2f);
+
+    if (GetRandomValue(0, 1)) params.hpfCutoffValue = frnd(0.3f);
+    if (GetRandomValue(0, 1)) params.lpfCutoffValue = 1.0f - frnd(0.6f);
+
+    return params;
+}
+
+// Generate sound: Blip/Select
+WaveParams GenBlipSelect(void)
+{
+    WaveParams params = { 0 };
+    ResetWaveParams(&params);
+
+    params.waveTypeValue = GetRandomValue(0, 1);
+    if (params.waveTypeValue == 0) params.squareDutyValue = frnd(0.6f);
+    params.startFrequencyValue = 0.2f + frnd(0.4f);
+    params.attackTimeValue = 0.0f;
+    params.sustainTimeValue = 0.1f + frnd(0.1f);
+    params.decayTimeValue = frnd(0.2f);
+    params.hpfCutoffValue = 0.1f;
+
+    return params;
+}
+
+// Generate random sound
+WaveParams GenRandomize(void)
+{
+    WaveParams params = { 0 };
+    ResetWaveParams(&params);
+
+    params.randSeed = GetRandomValue(0, 0xFFFE);
+
+    params.startFrequencyValue = powf(frnd(2.0f) - 1.0f, 2.0f);
+
+    if (GetRandomValue(0, 1)) params.startFrequencyValue = powf(frnd(2.0f) - 1.0f, 3.0f)+0.5f;
+
+    params.minFrequencyValue = 0.0f;
+    params.slideValue = powf(frnd(2.0f) - 1.0f, 5.0f);
+
+    if ((params.startFrequencyValue > 0.7f) && (params.slideValue > 0.2f)) params.slideValue = -params.slideValue;
+    if ((params.startFrequencyValue < 0.2f) && (params.slideValue < -0.05f)) params.slideValue = -params.slideValue;
+
+    params.deltaSlideValue = powf(frnd(2.0f) - 1.0f, 3.0f);
+    params.squareDutyValue = frnd(2.0f) - 1.0f;
+    params.dutySweepValue = powf(frnd(2.0f) - 1.0f, 3.0f);
+    params.vibratoDepthValue = powf(frnd(2.0f) - 1.0f, 3.0f);
+    params.vibratoSpeedValue = frnd(2.0f) - 1.0f;
+    //params.vibratoPhaseDelay = frnd(2.0f) - 1.0f;
+    params.attackTimeValue = powf(frnd(2.0f) - 1.0f, 3.0f);
+    params.sustainTimeValue = powf(frnd(2.0f) - 1.0f, 2.0f);
+    params.decayTimeValue = frnd(2.0f)-1.0f;
+    params.sustainPunchValue = powf(frnd(0.8f), 2.0f);
+
+    if (params.attackTimeValue + params.sustainTimeValue + params.decayTimeValue < 0.2f)
+    {
+        params.sustainTimeValue += 0.2f + frnd(0.3f);
+        params.decayTimeValue += 0.2f + frnd(0.3f);
+    }
+
+    params.lpfResonanceValue = frnd(2.0f) - 1.0f;
+    params.lpfCutoffValue = 1.0f - powf(frnd(1.0f), 3.0f);
+    params.lpfCutoffSweepValue = powf(frnd(2.0f) - 1.0f, 3.0f);
+
+    if (params.lpfCutoffValue < 0.1f && params.lpfCutoffSweepValue < -0.05f) params.lpfCutoffSweepValue = -params.lpfCutoffSweepValue;
+
+    params.hpfCutoffValue = powf(frnd(1.0f), 5.0f);
+    params.hpfCutoffSweepValue = powf(frnd(2.0f) - 1.0f, 5.0f);
+    params.phaserOffsetValue = powf(frnd(2.0f) - 1.0f, 3.0f);
+    params.phaserSweepValue = powf(frnd(2.0f) - 1.0f, 3.0f);
+    params.repeatSpeedValue = frnd(2.0f) - 1.0f;
+    params.changeSpeedValue = frnd(2.0f) - 1.0f;
+    params.changeAmountValue = frnd(2.0f) - 1.0f;
+
+    return params;
+}
+
+// Mutate current sound
+void WaveMutate(WaveParams *params)
+{
+    srand(time(NULL));      // Refresh seed to avoid converging behaviour
+    
+    if (GetRandomValue(0, 1)) params->startFrequencyValue += frnd(0.1f) - 0.05f;        
+    //if (GetRandomValue(0, 1)) params.minFrequencyValue += frnd(0.1f) - 0.05f;
+    if (GetRandomValue(0, 1)) params->slideValue += frnd(0.1f) - 0.05f;
+    if (GetRandomValue(0, 1)) params->deltaSlideValue += frnd(0.1f) - 0.05f;
+    if (GetRandomValue(0, 1)) params->squareDutyValue += frnd(0.1f) - 0.05f;
+    if (GetRandomValue(0, 1)) params->dutySweepValue += frnd(0.1f) - 0.05f;
+    if (GetRandomValue(0, 1)) params->vibratoDepthValue += frnd(0.1f) - 0.05f;
+    if (GetRandomValue(0, 1)) params->vibratoSpeedValue += frnd(0.1f) - 0.05f;
+    //if (GetRandomValue(0, 1)) params.vibratoPhaseDelay += frnd(0.1f) - 0.05f;
+    if (GetRandomValue(0, 1)) params->attackTimeValue += frnd(0.1f) - 0.05f;
+    if (GetRandomValue(0, 1)) params->sustainTimeValue += frnd(0.1f) - 0.05f;
+    if (GetRandomValue(0, 1)) params->decayTimeValue += frnd(0.1f) - 0.05f;
+    if (GetRandomValue(0, 1)) params->sustainPunchValue += frnd(0.1f) - 0.05f;
+    if (GetRandomValue(0, 1)) params->lpfResonanceValue += frnd(0.1f) - 0.05f;
+    if (GetRandomValue(0, 1)) params->lpfCutoffValue += frnd(0.1f) - 0.05f;
+    if (GetRandomValue(0, 1)) params->lpfCutoffSweepValue += frnd(0.1f) - 0.05f;
+    if (GetRandomValue(0, 1)) params->hpfCutoffValue += frnd(0.1f) - 0.05f;
+    if (GetRandomValue(0, 1)) params->hpfCutoffSweepValue += frnd(0.1f) - 0.05f;
+    if (GetRandomValue(0, 1)) params->phaserOffsetValue += frnd(0.1f) - 0.05f;
+    if (GetRandomValue(0, 1)) params->phaserSweepValue += frnd(0.1f) - 0.05f;
+    if (GetRandomValue(0, 1)) params->repeatSpeedValue += frnd(0.1f) - 0.05f;
+    if (GetRandomValue(0, 1)) params->changeSpeedValue += frnd(0.1f) - 0.05f;
+    if (GetRandomValue(0, 1)) params->changeAmountValue += frnd(0.1f) - 0.05f;
+}
+
+// Set wave generation profile, NULL to stop recording
+// NOTE: Only recorded if RFXGEN_SUPPORT_PROFILING is defined
+void SetGenerationProfile(GenerationProfile *profile)
+{
+    generationProfile = profile;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Sanitize wave parameters for generation: wave type and values range
+// NOTE: Values out of [-1..1] are valid (WaveMutate() generates them) and kept, only values overflowing
+// generation integer values are limited to MAX_WAVE_PARAMS_VALUE (also Inf), NaN is set to 0.0f
+static WaveParams SanitizeWaveParams(WaveParams params)
+{
+    if ((params.waveTypeValue < 0) || (params.waveTypeValue > 3)) params.waveTypeValue = 0;
+
+    // NOTE: All parameters after waveTypeValue are float values
+    float *values = &params.attackTimeValue;
+    int valueCount = (int)(sizeof(WaveParams) - ((char *)values - (char *)&params))/sizeof(float);
+
+    for (int i = 0; i < valueCount; i++)
+    {
+        if (isnan(values[i])) values[i] = 0.0f;
+        else if (values[i] > MAX_WAVE_PARAMS_VALUE) values[i] = MAX_WAVE_PARAMS_VALUE;
+        else if (values[i] < -MAX_WAVE_PARAMS_VALUE) values[i] = -MAX_WAVE_PARAMS_VALUE;
+    }
+
+    return params;
+}
+
+// Get generation value derived from wave parameter value, parameter selected by offset in WaveParams
+// NOTE: Values must be computed as InitWaveGenerator()/GenerateWaveFrames() do, keep them in sync:
+// parameter values with the same derived value generate the same wave, parameters must be sanitized
+static double GetWaveParamsValueKey(WaveParams params, size_t offset)
+{
+    double key = 0.0;
+
+    switch (offset)
+    {
+        // Envelope stages length (samples)
+        case offsetof(WaveParams, attackTimeValue): key = (int)(params.attackTimeValue*params.attackTimeValue*100000.0f); break;
+        case offsetof(WaveParams, sustainTimeValue): key = (int)(params.sustainTimeValue*params.sustainTimeValue*100000.0f); break;
+        case offsetof(WaveParams, decayTimeValue): key = (int)(params.decayTimeValue*params.decayTimeValue*100000.0f); break;
+
+        // Vibrato phase increment
+        case offsetof(WaveParams, vibratoSpeedValue): key = powf(params.vibratoSpeedValue, 2.0f)*0.01f; break;
+
+        // Arpeggio and repeat limits (samples), 0 disables them
+        case offsetof(WaveParams, changeSpeedValue): key = (params.changeSpeedValue == 1.0f)? 0 : (int)(powf(1.0f - params.changeSpeedValue, 2.0f)*20000 + 32); break;
+        case offsetof(WaveParams, repeatSpeedValue): key = (params.repeatSpeedValue == 0.0f)? 0 : (int)(powf(1.0f - params.repeatSpeedValue, 2.0f)*20000 + 32); break;
+
+        // Square duty sweep, duty is clamped to [0..0.5] after every sweep step (also after repeat)
+        case offsetof(WaveParams, dutySweepValue): key = -params.dutySweepValue*0.00005f; break;
+        case offsetof(WaveParams, squareDutyValue):
+        {
+            float squareDuty = 0.5f - params.squareDutyValue*0.5f;
+            squareDuty += -params.dutySweepValue*0.00005f;
+
+            if (squareDuty < 0.0f) squareDuty = 0.0f;
+            if (squareDuty > 0.5f) squareDuty = 0.5f;
+
+            key = squareDuty;
+        } break;
+
+        // Phaser offset and sweep, sign kept
+        case offsetof(WaveParams, phaserOffsetValue): key = ((params.phaserOffsetValue < 0.0f)? -1.0f : 1.0f)*powf(params.phaserOffsetValue, 2.0f)*1020.0f; break;
+        case offsetof(WaveParams, phaserSweepValue): key = ((params.phaserSweepValue < 0.0f)? -1.0f : 1.0f)*powf(params.phaserSweepValue, 2.0f)*1.0f; break;
+
+        // Low-pass filter, bypassed with cutoff 1.0f (out of cutoff values range: 2.0)
+        case offsetof(WaveParams, lpfCutoffValue): key = (params.lpfCutoffValue == 1.0f)? 2.0 : powf(params.lpfCutoffValue, 3.0f)*0.1f; break;
+        case offsetof(WaveParams, lpfCutoffSweepValue): key = 1.0f + params.lpfCutoffSweepValue*0.0001f; break;
+        case offsetof(WaveParams, lpfResonanceValue):
+        {
+            float fltw = powf(params.lpfCutoffValue, 3.0f)*0.1f;
+            float fltdmp = 5.0f/(1.0f + powf(params.lpfResonanceValue, 2.0f)*20.0f)*(0.01f + fltw);
+            if (fltdmp > 0.8f) fltdmp = 0.8f;
+
+            key = fltdmp;
+        } break;
+
+        // High-pass filter, cutoff is clamped to [0.00001..0.1] after every sweep step (before first sample)
+        case offsetof(WaveParams, hpfCutoffSweepValue): key = 1.0f + params.hpfCutoffSweepValue*0.0003f; break;
+        case offsetof(WaveParams, hpfCutoffValue):
+        {
+            float flthp = powf(params.hpfCutoffValue, 2.0f)*0.1f;
+            flthp *= 1.0f + params.hpfCutoffSweepValue*0.0003f;
+
+            if (flthp < 0.00001f) flthp = 0.00001f;
+            if (flthp > 0.1f) flthp = 0.1f;
+
+            key = flthp;
+        } break;
+        default: break;
+    }
+
+    return key;
+}
+
+// Quantize wave parameter value: value closest to zero with the same derived value
+// NOTE: Value magnitude is searched on float bits (positive floats are ordered as integers),
+// derived values are monotonic on magnitude, value found always has the same derived value
+static void QuantizeWaveParamsValue(WaveParams *params, size_t offset)
+{
+    float *value = (float *)((char *)params + offset);
+    float original = *value;
+    double key = GetWaveParamsValueKey(*params, offset);
+
+    // Zero is preferred, positive value preferred to negative value
+    *value = 0.0f;
+    if (GetWaveParamsValueKey(*params, offset) == key) return;
+
+    float sign = 1.0f;
+    float magnitude = fabsf(original);
+
+    if (original < 0.0f)
+    {
+        *value = magnitude;
+        if (GetWaveParamsValueKey(*params, offset) != key) sign = -1.0f;
+    }
+
+    // Smallest magnitude with same derived value, original magnitude has it
+    unsigned int low = 1;
+    unsigned int high = 0;
+    memcpy(&high, &magnitude, sizeof(float));
+
+    while (low < high)
+    {
+        unsigned int middle = low + (high - low)/2;
+        float middleValue = 0.0f;
+        memcpy(&middleValue, &middle, sizeof(float));
+
+        *value = sign*middleValue;
+
+        if (GetWaveParamsValueKey(*params, offset) == key) high = middle;
+        else low = middle + 1;
+    }
+
+    memcpy(&magnitude, &high, sizeof(float));
+    *value = sign*magnitude;
+
+    // NOTE: Derived values not monotonic on magnitude would stop search on other value, original value kept
+    if (GetWaveParamsValueKey(*params, offset) != key) *value = original;
+}
+
+// Init random numbers generator state with seed
+// NOTE: Same sequence than glibc srand()/rand(), seed 0 is considered as seed 1
+static RandomState InitRandomState(unsigned int seed)
+{
+    RandomState state = { 0 };
+
+    state.table[0] = (seed == 0)? 1 : seed;
+
+    for (int i = 1; i < 31; i++)
+    {
+        // Park-Miller minimal standard generator: (16807*prev)%2147483647, avoiding overflow
+        int prev = (int)state.table[i - 1];
+        int word = 16807*(prev%127773) - 2836*(prev/127773);
+        if (word < 0) word += 2147483647;
+
+        state.table[i] = (unsigned int)word;
+    }
+
+    state.front = 3;
+    state.rear = 0;
+
+    for (int i = 0; i < 310; i++) GetNextRandom(&state);   // Discard initial values
+
+    return state;
+}
+
+// Get next random number [0..RAND_MAX]
+static int GetNextRandom(RandomState *state)
+{
+    state->table[state->front] += state->table[state->rear];
+    int result = (int)(state->table[state->front] >> 1);
+
+    state->front = (state->front + 1)%31;
+    state->rear = (state->rear + 1)%31;
+
+    return result;
+}
+
+#if defined(RFXGEN_SUPPORT_PROFILING)
+// Get generation profile ticks: CPU timestamp counter if available, nanoseconds otherwise
+static unsigned long long GetGenerationTicks(void)
+{
+#if defined(RFXGEN_TICKS_RDTSC)
+    return (unsigned long long)__rdtsc();
+#elif defined(_WIN32)
+    long long counter = 0;
+    QueryPerformanceCounter(&counter);
+
+    return (unsigned long long)counter;
+#elif defined(__EMSCRIPTEN__)
+    return (unsigned long long)(emscripten_get_now()*1e6);
+#else
+    struct timespec now = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (unsigned long long)now.tv_sec*1000000000ULL + (unsigned long long)now.tv_nsec;
+#endif
+}
+#endif
+
+#endif // RFXGEN_IMPLEMENTATION
@@ -0,0 +1,2491 @@
+/*******************************************************************************************
+*
+*   rFXGen bench - Sound generation microbenchmarks
+*
+*   Measures GenerateWave() over a fixed corpus: every Gen*() preset at fixed seeds,
+*   every wave type, filters on/off and long repeat sounds. It also measures WaveFormat()
+*   conversions and LoadWaveParams()/SaveWaveParams() files processing
+*
+*   Generated waves can be verified against reference fixtures (.rfx files, golden frames count and checksums),
+*   cases cover the benchmarks corpus plus every wave parameter on every wave type
+*
+*   Stress mode checks GenerateWave() invariants over randomized wave parameters on all processors:
+*   presets, GenRandomize(), WaveMutate() outputs and out-of-range/non-finite values
+*
+*   End-to-end throughput is measured running rfxgen command line conversion over a synthetic
+*   corpus of .rfx files: process startup to files written, files/s, MB/s, peak RSS and stages time
+*
+*   Process startup time is measured launching rfxgen with no conversion work (--help) many times,
+*   to compare GUI and command line only builds (rfxgen-cli) as invoked by build pipelines
+*
+*   GUI idle CPU usage is measured launching rfxgen GUI with no input events (Linux, display required),
+*   to compare events waiting (default) and continuous rendering (CONTINUOUS_RENDERING) builds
+*
+*   Audio files transcoding is measured running rfxgen command line conversion of a large synthetic
+*   .wav file to several formats: time, MB/s and peak RSS (expected to not depend on input size);
+*   streamed conversion output is checked first against LoadWave() + WaveFormat() on a short input,
+*   and .rfx output written to stdout against file output (several sample rates and sample sizes)
+*
+*   Corpus deduplication is measured over a directory of .rfx files: unique parameters and unique
+*   canonical parameters (CanonicalizeWaveParams()), the renders required by a generated waves cache
+*
+*   Serve mode is measured launching rfxgen --serve and sending pipelined render requests on its
+*   UNIX domain socket: requests/s, latency percentiles and server stats, responses are verified
+*
+*   USAGE:
+*       > rfxgen_bench [--filter <text>] [--min-time <seconds>] [--json <filename.json>]
+*       > rfxgen_bench --corpus <directory> [--count <files>] [--seed <value>]
+*       > rfxgen_bench --e2e <directory> [--rfxgen <path>] [--output-dir <directory>]
+*                      [--chunk <files>] [--jobs <count>] [--json <filename.json>]
+*       > rfxgen_bench --startup <runs> [--rfxgen <path>]
+*       > rfxgen_bench --idle <seconds> [--rfxgen <path>]
+*       > rfxgen_bench --transcode <size_mb> [--rfxgen <path>] [--output-dir <directory>]
+*       > rfxgen_bench --serve <requests> [--rfxgen <path>] [--jobs <count>]
+*       > rfxgen_bench --save-fixtures <directory>
+*       > rfxgen_bench --save-reference <filename.rfxref> [--fixtures <directory>]
+*       > rfxgen_bench --verify <directory> [--samples <filename.rfxref>] [--tolerance <value>]
+*       > rfxgen_bench --stress <count> [--seed <value>] [--jobs <count>] [--max-sound-time <seconds>]
+*       > rfxgen_bench --dedupe <directory>
+*
+*   NOTE 1: Allocations are counted through RL_MALLOC()/RL_CALLOC()/RL_REALLOC() hooks,
+*   only rfxgen.h allocations are counted, raylib internal allocations (WaveFormat()) are not
+*
+*   NOTE 2: Corpus is reproducible, every file is generated from its own seed: seed*100003 + index,
+*   sounds distribution is weighted to short gameplay/UI sounds with some long sounds tail
+*
+*   NOTE 3: Reference fixtures are committed (reference directory: .rfx files, golden frames count and
+*   checksums) and verified with make bench-verify, make bench-fixtures regenerates them when generated waves
+*   are expected to change; waves identical to golden renders pass, others are compared with local reference
+*   renders samples if saved before a change (make bench-reference): max sample error under tolerance passes,
+*   failing cases show first diverging sample and max error, process returns 1 on failure
+*
+*   NOTE 4: Stress invariants: wave not empty, frames count under max length, samples finite and
+*   within [-1..1], same wave for same parameters (determinism) and for canonical parameters (one in 4
+*   iterations, canonicalization idempotent and same parameters hash), generation CPU time per sound (worker
+*   thread time) is reported and only checked with --max-sound-time, failing parameters are saved as
+*   rfxgen_stress_<iteration>.rfx, process returns 1 on failure
+*
+*   NOTE 5: End-to-end benchmark launches one rfxgen process per chunk of files (default: 1000),
+*   it is only available on POSIX systems (fork/exec), peak RSS is the largest process RSS
+*
+*   NOTE 6: Startup time is process launch to exit (fork/exec/wait), output discarded, POSIX systems only
+*
+*   NOTE 7: Transcoding input is 44100 Hz, 16 bit, stereo (written by blocks), peak RSS is measured
+*   per rfxgen process (wait4), input and output files are removed after measurement, POSIX systems only
+*
+*   NOTE 8: Serve requests are corpus sounds rendered as raw 44100 Hz, 16 bit, mono (compared to local
+*   renders), SERVE_PIPELINE_DEPTH requests in flight on one connection, latency is request sent to
+*   response received, server is stopped with SIGTERM (socket file removed), POSIX systems only
+*
+*   DEPENDENCIES:
+*       raylib 4.2              - Wave type and audio data conversion (no window required)
+*
+*   COMPILATION:
+*       make bench
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2022 raylib technologies (@raylibtech) / Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#include <stdlib.h>                     // Required for: malloc(), calloc(), realloc(), free()
+#include <stdio.h>                      // Required for: printf(), FILE, fopen(), fprintf(), fclose(), remove()
+#include <string.h>                     // Required for: strcmp(), strstr(), strncpy(), memcmp()
+#include <stddef.h>                     // Required for: offsetof()
+#include <math.h>                       // Required for: fabsf(), isfinite(), NAN, INFINITY
+#include <float.h>                      // Required for: FLT_MAX
+#include <time.h>                       // Required for: clock_gettime()
+
+#if defined(_WIN32)
+    #include <direct.h>                 // Required for: _mkdir()
+#else
+    #include <unistd.h>                 // Required for: fork(), execv(), pipe(), dup2(), close()
+    #include <sys/wait.h>               // Required for: waitpid(), wait4()
+    #include <sys/resource.h>           // Required for: getrusage()
+    #include <sys/stat.h>               // Required for: mkdir(), stat()
+    #include <fcntl.h>                  // Required for: open()
+    #include <signal.h>                 // Required for: kill(), SIGTERM
+    #include <sys/socket.h>             // Required for: socket(), connect(), send(), recv()
+    #include <sys/un.h>                 // Required for: struct sockaddr_un
+#endif
+
+// Memory allocators hooks, used to count rfxgen.h allocations
+// NOTE: Must be defined before including raylib.h, not static: rfxgen.h could not use all of them
+void *BenchMalloc(size_t size);
+void *BenchCalloc(size_t count, size_t size);
+void *BenchRealloc(void *ptr, size_t size);
+
+#define RL_MALLOC(size)             BenchMalloc(size)
+#define RL_CALLOC(count, size)      BenchCalloc(count, size)
+#define RL_REALLOC(ptr, size)       BenchRealloc(ptr, size)
+#define RL_FREE(ptr)                free(ptr)
+
+#include "raylib.h"
+
+#define RFXGEN_IMPLEMENTATION
+#include "rfxgen.h"                     // Sound effects generation: wave parameters, presets and wave generation
+
+#define WORKER_POOL_IMPLEMENTATION
+#include "worker_pool.h"                // Worker threads pool, used on stress mode
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#if defined(_WIN32)
+int __stdcall QueryPerformanceCounter(long long *count);            // High resolution counter (kernel32.lib)
+int __stdcall QueryPerformanceFrequency(long long *frequency);      // High resolution counter frequency (kernel32.lib)
+void *__stdcall GetCurrentThread(void);                             // Current thread pseudo handle (kernel32.lib)
+int __stdcall GetThreadTimes(void *thread, unsigned long long *creation, unsigned long long *exit, unsigned long long *kernel, unsigned long long *user);  // Thread times, 100 ns units (kernel32.lib)
+#endif
+
+#define BENCH_MAX_CASES            64       // Max generation corpus cases
+#define BENCH_MAX_RESULTS         128       // Max benchmark results
+#define BENCH_MIN_ITERATIONS        3       // Min iterations measured per benchmark
+#define BENCH_DEFAULT_MIN_TIME   0.25       // Default min time measured per benchmark (seconds)
+#define BENCH_PARAMS_FILE   "rfxgen_bench.rfx"  // Temporal file used on wave parameters files benchmarks
+
+#define CORPUS_DEFAULT_COUNT     1000       // Default corpus files count
+#define CORPUS_LENGTH_BUCKETS       5       // Corpus sounds length histogram buckets
+#define E2E_DEFAULT_CHUNK        1000       // Default files per rfxgen process on end-to-end benchmark
+#define E2E_STAGE_COUNT             5       // Conversion stages reported by rfxgen: load, generate, format, encode, write
+#define STARTUP_WARMUP_RUNS         3       // Startup runs not measured, executable and libraries loaded into page cache
+#define IDLE_SETTLE_TIME          3.0       // Idle benchmark time not measured after launch: window creation and first frames (seconds)
+#define TRANSCODE_DEFAULT_PATH  "rfxgen_transcode"  // Default transcoding benchmark files directory
+#define TRANSCODE_CHECK_FRAMES      441000  // Transcoding check input frames (10 seconds), full wave converted in memory
+#define TRANSCODE_BLOCK_FRAMES  65536       // Transcoding input frames written per block
+#define SERVE_SOCKET_PATH  "rfxgen_bench.sock"  // Serve benchmark socket file
+#define SERVE_PIPELINE_DEPTH       16       // Serve benchmark requests in flight (sent, response not received)
+#define SERVE_STARTUP_TIMEOUT     5.0       // Serve benchmark max wait for server socket (seconds)
+
+#define REFERENCE_MAX_CASES       256       // Max verification cases
+#define REFERENCE_DEFAULT_PATH  "reference"     // Default reference fixtures directory (.rfx files and golden renders)
+#define REFERENCE_GOLDEN_FILE   "golden.txt"    // Reference golden renders file: fixtures frames count and checksum
+#define REFERENCE_FILE_VERSION      1       // Reference renders file version
+#define REFERENCE_DEFAULT_TOLERANCE  (1.0f/32768.0f)    // Default max sample error: 16 bit quantization step
+
+#define STRESS_BATCH_SIZE        1024       // Stress sounds generated per batch, parameters are drawn on main thread
+#define STRESS_MAX_REPORTS         16       // Max stress failures reported (and parameters saved)
+#define STRESS_DEFAULT_MAX_TIME   0.0       // Default max generation CPU time per sound (seconds), 0: not checked
+#define STRESS_MAX_FRAMES   (10*44100)      // Max wave frames: 10 seconds at 44100 Hz
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Benchmark case type, wave parameters from corpus
+typedef struct BenchCase {
+    char name[64];              // Case name
+    WaveParams params;          // Wave parameters
+} BenchCase;
+
+// Benchmark result type
+typedef struct BenchResult {
+    char name[64];              // Benchmark name: <group>/<case>
+    int iterations;             // Measured iterations
+    double totalTime;           // Total time measured (seconds)
+    double minTime;             // Min time measured per iteration (seconds)
+    long long samples;          // Samples processed per iteration (0 if not applicable)
+    long long allocCount;       // Allocations on all iterations
+    long long allocBytes;       // Bytes allocated on all iterations
+} BenchResult;
+
+// End-to-end benchmark result type
+typedef struct EndToEndResult {
+    int fileCount;              // Corpus files
+    int convertedCount;         // Files converted, reported by rfxgen processes
+    int processCount;           // rfxgen processes launched
+    double wallTime;            // Processes startup to files written (seconds)
+    double conversionTime;      // Conversion time reported by processes, excludes startup/shutdown (seconds)
+    double stageTime[E2E_STAGE_COUNT];  // Stages time summed over worker threads (seconds)
+    long long bytesWritten;     // Output files size
+    long long peakRSS;          // Largest process resident set size (KB)
+} EndToEndResult;
+
+// Reference case type, fixture parameters and golden render
+typedef struct ReferenceCase {
+    char name[64];              // Case name, fixture file name (.rfx)
+    WaveParams params;          // Wave parameters, loaded from fixture
+    unsigned int frameCount;    // Golden render frames count
+    unsigned long long checksum;    // Golden render checksum (FNV-1a 64 bit)
+} ReferenceCase;
+
+// Wave parameter coverage type, parameter value set on verification cases
+// NOTE: Parameters with no effect by themselves also set the parameter they depend on
+typedef struct ParamCoverage {
+    const char *name;           // Parameter name
+    int offset;                 // Parameter offset on WaveParams
+    float value;                // Parameter value
+    int dependencyOffset;       // Dependency parameter offset, -1 if not required
+    float dependencyValue;      // Dependency parameter value
+} ParamCoverage;
+
+// Stress parameters source
+typedef enum {
+    STRESS_SOURCE_PRESET = 0,   // Gen*() presets
+    STRESS_SOURCE_RANDOMIZE,    // GenRandomize()
+    STRESS_SOURCE_MUTATE,       // GenRandomize() and WaveMutate() several times
+    STRESS_SOURCE_RAW,          // Random values out of range, including non-finite values
+    STRESS_SOURCE_COUNT
+} StressSource;
+
+// Stress invariants failures (flags)
+typedef enum {
+    STRESS_FAILURE_EMPTY = 1,           // Wave with no frames or no data
+    STRESS_FAILURE_LENGTH = 2,          // Wave frames count over max length or unexpected format
+    STRESS_FAILURE_NOT_FINITE = 4,      // NaN or Inf samples
+    STRESS_FAILURE_RANGE = 8,           // Samples out of [-1..1]
+    STRESS_FAILURE_DETERMINISM = 16,    // Different wave generated for same parameters
+    STRESS_FAILURE_TIME = 32,           // Generation CPU time over max time per sound (only if max time set)
+    STRESS_FAILURE_CANONICAL = 64       // Different wave generated for canonical parameters, or canonical parameters not stable
+} StressFailure;
+
+// Stress task type, one sound generated and checked on a worker thread
+typedef struct StressTask {
+    WorkerTask task;            // Worker task
+    WaveParams params;          // Wave parameters
+    int iteration;              // Stress iteration
+    int source;                 // Parameters source (StressSource)
+    bool checkDeterminism;      // Generate wave twice and compare
+    bool checkCanonical;        // Generate wave from canonical parameters and compare
+    double maxTime;             // Max generation CPU time (seconds), 0: not checked
+    unsigned int frameCount;    // Wave frames generated (result)
+    double time;                // Generation CPU time, worker thread (result)
+    float maxSample;            // Max absolute sample value, finite samples (result)
+    int failures;               // Invariants failures flags (result)
+    int failureSample;          // First sample failing, -1 if not applicable (result)
+} StressTask;
+
+// Benchmark function, one iteration, returns processed samples
+// NOTE: Function measures its own time, data preparation is not measured
+typedef long long (*BenchFunc)(void *data, double *time);
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static long long allocCount = 0;        // Allocations counter
+static long long allocBytes = 0;        // Allocated bytes counter
+static bool allocTracking = false;      // Allocations counting enabled, only on microbenchmarks (single thread)
+
+static BenchResult results[BENCH_MAX_RESULTS] = { 0 };
+static int resultCount = 0;
+
+static const char *benchFilter = NULL;  // Benchmarks name filter
+static double benchMinTime = BENCH_DEFAULT_MIN_TIME;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static double GetBenchTime(void);                               // Get time in seconds, high resolution monotonic clock
+static double GetBenchThreadTime(void);                         // Get calling thread CPU time in seconds
+static int LoadBenchCorpus(BenchCase *cases, int maxCount);     // Load wave generation corpus, fixed parameters and seeds
+static void RunBench(const char *name, BenchFunc func, void *data);     // Run benchmark until min time, result is registered
+static void PrintBenchResults(void);                            // Print benchmark results table
+static bool SaveBenchResults(const char *fileName);             // Save benchmark results as JSON file
+
+static bool MakeBenchDirectory(const char *dirPath);            // Create directory if not exists
+static float GetWaveParamsLength(WaveParams params);            // Get wave length from envelope (seconds)
+static int GenerateCorpus(const char *dirPath, int count, unsigned int seed);   // Generate synthetic corpus of .rfx files
+static bool RunEndToEnd(const char *corpusPath, const char *rfxgenPath, const char *outPath, int chunkSize, int jobCount, EndToEndResult *result);
+static void PrintEndToEndResult(EndToEndResult result);         // Print end-to-end benchmark result
+static bool SaveEndToEndResult(EndToEndResult result, const char *fileName);    // Save end-to-end benchmark result as JSON file
+static bool RunStartup(const char *rfxgenPath, int runCount);   // Measure rfxgen process startup time, launched with no conversion work
+static bool RunIdle(const char *rfxgenPath, double idleTime);   // Measure rfxgen GUI process CPU usage while idle (no input events)
+static int CompareDouble(const void *a, const void *b);         // Compare double values, used to sort timings
+static bool RunTranscode(const char *rfxgenPath, const char *outPath, int sizeMB);     // Measure rfxgen audio file transcoding, large synthetic input
+static bool SaveTranscodeInput(const char *fileName, unsigned int frameCount);          // Save transcoding synthetic input file (44100 Hz, 16 bit, stereo)
+static bool CheckTranscode(const char *rfxgenPath, const char *outPath);              // Check transcoding output against LoadWave() + WaveFormat()
+static bool CheckStreamOutput(const char *rfxgenPath, const char *outPath);           // Check .rfx output streamed to stdout against file output
+static bool CompareFiles(const char *fileName1, const char *fileName2, long *size);   // Compare files content, size compared returned
+static bool RunServe(const char *rfxgenPath, int requestCount, int jobCount);       // Measure rfxgen serve mode, pipelined requests on one connection
+#if !defined(_WIN32)
+static bool RunRfxgenProcess(const char *rfxgenPath, char **args, const char *outFileName);   // Run rfxgen process, standard output written to file
+static bool GetProcessCpuTime(pid_t pid, double *userTime, double *systemTime);    // Get process CPU time (seconds), Linux only (/proc)
+static bool GetProcessWakeups(pid_t pid, unsigned long *wakeups);   // Get process main thread wakeups (voluntary context switches), Linux only (/proc)
+static bool SendServeRequest(int clientSocket, const char *command, WaveParams params, int sampleRate, int sampleSize, int channels);  // Send serve request
+static unsigned char *RecvServeResponse(int clientSocket, unsigned int *status, unsigned int *dataSize);    // Receive serve response, data must be freed
+#endif
+
+static int LoadReferenceCases(BenchCase *cases, int maxCount);  // Load verification cases: benchmarks corpus and parameters coverage
+static unsigned long long GetWaveChecksum(Wave wave);           // Get wave data checksum (FNV-1a 64 bit)
+static bool SaveReferenceFixtures(const char *dirPath);         // Save reference fixtures (.rfx) and golden frames count and checksums
+static int LoadReferenceFixtures(const char *dirPath, ReferenceCase *cases, int maxCount);  // Load reference fixtures and golden renders
+static bool SaveReference(const char *dirPath, const char *fileName);   // Save reference renders samples file (local, fixtures generated)
+static float *LoadReferenceSamples(const char *fileName, const char *name, unsigned int *frameCount);  // Load reference renders case samples
+static bool VerifyReference(const char *dirPath, const char *samplesFileName, float tolerance);  // Verify generated waves against reference fixtures
+
+static void StressTaskFunc(void *data);                         // Stress task function: generate wave and check invariants
+static WaveParams GetStressParams(int source);                  // Get stress wave parameters from source, raylib random generator is used
+static bool RunStress(int count, unsigned int seed, int jobCount, double maxTime);  // Run stress mode, returns true if all invariants passed
+
+static bool RunDedupe(const char *corpusPath);                  // Measure corpus deduplication: unique parameters and unique canonical parameters
+static int CompareHash(const void *a, const void *b);           // Compare hash values, used to count unique hashes
+
+// Benchmark functions
+static long long BenchGenerateWave(void *data, double *time);   // Benchmark: GenerateWave()
+static long long BenchWaveFormat(void *data, double *time);     // Benchmark: WaveFormat()
+static long long BenchSaveWaveParams(void *data, double *time); // Benchmark: SaveWaveParams()
+static long long BenchLoadWaveParams(void *data, double *time); // Benchmark: LoadWaveParams()
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    const char *jsonFileName = NULL;
+    const char *corpusPath = NULL;      // Corpus directory to generate
+    const char *e2ePath = NULL;         // Corpus directory to convert on end-to-end benchmark
+    const char *rfxgenPath = "./rfxgen";
+    const char *outPath = NULL;
+    int corpusCount = CORPUS_DEFAULT_COUNT;
+    unsigned int corpusSeed = 1;
+    int chunkSize = E2E_DEFAULT_CHUNK;
+    int jobCount = 0;
+    const char *fixturesPath = REFERENCE_DEFAULT_PATH;  // Reference fixtures directory
+    bool saveFixtures = false;              // Save reference fixtures
+    const char *referenceFileName = NULL;   // Reference renders samples file to save
+    const char *samplesFileName = NULL;     // Reference renders samples file, compared on verification
+    bool verify = false;                    // Verify generated waves against reference fixtures
+    float tolerance = REFERENCE_DEFAULT_TOLERANCE;
+    int stressCount = 0;                    // Stress sounds to generate
+    double stressMaxTime = STRESS_DEFAULT_MAX_TIME;
+    int startupRuns = 0;                    // Startup time runs
+    double idleTime = 0.0;                  // GUI idle time measured (seconds)
+    int transcodeSize = 0;                  // Transcoding input size (MB)
+    int serveRequests = 0;                  // Serve mode requests to send
+    const char *dedupePath = NULL;          // Corpus directory to measure deduplication
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--filter") == 0) && ((i + 1) < argc)) benchFilter = argv[++i];
+        else if ((strcmp(argv[i], "--min-time") == 0) && ((i + 1) < argc)) benchMinTime = atof(argv[++i]);
+        else if ((strcmp(argv[i], "--json") == 0) && ((i + 1) < argc)) jsonFileName = argv[++i];
+        else if ((strcmp(argv[i], "--corpus") == 0) && ((i + 1) < argc)) corpusPath = argv[++i];
+        else if ((strcmp(argv[i], "--count") == 0) && ((i + 1) < argc)) corpusCount = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--seed") == 0) && ((i + 1) < argc)) corpusSeed = (unsigned int)strtoul(argv[++i], NULL, 10);
+        else if ((strcmp(argv[i], "--e2e") == 0) && ((i + 1) < argc)) e2ePath = argv[++i];
+        else if ((strcmp(argv[i], "--rfxgen") == 0) && ((i + 1) < argc)) rfxgenPath = argv[++i];
+        else if ((strcmp(argv[i], "--output-dir") == 0) && ((i + 1) < argc)) outPath = argv[++i];
+        else if ((strcmp(argv[i], "--chunk") == 0) && ((i + 1) < argc)) chunkSize = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--jobs") == 0) && ((i + 1) < argc)) jobCount = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--save-fixtures") == 0) && ((i + 1) < argc)) { fixturesPath = argv[++i]; saveFixtures = true; }
+        else if ((strcmp(argv[i], "--fixtures") == 0) && ((i + 1) < argc)) fixturesPath = argv[++i];
+        else if ((strcmp(argv[i], "--save-reference") == 0) && ((i + 1) < argc)) referenceFileName = argv[++i];
+        else if ((strcmp(argv[i], "--verify") == 0) && ((i + 1) < argc)) { fixturesPath = argv[++i]; verify = true; }
+        else if ((strcmp(argv[i], "--samples") == 0) && ((i + 1) < argc)) samplesFileName = argv[++i];
+        else if ((strcmp(argv[i], "--tolerance") == 0) && ((i + 1) < argc)) tolerance = (float)atof(argv[++i]);
+        else if ((strcmp(argv[i], "--stress") == 0) && ((i + 1) < argc)) stressCount = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--max-sound-time") == 0) && ((i + 1) < argc)) stressMaxTime = atof(argv[++i]);
+        else if ((strcmp(argv[i], "--startup") == 0) && ((i + 1) < argc)) startupRuns = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--idle") == 0) && ((i + 1) < argc)) idleTime = atof(argv[++i]);
+        else if ((strcmp(argv[i], "--transcode") == 0) && ((i + 1) < argc)) transcodeSize = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--serve") == 0) && ((i + 1) < argc)) serveRequests = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--dedupe") == 0) && ((i + 1) < argc)) dedupePath = argv[++i];
+        else
+        {
+            printf("USAGE: rfxgen_bench [--filter <text>] [--min-time <seconds>] [--json <filename.json>]\n");
+            printf("       rfxgen_bench --corpus <directory> [--count <files>] [--seed <value>]\n");
+            printf("       rfxgen_bench --e2e <directory> [--rfxgen <path>] [--output-dir <directory>]\n");
+            printf("                    [--chunk <files>] [--jobs <count>] [--json <filename.json>]\n");
+            printf("       rfxgen_bench --startup <runs> [--rfxgen <path>]\n");
+            printf("       rfxgen_bench --idle <seconds> [--rfxgen <path>]\n");
+            printf("       rfxgen_bench --transcode <size_mb> [--rfxgen <path>] [--output-dir <directory>]\n");
+            printf("       rfxgen_bench --serve <requests> [--rfxgen <path>] [--jobs <count>]\n");
+            printf("       rfxgen_bench --save-fixtures <directory>\n");
+            printf("       rfxgen_bench --save-reference <filename.rfxref> [--fixtures <directory>]\n");
+            printf("       rfxgen_bench --verify <directory> [--samples <filename.rfxref>] [--tolerance <value>]\n");
+            printf("       rfxgen_bench --stress <count> [--seed <value>] [--jobs <count>] [--max-sound-time <seconds>]\n");
+            printf("       rfxgen_bench --dedupe <directory>\n");
+            return 1;
+        }
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    // Reference fixtures and renders saving and verification, microbenchmarks are not run
+    if (saveFixtures) return SaveReferenceFixtures(fixturesPath)? 0 : 1;
+    if (referenceFileName != NULL) return SaveReference(fixturesPath, referenceFileName)? 0 : 1;
+    if (verify) return VerifyReference(fixturesPath, samplesFileName, tolerance)? 0 : 1;
+
+    // Stress mode, microbenchmarks are not run
+    if (stressCount > 0) return RunStress(stressCount, corpusSeed, jobCount, stressMaxTime)? 0 : 1;
+
+    // Corpus deduplication, microbenchmarks are not run
+    if (dedupePath != NULL) return RunDedupe(dedupePath)? 0 : 1;
+
+    // Process startup time, microbenchmarks are not run
+    if (startupRuns > 0) return RunStartup(rfxgenPath, startupRuns)? 0 : 1;
+
+    // GUI idle CPU usage, microbenchmarks are not run
+    if (idleTime > 0.0) return RunIdle(rfxgenPath, idleTime)? 0 : 1;
+
+    // Audio files transcoding, microbenchmarks are not run
+    if (transcodeSize > 0) return RunTranscode(rfxgenPath, (outPath != NULL)? outPath : TRANSCODE_DEFAULT_PATH, transcodeSize)? 0 : 1;
+
+    // Serve mode requests, microbenchmarks are not run
+    if (serveRequests > 0) return RunServe(rfxgenPath, serveRequests, jobCount)? 0 : 1;
+
+    // Synthetic corpus generation and end-to-end benchmark, microbenchmarks are not run
+    if ((corpusPath != NULL) || (e2ePath != NULL))
+    {
+        if ((corpusPath != NULL) && (GenerateCorpus(corpusPath, corpusCount, corpusSeed) == 0)) return 1;
+
+        if (e2ePath != NULL)
+        {
+            EndToEndResult result = { 0 };
+            char defaultOutPath[512] = { 0 };   // Default output directory: <corpus>/wav
+            snprintf(defaultOutPath, 512, "%s/wav", e2ePath);
+            if (chunkSize <= 0) chunkSize = E2E_DEFAULT_CHUNK;
+
+            if (!RunEndToEnd(e2ePath, rfxgenPath, (outPath != NULL)? outPath : defaultOutPath, chunkSize, jobCount, &result)) return 1;
+
+            PrintEndToEndResult(result);
+
+            if (jsonFileName != NULL)
+            {
+                if (SaveEndToEndResult(result, jsonFileName)) printf("\nResults saved: %s\n", jsonFileName);
+                else printf("\nWARNING: [%s] Results file could not be saved\n", jsonFileName);
+            }
+        }
+
+        return 0;
+    }
+
+    // Wave generation benchmarks
+    BenchCase cases[BENCH_MAX_CASES] = { 0 };
+    int caseCount = LoadBenchCorpus(cases, BENCH_MAX_CASES);
+
+    for (int i = 0; i < caseCount; i++) RunBench(TextFormat("generate/%s", cases[i].name), BenchGenerateWave, &cases[i].params);
+
+    // Wave format conversion benchmarks, source wave: long repeat sound (44100 Hz, 32 bit, mono)
+    // NOTE: Conversion parameters are stored in a wave used as format description
+    Wave source = GenerateWave(cases[caseCount - 1].params);
+    Wave formats[4] = {
+        { .sampleRate = 44100, .sampleSize = 16, .channels = 1 },
+        { .sampleRate = 44100, .sampleSize = 8, .channels = 1 },
+        { .sampleRate = 22050, .sampleSize = 16, .channels = 2 },
+        { .sampleRate = 22050, .sampleSize = 32, .channels = 1 }
+    };
+
+    for (int i = 0; i < 4; i++)
+    {
+        Wave conversion[2] = { source, formats[i] };
+        RunBench(TextFormat("format/%i-%i-%i", formats[i].sampleRate, formats[i].sampleSize, formats[i].channels), BenchWaveFormat, conversion);
+    }
+
+    UnloadWave(source);
+
+    // Wave parameters files benchmarks
+    RunBench("io/save-rfx", BenchSaveWaveParams, &cases[0].params);
+    RunBench("io/load-rfx", BenchLoadWaveParams, BENCH_PARAMS_FILE);
+    remove(BENCH_PARAMS_FILE);
+
+    PrintBenchResults();
+
+    if (jsonFileName != NULL)
+    {
+        if (SaveBenchResults(jsonFileName)) printf("\nResults saved: %s\n", jsonFileName);
+        else printf("\nWARNING: [%s] Results file could not be saved\n", jsonFileName);
+    }
+
+    return 0;
+}
+
+//--------------------------------------------------------------------------------------------
+// Module Functions Definition
+//--------------------------------------------------------------------------------------------
+
+// Memory allocators hooks
+void *BenchMalloc(size_t size) { if (allocTracking) { allocCount++; allocBytes += size; } return malloc(size); }
+void *BenchCalloc(size_t count, size_t size) { if (allocTracking) { allocCount++; allocBytes += count*size; } return calloc(count, size); }
+void *BenchRealloc(void *ptr, size_t size) { if (allocTracking) { allocCount++; allocBytes += size; } return realloc(ptr, size); }
+
+// Get time in seconds, high resolution monotonic clock
+static double GetBenchTime(void)
+{
+#if defined(_WIN32)
+    long long counter = 0;
+    long long frequency = 1;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+
+    return (double)counter/(double)frequency;
+#else
+    struct timespec now = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (double)now.tv_sec + (double)now.tv_nsec*1e-9;
+#endif
+}
+
+// Get calling thread CPU time in seconds
+// NOTE: Not affected by other processes or threads sharing the processors (time limits on loaded machines)
+static double GetBenchThreadTime(void)
+{
+#if defined(_WIN32)
+    unsigned long long creation = 0, exit = 0, kernel = 0, user = 0;
+    GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user);
+
+    return (double)(kernel + user)*1e-7;
+#else
+    struct timespec now = { 0 };
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+
+    return (double)now.tv_sec + (double)now.tv_nsec*1e-9;
+#endif
+}
+
+// Load wave generation corpus, fixed parameters and seeds
+// NOTE: Presets use raylib random generator, it is seeded for every case
+static int LoadBenchCorpus(BenchCase *cases, int maxCount)
+{
+    static const char *presetNames[7] = { "coin", "laser", "explosion", "powerup", "hit", "jump", "blip" };
+    static const char *waveTypeNames[4] = { "square", "sawtooth", "sine", "noise" };
+    int count = 0;
+
+    // Presets at fixed seeds
+    for (int preset = 0; preset < 7; preset++)
+    {
+        for (int seed = 1; seed <= 3; seed++)
+        {
+            if (count >= maxCount) return count;
+
+            SetRandomSeed(seed);
+
+            switch (preset)
+            {
+                case 0: cases[count].params = GenPickupCoin(); break;
+                case 1: cases[count].params = GenLaserShoot(); break;
+                case 2: cases[count].params = GenExplosion(); break;
+                case 3: cases[count].params = GenPowerup(); break;
+                case 4: cases[count].params = GenHitHurt(); break;
+                case 5: cases[count].params = GenJump(); break;
+                case 6: cases[count].params = GenBlipSelect(); break;
+                default: break;
+            }
+
+            snprintf(cases[count].name, 64, "preset-%s-%i", presetNames[preset], seed);
+            count++;
+        }
+    }
+
+    // Every wave type, default parameters
+    for (int type = 0; (type < 4) && (count < maxCount); type++)
+    {
+        SetRandomSeed(1);
+        ResetWaveParams(&cases[count].params);
+        cases[count].params.waveTypeValue = type;
+        snprintf(cases[count].name, 64, "wave-%s", waveTypeNames[type]);
+        count++;
+    }
+
+    // Filters on/off, sawtooth wave
+    for (int filters = 0; (filters < 5) && (count < maxCount); filters++)
+    {
+        WaveParams *params = &cases[count].params;
+
+        SetRandomSeed(1);
+        ResetWaveParams(params);
+        params->waveTypeValue = 1;
+
+        switch (filters)
+        {
+            case 0: snprintf(cases[count].name, 64, "filter-off"); break;
+            case 1:
+            {
+                params->lpfCutoffValue = 0.3f;
+                params->lpfCutoffSweepValue = 0.1f;
+                params->lpfResonanceValue = 0.5f;
+                snprintf(cases[count].name, 64, "filter-lpf");
+            } break;
+            case 2:
+            {
+                params->hpfCutoffValue = 0.3f;
+                params->hpfCutoffSweepValue = -0.1f;
+                snprintf(cases[count].name, 64, "filter-hpf");
+            } break;
+            case 3:
+            {
+                params->lpfCutoffValue = 0.3f;
+                params->lpfResonanceValue = 0.5f;
+                params->hpfCutoffValue = 0.3f;
+                snprintf(cases[count].name, 64, "filter-lpf-hpf");
+            } break;
+            case 4:
+            {
+                params->lpfCutoffValue = 0.3f;
+                params->lpfResonanceValue = 0.5f;
+                params->hpfCutoffValue = 0.3f;
+                params->phaserOffsetValue = 0.3f;
+                params->phaserSweepValue = 0.1f;
+                snprintf(cases[count].name, 64, "filter-lpf-hpf-phaser");
+            } break;
+            default: break;
+        }
+
+        count++;
+    }
+
+    // Long sounds: vibrato and repeat with arpeggio (~4.5 seconds)
+    // NOTE: Last case is also used as source wave for format conversion benchmarks
+    for (int i = 0; (i < 2) && (count < maxCount); i++)
+    {
+        WaveParams *params = &cases[count].params;
+
+        SetRandomSeed(1);
+        ResetWaveParams(params);
+        params->sustainTimeValue = 1.0f;
+        params->decayTimeValue = 1.0f;
+
+        if (i == 0)
+        {
+            params->waveTypeValue = 2;
+            params->vibratoDepthValue = 0.5f;
+            params->vibratoSpeedValue = 0.5f;
+            snprintf(cases[count].name, 64, "long-vibrato");
+        }
+        else
+        {
+            params->repeatSpeedValue = 0.6f;
+            params->changeAmountValue = 0.5f;
+            params->changeSpeedValue = 0.5f;
+            snprintf(cases[count].name, 64, "long-repeat");
+        }
+
+        count++;
+    }
+
+    return count;
+}
+
+// Run benchmark until min time, result is registered
+// NOTE: One warm-up iteration is run first, not measured
+static void RunBench(const char *name, BenchFunc func, void *data)
+{
+    if ((benchFilter != NULL) && (strstr(name, benchFilter) == NULL)) return;
+    if (resultCount >= BENCH_MAX_RESULTS) return;
+
+    BenchResult *result = &results[resultCount];
+    strncpy(result->name, name, 63);
+
+    double time = 0.0;
+    func(data, &time);
+
+    long long startAllocCount = allocCount;
+    long long startAllocBytes = allocBytes;
+    allocTracking = true;
+
+    while ((result->totalTime < benchMinTime) || (result->iterations < BENCH_MIN_ITERATIONS))
+    {
+        result->samples = func(data, &time);
+        result->totalTime += time;
+        if ((result->iterations == 0) || (time < result->minTime)) result->minTime = time;
+        result->iterations++;
+    }
+
+    allocTracking = false;
+    result->allocCount = allocCount - startAllocCount;
+    result->allocBytes = allocBytes - startAllocBytes;
+
+    resultCount++;
+}
+
+// Print benchmark results table
+static void PrintBenchResults(void)
+{
+    printf("%-34s %8s %12s %12s %10s %10s %9s %11s\n", "Benchmark", "iters", "ns/op", "min ns/op", "ns/sample", "Msample/s", "allocs/op", "bytes/op");
+
+    for (int i = 0; i < resultCount; i++)
+    {
+        BenchResult *result = &results[i];
+        double timePerOp = result->totalTime/result->iterations;
+
+        printf("%-34s %8i %12.0f %12.0f ", result->name, result->iterations, timePerOp*1e9, result->minTime*1e9);
+
+        if (result->samples > 0) printf("%10.2f %10.2f ", timePerOp*1e9/result->samples, result->samples/timePerOp/1e6);
+        else printf("%10s %10s ", "-", "-");
+
+        printf("%9.1f %11.0f\n", (double)result->allocCount/result->iterations, (double)result->allocBytes/result->iterations);
+    }
+}
+
+// Save benchmark results as JSON file
+// NOTE: Times are provided in nanoseconds, results can be compared between builds
+static bool SaveBenchResults(const char *fileName)
+{
+    FILE *file = fopen(fileName, "wt");
+    if (file == NULL) return false;
+
+    fprintf(file, "{\n  \"benchmarks\": [\n");
+
+    for (int i = 0; i < resultCount; i++)
+    {
+        BenchResult *result = &results[i];
+        double timePerOp = result->totalTime/result->iterations;
+
+        fprintf(file, "    { \"name\": \"%s\", \"iterations\": %i, \"ns_per_op\": %.1f, \"min_ns_per_op\": %.1f, \"samples\": %lld, ",
+                result->name, result->iterations, timePerOp*1e9, result->minTime*1e9, result->samples);
+        fprintf(file, "\"ns_per_sample\": %.4f, \"allocs_per_op\": %.2f, \"bytes_per_op\": %.0f }%s\n",
+                (result->samples > 0)? timePerOp*1e9/result->samples : 0.0, (double)result->allocCount/result->iterations,
+                (double)result->allocBytes/result->iterations, (i < (resultCount - 1))? "," : "");
+    }
+
+    fprintf(file, "  ]\n}\n");
+    fclose(file);
+
+    return true;
+}
+
+// Benchmark: GenerateWave()
+static long long BenchGenerateWave(void *data, double *time)
+{
+    WaveParams *params = (WaveParams *)data;
+
+    double startTime = GetBenchTime();
+    Wave wave = GenerateWave(*params);
+    *time = GetBenchTime() - startTime;
+
+    long long samples = wave.frameCount;
+    UnloadWave(wave);
+
+    return samples;
+}
+
+// Benchmark: WaveFormat(), data contains source wave and conversion format
+static long long BenchWaveFormat(void *data, double *time)
+{
+    Wave *conversion = (Wave *)data;
+    Wave wave = WaveCopy(conversion[0]);
+
+    double startTime = GetBenchTime();
+    WaveFormat(&wave, conversion[1].sampleRate, conversion[1].sampleSize, conversion[1].channels);
+    *time = GetBenchTime() - startTime;
+
+    UnloadWave(wave);
+
+    return conversion[0].frameCount;
+}
+
+// Benchmark: SaveWaveParams()
+static long long BenchSaveWaveParams(void *data, double *time)
+{
+    double startTime = GetBenchTime();
+    SaveWaveParams(*(WaveParams *)data, BENCH_PARAMS_FILE);
+    *time = GetBenchTime() - startTime;
+
+    return 0;
+}
+
+// Benchmark: LoadWaveParams()
+static long long BenchLoadWaveParams(void *data, double *time)
+{
+    double startTime = GetBenchTime();
+    LoadWaveParams((const char *)data);
+    *time = GetBenchTime() - startTime;
+
+    return 0;
+}
+
+// Create directory if not exists
+static bool MakeBenchDirectory(const char *dirPath)
+{
+    if (DirectoryExists(dirPath)) return true;
+
+#if defined(_WIN32)
+    return (_mkdir(dirPath) == 0);
+#else
+    return (mkdir(dirPath, 0755) == 0);
+#endif
+}
+
+// Get wave length from envelope (seconds)
+// NOTE: Same envelope lengths than GenerateWave(), sound could finish before on frequency cut
+static float GetWaveParamsLength(WaveParams params)
+{
+    float samples = (params.attackTimeValue*params.attackTimeValue + params.sustainTimeValue*params.sustainTimeValue +
+                     params.decayTimeValue*params.decayTimeValue)*100000.0f;
+
+    if (samples > 10*44100) samples = 10*44100;     // Max wave length: 10 seconds
+
+    return samples/44100.0f;
+}
+
+// Generate synthetic corpus of .rfx files, returns number of files generated
+// NOTE: Sounds distribution is weighted to short gameplay/UI sounds, 5% of sounds are long (ambience-like)
+static int GenerateCorpus(const char *dirPath, int count, unsigned int seed)
+{
+    // Generators weights (%): coin, blip, hit, jump, laser, powerup, explosion, random
+    static const int weights[8] = { 20, 20, 15, 15, 12, 8, 5, 5 };
+    static const float bucketLimits[CORPUS_LENGTH_BUCKETS] = { 0.25f, 0.5f, 1.0f, 2.0f, 10.0f };
+    int bucketCount[CORPUS_LENGTH_BUCKETS] = { 0 };
+
+    if (!MakeBenchDirectory(dirPath))
+    {
+        printf("WARNING: [%s] Corpus directory could not be created\n", dirPath);
+        return 0;
+    }
+
+    double startTime = GetBenchTime();
+    int generated = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        SetRandomSeed(seed*100003u + (unsigned int)i);
+
+        WaveParams params = { 0 };
+        int value = GetRandomValue(0, 99);
+        int generator = 0;
+
+        while (value >= weights[generator]) { value -= weights[generator]; generator++; }
+
+        switch (generator)
+        {
+            case 0: params = GenPickupCoin(); break;
+            case 1: params = GenBlipSelect(); break;
+            case 2: params = GenHitHurt(); break;
+            case 3: params = GenJump(); break;
+            case 4: params = GenLaserShoot(); break;
+            case 5: params = GenPowerup(); break;
+            case 6: params = GenExplosion(); break;
+            case 7: params = GenRandomize(); break;
+            default: break;
+        }
+
+        // Long sounds tail
+        if (GetRandomValue(0, 99) < 5)
+        {
+            params.sustainTimeValue = (float)GetRandomValue(60, 90)/100.0f;
+            params.decayTimeValue = (float)GetRandomValue(60, 90)/100.0f;
+        }
+
+        SaveWaveParams(params, TextFormat("%s/sfx_%06i.rfx", dirPath, i));
+        generated++;
+
+        float length = GetWaveParamsLength(params);
+        for (int b = 0; b < CORPUS_LENGTH_BUCKETS; b++) if ((length < bucketLimits[b]) || (b == (CORPUS_LENGTH_BUCKETS - 1))) { bucketCount[b]++; break; }
+    }
+
+    printf("Corpus generated: %i files in %s (seed: %u) in %.3f s\n", generated, dirPath, seed, GetBenchTime() - startTime);
+    printf("Sounds length distribution:\n");
+
+    for (int b = 0; b < CORPUS_LENGTH_BUCKETS; b++)
+    {
+        printf("    < %5.2f s: %8i (%5.1f%%)\n", bucketLimits[b], bucketCount[b], (generated > 0)? 100.0f*bucketCount[b]/generated : 0.0f);
+    }
+
+    return generated;
+}
+
+// Run rfxgen command line conversion over corpus, one process per chunk of files
+// NOTE: Processes output is parsed for converted files and stages time, output files are measured with stat()
+static bool RunEndToEnd(const char *corpusPath, const char *rfxgenPath, const char *outPath, int chunkSize, int jobCount, EndToEndResult *result)
+{
+#if defined(_WIN32)
+    printf("WARNING: End-to-end benchmark not supported on this platform\n");
+    return false;
+#else
+    FilePathList files = LoadDirectoryFilesEx(corpusPath, ".rfx", false);
+
+    if (files.count == 0)
+    {
+        printf("WARNING: [%s] No .rfx files found on corpus directory\n", corpusPath);
+        UnloadDirectoryFiles(files);
+        return false;
+    }
+
+    if (!MakeBenchDirectory(outPath))
+    {
+        printf("WARNING: [%s] Output directory could not be created\n", outPath);
+        UnloadDirectoryFiles(files);
+        return false;
+    }
+
+    char jobsText[16] = { 0 };
+    snprintf(jobsText, 16, "%i", jobCount);
+
+    // Process arguments: rfxgen -i <files...> --output-dir <directory> --no-cache [-j <count>]
+    char **args = (char **)calloc(chunkSize + 8, sizeof(char *));
+
+    result->fileCount = (int)files.count;
+    bool success = true;
+    double startTime = GetBenchTime();
+
+    for (int first = 0; first < (int)files.count; first += chunkSize)
+    {
+        int count = ((first + chunkSize) <= (int)files.count)? chunkSize : ((int)files.count - first);
+        int argCount = 0;
+
+        args[argCount++] = (char *)rfxgenPath;
+        args[argCount++] = "-i";
+        for (int i = 0; i < count; i++) args[argCount++] = files.paths[first + i];
+        args[argCount++] = "--output-dir";
+        args[argCount++] = (char *)outPath;
+        args[argCount++] = "--no-cache";        // NOTE: Generation measured, not render cache loading
+        if (jobCount > 0) { args[argCount++] = "-j"; args[argCount++] = jobsText; }
+        args[argCount] = NULL;
+
+        int output[2] = { 0 };
+        if (pipe(output) != 0) { success = false; break; }
+
+        fflush(stdout);
+        pid_t pid = fork();
+
+        if (pid == 0)
+        {
+            // Child process: output redirected to pipe
+            dup2(output[1], STDOUT_FILENO);
+            close(output[0]);
+            close(output[1]);
+            execv(rfxgenPath, args);
+            _exit(127);
+        }
+
+        close(output[1]);
+
+        if (pid < 0)
+        {
+            close(output[0]);
+            success = false;
+            break;
+        }
+
+        FILE *processOutput = fdopen(output[0], "r");
+        char line[512] = { 0 };
+
+        while (fgets(line, 512, processOutput) != NULL)
+        {
+            int converted = 0, total = 0;
+            double time = 0.0;
+            double stages[E2E_STAGE_COUNT] = { 0 };
+
+            if (sscanf(line, "Converted %i/%i files in %lf s", &converted, &total, &time) == 3)
+            {
+                result->convertedCount += converted;
+                result->conversionTime += time;
+            }
+            else if (sscanf(line, "Stages time: load %lf s, generate %lf s, format %lf s, encode %lf s, write %lf s",
+                            &stages[0], &stages[1], &stages[2], &stages[3], &stages[4]) == E2E_STAGE_COUNT)
+            {
+                for (int s = 0; s < E2E_STAGE_COUNT; s++) result->stageTime[s] += stages[s];
+            }
+        }
+
+        fclose(processOutput);
+
+        int status = 0;
+        waitpid(pid, &status, 0);
+        result->processCount++;
+
+        if (!WIFEXITED(status) || (WEXITSTATUS(status) == 127))
+        {
+            printf("WARNING: [%s] rfxgen process could not be executed\n", rfxgenPath);
+            success = false;
+            break;
+        }
+    }
+
+    result->wallTime = GetBenchTime() - startTime;
+
+    // Output files size, named as input files
+    for (unsigned int i = 0; i < files.count; i++)
+    {
+        struct stat info = { 0 };
+        if (stat(TextFormat("%s/%s.wav", outPath, GetFileNameWithoutExt(files.paths[i])), &info) == 0) result->bytesWritten += info.st_size;
+    }
+
+    // NOTE: ru_maxrss is provided in KB on Linux, in bytes on macOS
+    struct rusage usage = { 0 };
+    getrusage(RUSAGE_CHILDREN, &usage);
+#if defined(__APPLE__)
+    result->peakRSS = usage.ru_maxrss/1024;
+#else
+    result->peakRSS = usage.ru_maxrss;
+#endif
+
+    free(args);
+    UnloadDirectoryFiles(files);
+
+    return success;
+#endif
+}
+
+// Print end-to-end benchmark result
+static void PrintEndToEndResult(EndToEndResult result)
+{
+    static const char *stageNames[E2E_STAGE_COUNT] = { "load", "generate", "format", "encode", "write" };
+    double stagesTotal = 0.0;
+
+    for (int s = 0; s < E2E_STAGE_COUNT; s++) stagesTotal += result.stageTime[s];
+
+    printf("Corpus files:     %i\n", result.fileCount);
+    printf("Files converted:  %i (%i processes)\n", result.convertedCount, result.processCount);
+    printf("Wall time:        %.3f s (processes startup to files written)\n", result.wallTime);
+    printf("Throughput:       %.1f files/s, %.2f MB/s written (%.2f MB)\n", (result.wallTime > 0.0)? result.convertedCount/result.wallTime : 0.0,
+           (result.wallTime > 0.0)? (double)result.bytesWritten/(1024*1024)/result.wallTime : 0.0, (double)result.bytesWritten/(1024*1024));
+    printf("Peak RSS:         %.2f MB\n", (double)result.peakRSS/1024);
+    printf("Phases:\n");
+    printf("    %-10s %10.3f s  (%5.1f%% of wall time)\n", "startup", result.wallTime - result.conversionTime,
+           (result.wallTime > 0.0)? 100.0*(result.wallTime - result.conversionTime)/result.wallTime : 0.0);
+    printf("    %-10s %10.3f s  (%5.1f%% of wall time)\n", "convert", result.conversionTime, (result.wallTime > 0.0)? 100.0*result.conversionTime/result.wallTime : 0.0);
+
+    for (int s = 0; s < E2E_STAGE_COUNT; s++)
+    {
+        printf("      %-8s %10.3f s  (%5.1f%% of stages, summed over workers)\n", stageNames[s], result.stageTime[s], (stagesTotal > 0.0)? 100.0*result.stageTime[s]/stagesTotal : 0.0);
+    }
+}
+
+// Save end-to-end benchmark result as JSON file
+static bool SaveEndToEndResult(EndToEndResult result, const char *fileName)
+{
+    FILE *file = fopen(fileName, "wt");
+    if (file == NULL) return false;
+
+    fprintf(file, "{\n  \"e2e\": {\n");
+    fprintf(file, "    \"files\": %i, \"converted\": %i, \"processes\": %i,\n", result.fileCount, result.convertedCount, result.processCount);
+    fprintf(file, "    \"wall_time_s\": %.6f, \"conversion_time_s\": %.6f,\n", result.wallTime, result.conversionTime);
+    fprintf(file, "    \"files_per_s\": %.2f, \"mb_per_s\": %.4f, \"bytes_written\": %lld, \"peak_rss_kb\": %lld,\n",
+            (result.wallTime > 0.0)? result.convertedCount/result.wallTime : 0.0, (result.wallTime > 0.0)? (double)result.bytesWritten/(1024*1024)/result.wallTime : 0.0,
+            result.bytesWritten, result.peakRSS);
+    fprintf(file, "    \"stages_s\": { \"load\": %.6f, \"generate\": %.6f, \"format\": %.6f, \"encode\": %.6f, \"write\": %.6f }\n",
+            result.stageTime[0], result.stageTime[1], result.stageTime[2], result.stageTime[3], result.stageTime[4]);
+    fprintf(file, "  }\n}\n");
+    fclose(file);
+
+    return true;
+}
+
+// Measure rfxgen process startup time, launched with no conversion work (--help)
+// NOTE: Measures dynamic loading and initialization costs paid on every rfxgen invocation
+static bool RunStartup(const char *rfxgenPath, int runCount)
+{
+#if defined(_WIN32)
+    printf("WARNING: Startup benchmark not supported on this platform\n");
+    return false;
+#else
+    char *args[3] = { (char *)rfxgenPath, "--help", NULL };
+    double *times = (double *)calloc(runCount, sizeof(double));
+    bool success = true;
+
+    for (int i = -STARTUP_WARMUP_RUNS; (i < runCount) && success; i++)
+    {
+        fflush(stdout);
+        double startTime = GetBenchTime();
+        pid_t pid = fork();
+
+        if (pid == 0)
+        {
+            // Child process: output discarded
+            int devNull = open("/dev/null", O_WRONLY);
+            dup2(devNull, STDOUT_FILENO);
+            dup2(devNull, STDERR_FILENO);
+            close(devNull);
+            execv(rfxgenPath, args);
+            _exit(127);
+        }
+
+        int status = 0;
+        if ((pid < 0) || (waitpid(pid, &status, 0) < 0) || !WIFEXITED(status) || (WEXITSTATUS(status) == 127))
+        {
+            printf("WARNING: [%s] rfxgen process could not be executed\n", rfxgenPath);
+            success = false;
+        }
+        else if (i >= 0) times[i] = GetBenchTime() - startTime;
+    }
+
+    if (success)
+    {
+        double totalTime = 0.0;
+        for (int i = 0; i < runCount; i++) totalTime += times[i];
+
+        qsort(times, runCount, sizeof(double), CompareDouble);
+
+        // NOTE: ru_maxrss is provided in KB on Linux, in bytes on macOS
+        struct rusage usage = { 0 };
+        getrusage(RUSAGE_CHILDREN, &usage);
+#if defined(__APPLE__)
+        long long peakRSS = usage.ru_maxrss/1024;
+#else
+        long long peakRSS = usage.ru_maxrss;
+#endif
+
+        printf("Executable:       %s\n", rfxgenPath);
+        printf("Runs:             %i (%i warm-up runs not measured)\n", runCount, STARTUP_WARMUP_RUNS);
+        printf("Startup time:     min %.3f ms, median %.3f ms, mean %.3f ms, p95 %.3f ms\n", times[0]*1e3,
+               times[runCount/2]*1e3, totalTime/runCount*1e3, times[((runCount - 1)*95)/100]*1e3);
+        printf("Peak RSS:         %.2f MB\n", (double)peakRSS/1024);
+    }
+
+    free(times);
+
+    return success;
+#endif
+}
+
+// Measure rfxgen GUI process CPU usage while idle: launched with no arguments, no input events sent
+// NOTE: Requires a display, window must not be focused or hovered while measuring; only rfxgen process
+// CPU time is measured (Linux /proc), GPU and display server work is not included
+static bool RunIdle(const char *rfxgenPath, double idleTime)
+{
+#if !defined(__linux__)
+    printf("WARNING: Idle benchmark not supported on this platform\n");
+    return false;
+#else
+    char *args[2] = { (char *)rfxgenPath, NULL };
+
+    fflush(stdout);
+    pid_t pid = fork();
+
+    if (pid == 0)
+    {
+        // Child process: output discarded
+        int devNull = open("/dev/null", O_WRONLY);
+        dup2(devNull, STDOUT_FILENO);
+        dup2(devNull, STDERR_FILENO);
+        close(devNull);
+        execv(rfxgenPath, args);
+        _exit(127);
+    }
+
+    if (pid < 0)
+    {
+        printf("WARNING: [%s] rfxgen process could not be executed\n", rfxgenPath);
+        return false;
+    }
+
+    double startUserTime = 0.0, startSystemTime = 0.0;
+    double endUserTime = 0.0, endSystemTime = 0.0;
+    double startTime = 0.0, endTime = 0.0;
+    unsigned long startWakeups = 0, endWakeups = 0;
+    int status = 0;
+
+    struct timespec settle = { (time_t)IDLE_SETTLE_TIME, (long)((IDLE_SETTLE_TIME - (time_t)IDLE_SETTLE_TIME)*1e9) };
+    struct timespec measure = { (time_t)idleTime, (long)((idleTime - (time_t)idleTime)*1e9) };
+
+    nanosleep(&settle, NULL);
+    bool success = GetProcessCpuTime(pid, &startUserTime, &startSystemTime) && GetProcessWakeups(pid, &startWakeups);
+    startTime = GetBenchTime();
+
+    if (success)
+    {
+        nanosleep(&measure, NULL);
+        success = GetProcessCpuTime(pid, &endUserTime, &endSystemTime) && GetProcessWakeups(pid, &endWakeups);
+        endTime = GetBenchTime();
+    }
+
+    // Process still running while measured (window created), terminated after measuring
+    success = success && (waitpid(pid, &status, WNOHANG) == 0);
+
+    kill(pid, SIGTERM);
+    waitpid(pid, &status, 0);
+
+    if (!success)
+    {
+        printf("WARNING: [%s] rfxgen process exited before measuring (display not available?)\n", rfxgenPath);
+        return false;
+    }
+
+    double userTime = endUserTime - startUserTime;
+    double systemTime = endSystemTime - startSystemTime;
+    double wallTime = endTime - startTime;
+
+    printf("Executable:       %s\n", rfxgenPath);
+    printf("Idle time:        %.1f s (%.1f s after launch not measured, no input events)\n", wallTime, IDLE_SETTLE_TIME);
+    printf("CPU time:         user %.3f s, system %.3f s\n", userTime, systemTime);
+    printf("CPU usage:        %.2f %% (one processor)\n", (userTime + systemTime)/wallTime*100.0);
+    printf("Main thread:      %.1f wakeups/s (voluntary context switches, frames processed)\n", (double)(endWakeups - startWakeups)/wallTime);
+
+    return true;
+#endif
+}
+
+// Compare double values, used to sort timings
+static int CompareDouble(const void *a, const void *b)
+{
+    double valueA = *(const double *)a;
+    double valueB = *(const double *)b;
+
+    return (valueA > valueB) - (valueA < valueB);
+}
+
+// Measure rfxgen audio file transcoding, large synthetic input converted to several formats
+// NOTE: Input is a sine sweep with some noise, frames are written by blocks (input size not allocated)
+static bool RunTranscode(const char *rfxgenPath, const char *outPath, int sizeMB)
+{
+#if defined(_WIN32)
+    printf("WARNING: Transcoding benchmark not supported on this platform\n");
+    return false;
+#else
+    static const int formats[4][3] = {
+        { 44100, 16, 2 },       // Same format: decode and encode only
+        { 44100, 16, 1 },       // Channels mixing
+        { 22050, 16, 1 },       // Channels mixing and resampling
+        { 44100, 32, 2 }        // Sample size conversion
+    };
+
+    if (!MakeBenchDirectory(outPath))
+    {
+        printf("WARNING: [%s] Directory could not be created\n", outPath);
+        return false;
+    }
+
+    printf("Executable:       %s\n\n", rfxgenPath);
+
+    // Conversion output checked first on a short input, full input is not loaded in memory
+    bool checked = CheckTranscode(rfxgenPath, outPath);
+    checked = CheckStreamOutput(rfxgenPath, outPath) && checked;
+
+    char inFileName[512] = { 0 };
+    char outFileName[512] = { 0 };
+    snprintf(inFileName, 512, "%s/transcode_input.wav", outPath);
+    snprintf(outFileName, 512, "%s/transcode_output.wav", outPath);
+
+    unsigned int frameCount = (unsigned int)((long long)sizeMB*1024*1024/4);
+    unsigned int dataSize = frameCount*4;
+
+    if (!SaveTranscodeInput(inFileName, frameCount))
+    {
+        printf("WARNING: [%s] Input file could not be written\n", inFileName);
+        return false;
+    }
+
+    printf("\nInput:            %s (%.2f MB, %u frames, 44100 Hz, 16 bit, stereo)\n\n", inFileName, (double)(dataSize + 44)/(1024*1024), frameCount);
+    printf("%-16s %10s %10s %12s %12s\n", "format", "time (s)", "MB/s", "output (MB)", "peak RSS (MB)");
+
+    bool success = true;
+
+    for (int i = 0; (i < 4) && success; i++)
+    {
+        char format[64] = { 0 };
+        snprintf(format, 64, "%i,%i,%i", formats[i][0], formats[i][1], formats[i][2]);
+        char *args[8] = { (char *)rfxgenPath, "--input", inFileName, "--output", outFileName, "--format", format, NULL };
+
+        fflush(stdout);
+        double startTime = GetBenchTime();
+        pid_t pid = fork();
+
+        if (pid == 0)
+        {
+            // Child process: output discarded
+            int devNull = open("/dev/null", O_WRONLY);
+            dup2(devNull, STDOUT_FILENO);
+            dup2(devNull, STDERR_FILENO);
+            close(devNull);
+            execv(rfxgenPath, args);
+            _exit(127);
+        }
+
+        // NOTE: ru_maxrss is provided in KB on Linux, in bytes on macOS
+        int status = 0;
+        struct rusage usage = { 0 };
+
+        if ((pid < 0) || (wait4(pid, &status, 0, &usage) < 0) || !WIFEXITED(status) || (WEXITSTATUS(status) == 127))
+        {
+            printf("WARNING: [%s] rfxgen process could not be executed\n", rfxgenPath);
+            success = false;
+            break;
+        }
+
+        double time = GetBenchTime() - startTime;
+#if defined(__APPLE__)
+        long long peakRSS = usage.ru_maxrss/1024;
+#else
+        long long peakRSS = usage.ru_maxrss;
+#endif
+        struct stat outStat = { 0 };
+        long long outSize = (stat(outFileName, &outStat) == 0)? (long long)outStat.st_size : 0;
+
+        if (outSize <= 44)
+        {
+            printf("WARNING: [%s] Output file not written\n", outFileName);
+            success = false;
+        }
+
+        printf("%-16s %10.3f %10.1f %12.2f %12.2f\n", format, time, (double)dataSize/(1024*1024)/time, (double)outSize/(1024*1024), (double)peakRSS/1024);
+
+        remove(outFileName);
+    }
+
+    remove(inFileName);
+
+    return (success && checked);
+#endif
+}
+
+// Save transcoding synthetic input file (44100 Hz, 16 bit, stereo): frequency sweep and noise
+// NOTE: File is written by blocks, input size does not depend on available memory
+static bool SaveTranscodeInput(const char *fileName, unsigned int frameCount)
+{
+    FILE *inFile = fopen(fileName, "wb");
+
+    if (inFile == NULL) return false;
+
+    // Wave header, little-endian values
+    unsigned int dataSize = frameCount*4;
+    unsigned int values[] = { 36 + dataSize, 16, 0x00020001, 44100, 44100*4, 0x00100004, dataSize };
+    fwrite("RIFF", 1, 4, inFile); fwrite(&values[0], 4, 1, inFile);
+    fwrite("WAVEfmt ", 1, 8, inFile); fwrite(&values[1], 4, 5, inFile);
+    fwrite("data", 1, 4, inFile); fwrite(&values[6], 4, 1, inFile);
+
+    short *block = (short *)malloc(TRANSCODE_BLOCK_FRAMES*2*sizeof(short));
+    double phase = 0.0;
+    unsigned int noise = 1;
+
+    for (unsigned int i = 0; i < frameCount; i += TRANSCODE_BLOCK_FRAMES)
+    {
+        unsigned int count = ((frameCount - i) < TRANSCODE_BLOCK_FRAMES)? (frameCount - i) : TRANSCODE_BLOCK_FRAMES;
+
+        for (unsigned int j = 0; j < count; j++)
+        {
+            phase += 2.0*PI*(100.0 + ((i + j)%441000)/50.0)/44100.0;     // 100 Hz to 8920 Hz sweep every 10 seconds
+            noise = noise*1664525u + 1013904223u;
+            block[j*2] = (short)(sin(phase)*16000.0 + (double)(noise >> 20) - 2048.0);
+            block[j*2 + 1] = (short)(cos(phase)*16000.0);
+        }
+
+        fwrite(block, sizeof(short)*2, count, inFile);
+    }
+
+    free(block);
+
+    return (fclose(inFile) == 0);
+}
+
+// Check transcoding output against full wave conversion: LoadWave() and WaveFormat() on the same input
+// NOTE: Output converted by blocks must be identical, frames count and max sample difference are reported otherwise
+static bool CheckTranscode(const char *rfxgenPath, const char *outPath)
+{
+#if defined(_WIN32)
+    return false;
+#else
+    // Output formats: resampling, channels mixing and every sample size
+    const int formats[][3] = { { 44100, 16, 2 }, { 44100, 16, 1 }, { 22050, 16, 1 }, { 22050, 8, 2 }, { 22050, 32, 2 } };
+    const int formatCount = sizeof(formats)/sizeof(formats[0]);
+
+    char inFileName[512] = { 0 };
+    char outFileName[512] = { 0 };
+    snprintf(inFileName, 512, "%s/transcode_check_input.wav", outPath);
+    snprintf(outFileName, 512, "%s/transcode_check_output.wav", outPath);
+
+    if (!SaveTranscodeInput(inFileName, TRANSCODE_CHECK_FRAMES))
+    {
+        printf("WARNING: [%s] Input file could not be written\n", inFileName);
+        return false;
+    }
+
+    Wave input = LoadWave(inFileName);
+    bool success = (input.data != NULL);
+
+    printf("Conversion check: %s (%u frames) converted by blocks, compared with LoadWave() + WaveFormat()\n", inFileName, TRANSCODE_CHECK_FRAMES);
+
+    // NOTE: All formats are checked, differences are reported for every format
+    for (int i = 0; (i < formatCount) && (input.data != NULL); i++)
+    {
+        char format[64] = { 0 };
+        snprintf(format, 64, "%i,%i,%i", formats[i][0], formats[i][1], formats[i][2]);
+        char *args[8] = { (char *)rfxgenPath, "--input", inFileName, "--output", outFileName, "--format", format, NULL };
+
+        if (!RunRfxgenProcess(rfxgenPath, args, NULL))
+        {
+            printf("WARNING: [%s] rfxgen process could not be executed\n", rfxgenPath);
+            success = false;
+            break;
+        }
+
+        Wave reference = WaveCopy(input);
+        WaveFormat(&reference, formats[i][0], formats[i][1], formats[i][2]);
+        Wave output = LoadWave(outFileName);
+
+        unsigned int dataSize = reference.frameCount*reference.channels*reference.sampleSize/8;
+
+        if ((output.frameCount == reference.frameCount) && (output.channels == reference.channels) &&
+            (output.sampleSize == reference.sampleSize) && (memcmp(output.data, reference.data, dataSize) == 0))
+        {
+            printf("%-16s identical\n", format);
+        }
+        else
+        {
+            // Samples comparison over common frames
+            float maxError = 0.0f;
+
+            if ((output.data != NULL) && (output.channels == reference.channels))
+            {
+                float *outputSamples = LoadWaveSamples(output);
+                float *referenceSamples = LoadWaveSamples(reference);
+                unsigned int sampleCount = ((output.frameCount < reference.frameCount)? output.frameCount : reference.frameCount)*output.channels;
+
+                for (unsigned int s = 0; s < sampleCount; s++)
+                {
+                    float error = fabsf(outputSamples[s] - referenceSamples[s]);
+                    if (error > maxError) maxError = error;
+                }
+
+                UnloadWaveSamples(outputSamples);
+                UnloadWaveSamples(referenceSamples);
+            }
+
+            printf("%-16s DIFFERENT frames: %u, reference: %u, max sample difference: %.8f\n", format, output.frameCount, reference.frameCount, maxError);
+            success = false;
+        }
+
+        UnloadWave(output);
+        UnloadWave(reference);
+        remove(outFileName);
+    }
+
+    UnloadWave(input);
+    remove(inFileName);
+
+    return success;
+#endif
+}
+
+// Check .rfx output streamed to stdout (converted by blocks) against file output (full wave converted)
+// NOTE: Standard output is redirected to a seekable file, wave header sizes are updated: files must be identical
+static bool CheckStreamOutput(const char *rfxgenPath, const char *outPath)
+{
+#if defined(_WIN32)
+    return false;
+#else
+    // Output formats: sample rates, sample sizes and channels other than generated wave (44100 Hz, 32bit float, mono)
+    const int formats[][3] = { { 44100, 16, 1 }, { 22050, 16, 1 }, { 22050, 8, 2 }, { 22050, 32, 2 } };
+    const int formatCount = sizeof(formats)/sizeof(formats[0]);
+
+    char inFileName[512] = { 0 };
+    char fileOutName[512] = { 0 };
+    char streamOutName[512] = { 0 };
+    snprintf(inFileName, 512, "%s/stream_check.rfx", outPath);
+    snprintf(fileOutName, 512, "%s/stream_check_file.wav", outPath);
+    snprintf(streamOutName, 512, "%s/stream_check_stdout.wav", outPath);
+
+    // Long sound, several blocks streamed
+    SetRandomSeed(1);
+    WaveParams params = GenExplosion();
+    params.sustainTimeValue = 0.8f;
+    params.decayTimeValue = 0.8f;
+    SaveWaveParams(params, inFileName);
+
+    printf("\nStream check:     %s written to stdout, compared with file output\n", inFileName);
+
+    bool success = true;
+
+    for (int i = 0; i < formatCount; i++)
+    {
+        char format[64] = { 0 };
+        snprintf(format, 64, "%i,%i,%i", formats[i][0], formats[i][1], formats[i][2]);
+        char *fileArgs[8] = { (char *)rfxgenPath, "--input", inFileName, "--output", fileOutName, "--format", format, NULL };
+        char *streamArgs[10] = { (char *)rfxgenPath, "--input", inFileName, "--output", "-", "--output-format", "wav", "--format", format, NULL };
+
+        if (!RunRfxgenProcess(rfxgenPath, fileArgs, NULL) || !RunRfxgenProcess(rfxgenPath, streamArgs, streamOutName))
+        {
+            printf("WARNING: [%s] rfxgen process could not be executed\n", rfxgenPath);
+            success = false;
+            break;
+        }
+
+        long size = 0;
+
+        if (CompareFiles(fileOutName, streamOutName, &size)) printf("%-16s identical (%li bytes)\n", format, size);
+        else
+        {
+            printf("%-16s DIFFERENT from file output\n", format);
+            success = false;
+        }
+
+        remove(fileOutName);
+        remove(streamOutName);
+    }
+
+    remove(inFileName);
+
+    return success;
+#endif
+}
+
+// Compare files content, returns true if both files exist and are identical
+// NOTE: Size compared is the files size if identical
+static bool CompareFiles(const char *fileName1, const char *fileName2, long *size)
+{
+    FILE *file1 = fopen(fileName1, "rb");
+    FILE *file2 = fopen(fileName2, "rb");
+    bool identical = ((file1 != NULL) && (file2 != NULL));
+    unsigned char block1[4096] = { 0 };
+    unsigned char block2[4096] = { 0 };
+
+    *size = 0;
+
+    while (identical)
+    {
+        size_t count1 = fread(block1, 1, sizeof(block1), file1);
+        size_t count2 = fread(block2, 1, sizeof(block2), file2);
+
+        identical = ((count1 == count2) && (memcmp(block1, block2, count1) == 0));
+        *size += (long)count1;
+
+        if (count1 < sizeof(block1)) break;
+    }
+
+    if (file1 != NULL) fclose(file1);
+    if (file2 != NULL) fclose(file2);
+
+    return identical;
+}
+
+// Get process CPU time (seconds): user and system, Linux only (/proc/<pid>/stat fields 14 and 15)
+// NOTE: Process name (field 2) could contain spaces, fields are read after its closing parenthesis
+static bool GetProcessCpuTime(pid_t pid, double *userTime, double *systemTime)
+{
+#if !defined(__linux__)
+    return false;
+#else
+    char fileName[64] = { 0 };
+    char stat[1024] = { 0 };
+    snprintf(fileName, 64, "/proc/%i/stat", (int)pid);
+
+    FILE *file = fopen(fileName, "rt");
+    if (file == NULL) return false;
+
+    size_t size = fread(stat, 1, sizeof(stat) - 1, file);
+    fclose(file);
+    stat[size] = '\0';
+
+    char *fields = strrchr(stat, ')');
+    unsigned long userTicks = 0;
+    unsigned long systemTicks = 0;
+
+    if ((fields == NULL) || (sscanf(fields + 1, " %*c %*d %*d %*d %*d %*d %*u %*u %*u %*u %*u %lu %lu", &userTicks, &systemTicks) != 2)) return false;
+
+    long ticksPerSecond = sysconf(_SC_CLK_TCK);
+    *userTime = (double)userTicks/ticksPerSecond;
+    *systemTime = (double)systemTicks/ticksPerSecond;
+
+    return true;
+#endif
+}
+
+// Get process main thread wakeups: voluntary context switches, Linux only (/proc/<pid>/status)
+// NOTE: Main thread blocks once per processed frame (frame time wait or events waiting), audio thread not included
+static bool GetProcessWakeups(pid_t pid, unsigned long *wakeups)
+{
+#if !defined(__linux__)
+    return false;
+#else
+    char fileName[64] = { 0 };
+    char line[256] = { 0 };
+    snprintf(fileName, 64, "/proc/%i/status", (int)pid);
+
+    FILE *file = fopen(fileName, "rt");
+    if (file == NULL) return false;
+
+    bool found = false;
+
+    while (!found && (fgets(line, sizeof(line), file) != NULL)) found = (sscanf(line, "voluntary_ctxt_switches: %lu", wakeups) == 1);
+
+    fclose(file);
+
+    return found;
+#endif
+}
+
+// Run rfxgen process with provided arguments, standard output written to file (NULL: discarded)
+// NOTE: Standard error is discarded, returns true if process exited with status 0
+#if !defined(_WIN32)
+static bool RunRfxgenProcess(const char *rfxgenPath, char **args, const char *outFileName)
+{
+    fflush(stdout);
+    pid_t pid = fork();
+
+    if (pid == 0)
+    {
+        int devNull = open("/dev/null", O_WRONLY);
+        int outFile = (outFileName != NULL)? open(outFileName, O_WRONLY | O_CREAT | O_TRUNC, 0644) : devNull;
+        dup2(outFile, STDOUT_FILENO);
+        dup2(devNull, STDERR_FILENO);
+        close(devNull);
+        if (outFile != devNull) close(outFile);
+        execv(rfxgenPath, args);
+        _exit(127);
+    }
+
+    int status = 0;
+
+    return ((pid > 0) && (waitpid(pid, &status, 0) == pid) && WIFEXITED(status) && (WEXITSTATUS(status) == 0));
+}
+#endif
+
+// Measure rfxgen serve mode: server launched, pipelined render requests sent on one connection
+// NOTE: Responses are verified against local renders, a not valid format request must be responded as error
+static bool RunServe(const char *rfxgenPath, int requestCount, int jobCount)
+{
+#if defined(_WIN32)
+    printf("WARNING: Serve benchmark not supported on this platform\n");
+    return false;
+#else
+    // Local renders: corpus sounds as raw 44100 Hz, 16 bit, mono data
+    BenchCase cases[BENCH_MAX_CASES] = { 0 };
+    int caseCount = LoadBenchCorpus(cases, BENCH_MAX_CASES);
+    Wave renders[BENCH_MAX_CASES] = { 0 };
+
+    for (int i = 0; i < caseCount; i++)
+    {
+        renders[i] = GenerateWave(cases[i].params);
+        WaveFormat(&renders[i], 44100, 16, 1);
+    }
+
+    char jobs[16] = { 0 };
+    snprintf(jobs, 16, "%i", jobCount);
+    char *args[7] = { (char *)rfxgenPath, "--serve", SERVE_SOCKET_PATH, "--no-cache", (jobCount > 0)? "--jobs" : NULL, jobs, NULL };
+
+    fflush(stdout);
+    pid_t pid = fork();
+
+    if (pid == 0)
+    {
+        // Child process: output discarded
+        int devNull = open("/dev/null", O_WRONLY);
+        dup2(devNull, STDOUT_FILENO);
+        dup2(devNull, STDERR_FILENO);
+        close(devNull);
+        execv(rfxgenPath, args);
+        _exit(127);
+    }
+
+    // Connect to server once its socket is listening
+    struct sockaddr_un address = { 0 };
+    address.sun_family = AF_UNIX;
+    strcpy(address.sun_path, SERVE_SOCKET_PATH);
+
+    int clientSocket = -1;
+    double startTime = GetBenchTime();
+
+    while ((pid > 0) && ((GetBenchTime() - startTime) < SERVE_STARTUP_TIMEOUT))
+    {
+        clientSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (connect(clientSocket, (struct sockaddr *)&address, sizeof(address)) == 0) break;
+
+        close(clientSocket);
+        clientSocket = -1;
+        usleep(10000);
+    }
+
+    if (clientSocket < 0)
+    {
+        printf("WARNING: [%s] rfxgen serve mode could not be connected\n", rfxgenPath);
+        if (pid > 0) { kill(pid, SIGTERM); waitpid(pid, NULL, 0); }
+        for (int i = 0; i < caseCount; i++) UnloadWave(renders[i]);
+        return false;
+    }
+
+    double *sentTime = (double *)calloc(requestCount, sizeof(double));
+    double *latencies = (double *)calloc(requestCount, sizeof(double));
+    long long bytesReceived = 0;
+    int failedCount = 0;
+    int sentCount = 0;
+    bool success = true;
+
+    startTime = GetBenchTime();
+
+    // Requests pipelined: a new request is sent for every response received, SERVE_PIPELINE_DEPTH in flight
+    for (int i = 0; (i < requestCount) && success; i++)
+    {
+        while ((sentCount < requestCount) && (sentCount < (i + SERVE_PIPELINE_DEPTH)) && success)
+        {
+            sentTime[sentCount] = GetBenchTime();
+            success = SendServeRequest(clientSocket, "RNDR", cases[sentCount%caseCount].params, 44100, 16, 1);
+            sentCount++;
+        }
+
+        unsigned int status = 0;
+        unsigned int dataSize = 0;
+        unsigned char *data = success? RecvServeResponse(clientSocket, &status, &dataSize) : NULL;
+
+        if (data == NULL) success = false;
+        else
+        {
+            latencies[i] = GetBenchTime() - sentTime[i];
+            bytesReceived += dataSize;
+
+            Wave *render = &renders[i%caseCount];
+            if ((status != 0) || (dataSize != render->frameCount*2) || (memcmp(data, render->data, dataSize) != 0)) failedCount++;
+
+            free(data);
+        }
+    }
+
+    double totalTime = GetBenchTime() - startTime;
+
+    if (!success) printf("WARNING: Serve connection lost\n");
+
+    // Not valid format responded as error, server stats requested (server side throughput and latency)
+    unsigned int status = 0;
+    unsigned int dataSize = 0;
+    unsigned char *data = NULL;
+
+    if (success && SendServeRequest(clientSocket, "RNDR", cases[0].params, 48000, 16, 1) && ((data = RecvServeResponse(clientSocket, &status, &dataSize)) != NULL))
+    {
+        if (status == 0) failedCount++;
+        free(data);
+    }
+    else success = false;
+
+    if (success && SendServeRequest(clientSocket, "STAT", (WaveParams){ 0 }, 0, 0, 0) && ((data = RecvServeResponse(clientSocket, &status, &dataSize)) != NULL))
+    {
+        qsort(latencies, requestCount, sizeof(double), CompareDouble);
+
+        printf("Executable:       %s (%s worker threads)\n", rfxgenPath, (jobCount > 0)? jobs : "default");
+        printf("Requests:         %i (%i in flight, raw 44100 Hz, 16 bit, mono), %i failed\n", requestCount, SERVE_PIPELINE_DEPTH, failedCount);
+        printf("Throughput:       %.1f requests/s, %.2f MB/s\n", requestCount/totalTime, (double)bytesReceived/(1024*1024)/totalTime);
+        printf("Latency:          p50 %.3f ms, p99 %.3f ms, max %.3f ms\n", latencies[(requestCount - 1)*50/100]*1e3,
+               latencies[(requestCount - 1)*99/100]*1e3, latencies[requestCount - 1]*1e3);
+        printf("Server stats:     %.*s\n", (int)dataSize, (char *)data);
+
+        free(data);
+    }
+    else success = false;
+
+    close(clientSocket);
+    free(sentTime);
+    free(latencies);
+    for (int i = 0; i < caseCount; i++) UnloadWave(renders[i]);
+
+    // Server stopped, socket file must be removed on exit
+    int exitStatus = 0;
+    kill(pid, SIGTERM);
+
+    if ((waitpid(pid, &exitStatus, 0) < 0) || !WIFEXITED(exitStatus) || (access(SERVE_SOCKET_PATH, F_OK) == 0))
+    {
+        printf("WARNING: rfxgen serve mode not finished properly\n");
+        success = false;
+    }
+
+    return (success && (failedCount == 0));
+#endif
+}
+
+#if !defined(_WIN32)
+// Send serve request, little-endian values, .rfx file data written for render requests
+static bool SendServeRequest(int clientSocket, const char *command, WaveParams params, int sampleRate, int sampleSize, int channels)
+{
+    unsigned char request[16 + RFX_FILE_SIZE] = { 0 };
+    unsigned int values[4] = { (unsigned int)sampleRate, (unsigned int)sampleSize, (unsigned int)channels, 1 };     // Output format: raw
+    int requestSize = 16;
+
+    memcpy(request, command, 4);
+    for (int i = 0; i < 4; i++) request[4 + i] = (unsigned char)((values[0] >> (8*i)) & 0xff);
+    for (int i = 0; i < 2; i++) request[8 + i] = (unsigned char)((values[1] >> (8*i)) & 0xff);
+    for (int i = 0; i < 2; i++) request[10 + i] = (unsigned char)((values[2] >> (8*i)) & 0xff);
+    for (int i = 0; i < 4; i++) request[12 + i] = (unsigned char)((values[3] >> (8*i)) & 0xff);
+
+    if (strcmp(command, "RNDR") == 0)
+    {
+        // .rfx file data: signature, version (200), parameters length, parameters
+        unsigned short header[2] = { 200, RFX_PARAMS_SIZE };
+        memcpy(request + 16, "rFX ", 4);
+        memcpy(request + 20, header, 4);
+        memcpy(request + 24, &params, RFX_PARAMS_SIZE);
+        requestSize += RFX_FILE_SIZE;
+    }
+
+    for (int sent = 0; sent < requestSize; )
+    {
+        ssize_t bytesSent = send(clientSocket, request + sent, requestSize - sent, 0);
+        if (bytesSent <= 0) return false;
+        sent += (int)bytesSent;
+    }
+
+    return true;
+}
+
+// Receive serve response: status, data size and data, NULL returned on connection error
+static unsigned char *RecvServeResponse(int clientSocket, unsigned int *status, unsigned int *dataSize)
+{
+    unsigned char header[8] = { 0 };
+
+    for (int received = 0; received < 8; )
+    {
+        ssize_t bytesRead = recv(clientSocket, header + received, 8 - received, 0);
+        if (bytesRead <= 0) return NULL;
+        received += (int)bytesRead;
+    }
+
+    *status = header[0] | (header[1] << 8) | (header[2] << 16) | ((unsigned int)header[3] << 24);
+    *dataSize = header[4] | (header[5] << 8) | (header[6] << 16) | ((unsigned int)header[7] << 24);
+
+    unsigned char *data = (unsigned char *)malloc(*dataSize + 1);
+
+    for (unsigned int received = 0; received < *dataSize; )
+    {
+        ssize_t bytesRead = recv(clientSocket, data + received, *dataSize - received, 0);
+        if (bytesRead <= 0) { free(data); return NULL; }
+        received += (unsigned int)bytesRead;
+    }
+
+    return data;
+}
+#endif
+
+// Load verification cases: benchmarks corpus and parameters coverage
+// NOTE: Every parameter is set on a base sound for every wave type, mutated cases set values
+// out of sliders range as repeated WaveMutate() calls do (they must not be limited to [-1..1])
+static int LoadReferenceCases(BenchCase *cases, int maxCount)
+{
+    static const char *waveTypeNames[4] = { "square", "sawtooth", "sine", "noise" };
+    static const ParamCoverage coverage[] = {
+        { "attack", offsetof(WaveParams, attackTimeValue), 0.3f, -1, 0.0f },
+        { "sustain", offsetof(WaveParams, sustainTimeValue), 0.5f, -1, 0.0f },
+        { "punch", offsetof(WaveParams, sustainPunchValue), 0.5f, -1, 0.0f },
+        { "decay", offsetof(WaveParams, decayTimeValue), 0.6f, -1, 0.0f },
+        { "frequency", offsetof(WaveParams, startFrequencyValue), 0.6f, -1, 0.0f },
+        { "min-frequency", offsetof(WaveParams, minFrequencyValue), 0.2f, offsetof(WaveParams, slideValue), -0.3f },
+        { "slide", offsetof(WaveParams, slideValue), 0.3f, -1, 0.0f },
+        { "delta-slide", offsetof(WaveParams, deltaSlideValue), -0.2f, -1, 0.0f },
+        { "vibrato-depth", offsetof(WaveParams, vibratoDepthValue), 0.5f, -1, 0.0f },
+        { "vibrato-speed", offsetof(WaveParams, vibratoSpeedValue), 0.7f, offsetof(WaveParams, vibratoDepthValue), 0.3f },
+        { "change-amount", offsetof(WaveParams, changeAmountValue), -0.5f, -1, 0.0f },
+        { "change-speed", offsetof(WaveParams, changeSpeedValue), 0.6f, offsetof(WaveParams, changeAmountValue), 0.4f },
+        { "square-duty", offsetof(WaveParams, squareDutyValue), 0.8f, -1, 0.0f },
+        { "duty-sweep", offsetof(WaveParams, dutySweepValue), 0.3f, -1, 0.0f },
+        { "repeat-speed", offsetof(WaveParams, repeatSpeedValue), 0.5f, -1, 0.0f },
+        { "phaser-offset", offsetof(WaveParams, phaserOffsetValue), 0.3f, -1, 0.0f },
+        { "phaser-sweep", offsetof(WaveParams, phaserSweepValue), -0.2f, offsetof(WaveParams, phaserOffsetValue), 0.2f },
+        { "lpf-cutoff", offsetof(WaveParams, lpfCutoffValue), 0.3f, -1, 0.0f },
+        { "lpf-sweep", offsetof(WaveParams, lpfCutoffSweepValue), 0.2f, offsetof(WaveParams, lpfCutoffValue), 0.5f },
+        { "lpf-resonance", offsetof(WaveParams, lpfResonanceValue), 0.6f, offsetof(WaveParams, lpfCutoffValue), 0.5f },
+        { "hpf-cutoff", offsetof(WaveParams, hpfCutoffValue), 0.3f, -1, 0.0f },
+        { "hpf-sweep", offsetof(WaveParams, hpfCutoffSweepValue), 0.2f, offsetof(WaveParams, hpfCutoffValue), 0.1f }
+    };
+    static const ParamCoverage mutated[] = {
+        { "attack", offsetof(WaveParams, attackTimeValue), 1.03f, -1, 0.0f },
+        { "frequency", offsetof(WaveParams, startFrequencyValue), 1.05f, -1, 0.0f },
+        { "vibrato-depth", offsetof(WaveParams, vibratoDepthValue), 1.04f, offsetof(WaveParams, vibratoSpeedValue), 0.3f },
+        { "change-amount", offsetof(WaveParams, changeAmountValue), 1.06f, offsetof(WaveParams, changeSpeedValue), 0.4f },
+        { "sustain", offsetof(WaveParams, sustainTimeValue), 1.05f, -1, 0.0f },
+        { "duty-sweep", offsetof(WaveParams, dutySweepValue), -1.05f, offsetof(WaveParams, squareDutyValue), 0.5f },
+        { "lpf-cutoff", offsetof(WaveParams, lpfCutoffValue), 1.04f, offsetof(WaveParams, lpfResonanceValue), 0.5f },
+        { "hpf-cutoff", offsetof(WaveParams, hpfCutoffValue), 1.05f, offsetof(WaveParams, hpfCutoffSweepValue), -0.2f }
+    };
+
+    int count = LoadBenchCorpus(cases, maxCount);
+
+    for (int type = 0; type < 4; type++)
+    {
+        for (int p = 0; (p < (int)(sizeof(coverage)/sizeof(ParamCoverage))) && (count < maxCount); p++)
+        {
+            WaveParams *params = &cases[count].params;
+
+            SetRandomSeed(1);
+            ResetWaveParams(params);
+            params->waveTypeValue = type;
+
+            if (coverage[p].dependencyOffset >= 0) *(float *)((char *)params + coverage[p].dependencyOffset) = coverage[p].dependencyValue;
+            *(float *)((char *)params + coverage[p].offset) = coverage[p].value;
+
+            snprintf(cases[count].name, 64, "param-%s-%s", waveTypeNames[type], coverage[p].name);
+            count++;
+        }
+    }
+
+    for (int p = 0; (p < (int)(sizeof(mutated)/sizeof(ParamCoverage))) && (count < maxCount); p++)
+    {
+        WaveParams *params = &cases[count].params;
+
+        SetRandomSeed(1);
+        ResetWaveParams(params);
+
+        if (mutated[p].dependencyOffset >= 0) *(float *)((char *)params + mutated[p].dependencyOffset) = mutated[p].dependencyValue;
+        *(float *)((char *)params + mutated[p].offset) = mutated[p].value;
+
+        snprintf(cases[count].name, 64, "mutated-%s", mutated[p].name);
+        count++;
+    }
+
+    return count;
+}
+
+// Get wave data checksum (FNV-1a 64 bit)
+static unsigned long long GetWaveChecksum(Wave wave)
+{
+    unsigned long long hash = 14695981039346656037ULL;
+    const unsigned char *data = (const unsigned char *)wave.data;
+    unsigned int size = wave.frameCount*wave.channels*wave.sampleSize/8;
+
+    for (unsigned int i = 0; i < size; i++)
+    {
+        hash ^= data[i];
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+// Save reference fixtures: verification cases as .rfx files and golden frames count and checksums (text file)
+// NOTE: Golden renders are generated from fixtures loaded back, fixtures must reproduce cases parameters
+static bool SaveReferenceFixtures(const char *dirPath)
+{
+    if (!MakeBenchDirectory(dirPath))
+    {
+        printf("WARNING: [%s] Fixtures directory could not be created\n", dirPath);
+        return false;
+    }
+
+    BenchCase *cases = (BenchCase *)calloc(REFERENCE_MAX_CASES, sizeof(BenchCase));
+    int caseCount = LoadReferenceCases(cases, REFERENCE_MAX_CASES);
+
+    char goldenFileName[512] = { 0 };
+    snprintf(goldenFileName, 512, "%s/%s", dirPath, REFERENCE_GOLDEN_FILE);
+    FILE *file = fopen(goldenFileName, "wt");
+
+    if (file == NULL)
+    {
+        printf("WARNING: [%s] Golden file could not be saved\n", goldenFileName);
+        free(cases);
+        return false;
+    }
+
+    fprintf(file, "# rFXGen reference renders: <fixture name> <frames count> <checksum>\n");
+    fprintf(file, "# NOTE: Fixtures are <fixture name>.rfx files, checksum is FNV-1a 64 bit of generated samples (32 bit float)\n");
+
+    bool success = true;
+
+    for (int i = 0; (i < caseCount) && success; i++)
+    {
+        char fixtureFileName[512] = { 0 };
+        snprintf(fixtureFileName, 512, "%s/%s.rfx", dirPath, cases[i].name);
+
+        SaveWaveParams(cases[i].params, fixtureFileName);
+        WaveParams params = LoadWaveParamsRFX(fixtureFileName);
+
+        if (memcmp(&params, &cases[i].params, sizeof(WaveParams)) != 0)
+        {
+            printf("WARNING: [%s] Fixture could not be saved, parameters not reproduced\n", fixtureFileName);
+            success = false;
+            break;
+        }
+
+        Wave wave = GenerateWave(params);
+        fprintf(file, "%s %u 0x%016llx\n", cases[i].name, wave.frameCount, GetWaveChecksum(wave));
+        UnloadWave(wave);
+    }
+
+    fclose(file);
+    free(cases);
+
+    if (success) printf("Fixtures saved: %s (%i cases, golden renders: %s)\n", dirPath, caseCount, REFERENCE_GOLDEN_FILE);
+
+    return success;
+}
+
+// Load reference fixtures: golden frames count and checksums, parameters loaded from .rfx files
+// NOTE: Returns -1 if golden file is not available, fixtures not valid are loaded with empty parameters (no seed)
+static int LoadReferenceFixtures(const char *dirPath, ReferenceCase *cases, int maxCount)
+{
+    char goldenFileName[512] = { 0 };
+    snprintf(goldenFileName, 512, "%s/%s", dirPath, REFERENCE_GOLDEN_FILE);
+    FILE *file = fopen(goldenFileName, "rt");
+
+    if (file == NULL) return -1;
+
+    char line[256] = { 0 };
+    int count = 0;
+
+    while ((count < maxCount) && (fgets(line, sizeof(line), file) != NULL))
+    {
+        ReferenceCase *reference = &cases[count];
+
+        if ((line[0] == '#') || (sscanf(line, "%63s %u %llx", reference->name, &reference->frameCount, &reference->checksum) != 3)) continue;
+
+        char fixtureFileName[512] = { 0 };
+        snprintf(fixtureFileName, 512, "%s/%s.rfx", dirPath, reference->name);
+        reference->params = LoadWaveParamsRFX(fixtureFileName);
+
+        count++;
+    }
+
+    fclose(file);
+
+    return count;
+}
+
+// Save reference renders file: fixtures generated samples, used to report diverging samples on verification
+// NOTE: File layout: "rFXR", version, cases count, then per case: name[64], frames count, checksum and samples (32 bit float)
+static bool SaveReference(const char *dirPath, const char *fileName)
+{
+    ReferenceCase *cases = (ReferenceCase *)calloc(REFERENCE_MAX_CASES, sizeof(ReferenceCase));
+    int caseCount = LoadReferenceFixtures(dirPath, cases, REFERENCE_MAX_CASES);
+
+    if (caseCount < 0)
+    {
+        printf("WARNING: [%s] Reference fixtures not available\n", dirPath);
+        free(cases);
+        return false;
+    }
+
+    FILE *file = fopen(fileName, "wb");
+
+    if (file == NULL)
+    {
+        printf("WARNING: [%s] Reference file could not be saved\n", fileName);
+        free(cases);
+        return false;
+    }
+
+    int version = REFERENCE_FILE_VERSION;
+    fwrite("rFXR", 1, 4, file);
+    fwrite(&version, sizeof(int), 1, file);
+    fwrite(&caseCount, sizeof(int), 1, file);
+
+    long long totalFrames = 0;
+
+    for (int i = 0; i < caseCount; i++)
+    {
+        Wave wave = GenerateWave(cases[i].params);
+        unsigned long long checksum = GetWaveChecksum(wave);
+
+        fwrite(cases[i].name, 1, 64, file);
+        fwrite(&wave.frameCount, sizeof(unsigned int), 1, file);
+        fwrite(&checksum, sizeof(unsigned long long), 1, file);
+        fwrite(wave.data, sizeof(float), wave.frameCount, file);
+
+        totalFrames += wave.frameCount;
+        UnloadWave(wave);
+    }
+
+    fclose(file);
+    free(cases);
+
+    printf("Reference saved: %s (%i cases, %lld samples)\n", fileName, caseCount, totalFrames);
+
+    return true;
+}
+
+// Load reference renders file case samples, NULL if file or case are not available
+static float *LoadReferenceSamples(const char *fileName, const char *name, unsigned int *frameCount)
+{
+    FILE *file = fopen(fileName, "rb");
+
+    if (file == NULL) return NULL;
+
+    char signature[4] = { 0 };
+    int version = 0;
+    int referenceCount = 0;
+    float *samples = NULL;
+
+    if ((fread(signature, 1, 4, file) == 4) && (memcmp(signature, "rFXR", 4) == 0) &&
+        (fread(&version, sizeof(int), 1, file) == 1) && (version == REFERENCE_FILE_VERSION) &&
+        (fread(&referenceCount, sizeof(int), 1, file) == 1))
+    {
+        for (int r = 0; r < referenceCount; r++)
+        {
+            char caseName[65] = { 0 };
+            unsigned long long checksum = 0;
+
+            if ((fread(caseName, 1, 64, file) != 64) || (fread(frameCount, sizeof(unsigned int), 1, file) != 1) ||
+                (fread(&checksum, sizeof(unsigned long long), 1, file) != 1)) break;
+
+            if (strcmp(caseName, name) != 0)
+            {
+                if (fseek(file, (long)(*frameCount*sizeof(float)), SEEK_CUR) != 0) break;
+                continue;
+            }
+
+            samples = (float *)malloc((*frameCount + 1)*sizeof(float));
+
+            if (fread(samples, sizeof(float), *frameCount, file) != *frameCount)
+            {
+                free(samples);
+                samples = NULL;
+            }
+
+            break;
+        }
+    }
+
+    fclose(file);
+
+    return samples;
+}
+
+// Verify generated waves against reference fixtures: golden frames count and checksum
+// NOTE: Cases not identical are compared with reference renders samples if available (tolerance, first diverging
+// sample and max error), they fail otherwise
+static bool VerifyReference(const char *dirPath, const char *samplesFileName, float tolerance)
+{
+    ReferenceCase *cases = (ReferenceCase *)calloc(REFERENCE_MAX_CASES, sizeof(ReferenceCase));
+    int caseCount = LoadReferenceFixtures(dirPath, cases, REFERENCE_MAX_CASES);
+
+    if (caseCount < 0)
+    {
+        printf("WARNING: [%s] Reference fixtures not available\n", dirPath);
+        free(cases);
+        return false;
+    }
+
+    int identicalCount = 0;
+    int toleranceCount = 0;
+    int failedCount = 0;
+    double startTime = GetBenchTime();
+
+    for (int c = 0; c < caseCount; c++)
+    {
+        const ReferenceCase *reference = &cases[c];
+
+        // NOTE: Valid fixtures always have a random seed (ResetWaveParams())
+        if (reference->params.randSeed == 0)
+        {
+            printf("FAIL  %-36s fixture not valid\n", reference->name);
+            failedCount++;
+            continue;
+        }
+
+        Wave wave = GenerateWave(reference->params);
+        const float *samples = (const float *)wave.data;
+
+        if ((wave.frameCount == reference->frameCount) && (GetWaveChecksum(wave) == reference->checksum)) identicalCount++;
+        else
+        {
+            unsigned int frameCount = 0;
+            float *referenceSamples = (samplesFileName != NULL)? LoadReferenceSamples(samplesFileName, reference->name, &frameCount) : NULL;
+
+            if (referenceSamples == NULL)
+            {
+                printf("FAIL  %-36s", reference->name);
+                if (wave.frameCount != reference->frameCount) printf(" frames: %u, reference: %u,", wave.frameCount, reference->frameCount);
+                printf(" checksum differs (reference samples not available)\n");
+                failedCount++;
+            }
+            else
+            {
+                // Samples comparison, frames count difference is a failure
+                unsigned int compareCount = (wave.frameCount < frameCount)? wave.frameCount : frameCount;
+                int firstDiverging = -1;
+                int maxErrorIndex = 0;
+                float maxError = 0.0f;
+
+                for (unsigned int i = 0; i < compareCount; i++)
+                {
+                    float error = fabsf(samples[i] - referenceSamples[i]);
+
+                    if ((error > tolerance) && (firstDiverging < 0)) firstDiverging = (int)i;
+                    if (error > maxError) { maxError = error; maxErrorIndex = (int)i; }
+                }
+
+                if ((wave.frameCount == reference->frameCount) && (wave.frameCount == frameCount) && (firstDiverging < 0))
+                {
+                    printf("OK    %-36s max error: %.8f (sample %i)\n", reference->name, maxError, maxErrorIndex);
+                    toleranceCount++;
+                }
+                else
+                {
+                    printf("FAIL  %-36s", reference->name);
+                    if (wave.frameCount != reference->frameCount) printf(" frames: %u, reference: %u,", wave.frameCount, reference->frameCount);
+                    if (firstDiverging >= 0) printf(" first diverging sample: %i (%.8f, reference: %.8f),", firstDiverging, samples[firstDiverging], referenceSamples[firstDiverging]);
+                    printf(" max error: %.8f (sample %i)\n", maxError, maxErrorIndex);
+                    failedCount++;
+                }
+
+                free(referenceSamples);
+            }
+        }
+
+        UnloadWave(wave);
+    }
+
+    printf("Verified %i cases in %.3f s: %i identical, %i within tolerance (%.8f), %i failed\n", identicalCount + toleranceCount + failedCount,
+           GetBenchTime() - startTime, identicalCount, toleranceCount, tolerance, failedCount);
+
+    free(cases);
+
+    return (failedCount == 0);
+}
+
+// Stress task function: generate wave and check invariants
+static void StressTaskFunc(void *data)
+{
+    StressTask *stress = (StressTask *)data;
+
+    stress->failureSample = -1;
+
+    double startTime = GetBenchThreadTime();
+    Wave wave = GenerateWave(stress->params);
+    stress->time = GetBenchThreadTime() - startTime;
+
+    stress->frameCount = wave.frameCount;
+
+    if ((stress->maxTime > 0.0) && (stress->time > stress->maxTime)) stress->failures |= STRESS_FAILURE_TIME;
+
+    if ((wave.frameCount == 0) || (wave.data == NULL)) stress->failures |= STRESS_FAILURE_EMPTY;
+    else if ((wave.frameCount > STRESS_MAX_FRAMES) || (wave.sampleSize != 32) || (wave.channels != 1)) stress->failures |= STRESS_FAILURE_LENGTH;
+    else
+    {
+        const float *samples = (const float *)wave.data;
+
+        for (unsigned int i = 0; i < wave.frameCount; i++)
+        {
+            if (!isfinite(samples[i]))
+            {
+                if (!(stress->failures & STRESS_FAILURE_NOT_FINITE) && (stress->failureSample < 0)) stress->failureSample = (int)i;
+                stress->failures |= STRESS_FAILURE_NOT_FINITE;
+            }
+            else
+            {
+                if (fabsf(samples[i]) > stress->maxSample) stress->maxSample = fabsf(samples[i]);
+
+                if (fabsf(samples[i]) > 1.0f)
+                {
+                    if (!(stress->failures & STRESS_FAILURE_RANGE) && (stress->failureSample < 0)) stress->failureSample = (int)i;
+                    stress->failures |= STRESS_FAILURE_RANGE;
+                }
+            }
+        }
+
+        if (stress->checkDeterminism)
+        {
+            Wave check = GenerateWave(stress->params);
+
+            if ((check.frameCount != wave.frameCount) || (memcmp(check.data, wave.data, wave.frameCount*sizeof(float)) != 0)) stress->failures |= STRESS_FAILURE_DETERMINISM;
+
+            UnloadWave(check);
+        }
+
+        if (stress->checkCanonical)
+        {
+            // NOTE: Canonical parameters must generate the same wave, canonicalization must be idempotent
+            WaveParams canonical = CanonicalizeWaveParams(stress->params);
+            WaveParams recanonical = CanonicalizeWaveParams(canonical);
+            Wave check = GenerateWave(canonical);
+
+            if ((check.frameCount != wave.frameCount) || (memcmp(check.data, wave.data, wave.frameCount*sizeof(float)) != 0) ||
+                (memcmp(&recanonical, &canonical, sizeof(WaveParams)) != 0) ||
+                (GetWaveParamsHash(canonical) != GetWaveParamsHash(stress->params))) stress->failures |= STRESS_FAILURE_CANONICAL;
+
+            UnloadWave(check);
+        }
+    }
+
+    UnloadWave(wave);
+}
+
+// Get stress wave parameters from source, raylib random generator is used
+// NOTE: Raw values are drawn in [-4..4] range, one in 16 values is a special value (non-finite, limits, denormal)
+static WaveParams GetStressParams(int source)
+{
+    static const float specialValues[9] = { NAN, INFINITY, -INFINITY, 0.0f, 1.0f, -1.0f, FLT_MAX, -FLT_MAX, 1e-40f };
+    WaveParams params = { 0 };
+
+    switch (source)
+    {
+        case STRESS_SOURCE_PRESET:
+        {
+            switch (GetRandomValue(0, 6))
+            {
+                case 0: params = GenPickupCoin(); break;
+                case 1: params = GenLaserShoot(); break;
+                case 2: params = GenExplosion(); break;
+                case 3: params = GenPowerup(); break;
+                case 4: params = GenHitHurt(); break;
+                case 5: params = GenJump(); break;
+                case 6: params = GenBlipSelect(); break;
+                default: break;
+            }
+        } break;
+        case STRESS_SOURCE_RANDOMIZE: params = GenRandomize(); break;
+        case STRESS_SOURCE_MUTATE:
+        {
+            params = GenRandomize();
+
+            // NOTE: WaveMutate() refreshes seed with time(NULL), saved parameters are required to reproduce
+            int mutations = GetRandomValue(1, 32);
+            for (int i = 0; i < mutations; i++) WaveMutate(&params);
+        } break;
+        case STRESS_SOURCE_RAW:
+        {
+            float *values = &params.attackTimeValue;
+            int valueCount = (int)((sizeof(WaveParams) - offsetof(WaveParams, attackTimeValue))/sizeof(float));
+
+            params.randSeed = GetRandomValue(0, 0xFFFE);
+            params.waveTypeValue = GetRandomValue(-2, 6);
+
+            for (int i = 0; i < valueCount; i++)
+            {
+                if (GetRandomValue(0, 15) == 0) values[i] = specialValues[GetRandomValue(0, 8)];
+                else values[i] = (float)GetRandomValue(-40000, 40000)/10000.0f;
+            }
+        } break;
+        default: break;
+    }
+
+    return params;
+}
+
+// Run stress mode, returns true if all invariants passed
+// NOTE: Parameters are drawn on main thread (raylib random generator is not thread-safe),
+// every iteration is seeded with seed*100003 + iteration, waves are generated and checked on worker threads
+static bool RunStress(int count, unsigned int seed, int jobCount, double maxTime)
+{
+    static const char *sourceNames[STRESS_SOURCE_COUNT] = { "preset", "randomize", "mutate", "raw" };
+    static const char *failureNames[7] = { "empty wave", "wave length/format", "non-finite samples", "samples out of range", "not deterministic", "generation time", "not canonical" };
+
+    StressTask *tasks = (StressTask *)calloc(STRESS_BATCH_SIZE, sizeof(StressTask));
+    WorkerPool *pool = LoadWorkerPool(jobCount);
+
+    int failureCount[7] = { 0 };
+    int failedCount = 0;
+    int reportCount = 0;
+    long long totalFrames = 0;
+    double maxSoundTime = 0.0;
+    double totalSoundTime = 0.0;
+    float maxSample = 0.0f;
+    int progressStep = (count >= 10)? count/10 : 1;
+
+    printf("Stress: %i sounds, seed: %u, worker threads: %i\n", count, seed, GetWorkerPoolThreadCount(pool));
+    if (maxTime > 0.0) printf("Max generation CPU time per sound: %.3f s\n", maxTime);
+
+    double startTime = GetBenchTime();
+
+    for (int first = 0; first < count; first += STRESS_BATCH_SIZE)
+    {
+        int batchCount = ((first + STRESS_BATCH_SIZE) <= count)? STRESS_BATCH_SIZE : (count - first);
+
+        for (int i = 0; i < batchCount; i++)
+        {
+            StressTask *stress = &tasks[i];
+            memset(stress, 0, sizeof(StressTask));
+
+            SetRandomSeed(seed*100003u + (unsigned int)(first + i));
+
+            stress->iteration = first + i;
+            stress->source = GetRandomValue(0, STRESS_SOURCE_COUNT - 1);
+            stress->params = GetStressParams(stress->source);
+            stress->checkDeterminism = ((stress->iteration%16) == 0);
+            stress->checkCanonical = ((stress->iteration%4) == 0);
+            stress->maxTime = maxTime;
+            stress->task.func = StressTaskFunc;
+            stress->task.data = stress;
+
+            WorkerPoolPush(pool, &stress->task);
+        }
+
+        WorkerPoolWait(pool);
+
+        for (int i = 0; i < batchCount; i++)
+        {
+            StressTask *stress = &tasks[i];
+
+            totalFrames += stress->frameCount;
+            totalSoundTime += stress->time;
+            if (stress->time > maxSoundTime) maxSoundTime = stress->time;
+            if (stress->maxSample > maxSample) maxSample = stress->maxSample;
+
+            if (stress->failures == 0) continue;
+
+            failedCount++;
+            for (int f = 0; f < 7; f++) if (stress->failures & (1 << f)) failureCount[f]++;
+
+            if (reportCount < STRESS_MAX_REPORTS)
+            {
+                char fileName[64] = { 0 };
+                snprintf(fileName, 64, "rfxgen_stress_%i.rfx", stress->iteration);
+                SaveWaveParams(stress->params, fileName);
+
+                printf("FAIL  iteration %i (%s), frames: %u, CPU time: %.3f s:", stress->iteration, sourceNames[stress->source], stress->frameCount, stress->time);
+                for (int f = 0; f < 7; f++) if (stress->failures & (1 << f)) printf(" [%s]", failureNames[f]);
+                if (stress->failureSample >= 0) printf(" first failing sample: %i", stress->failureSample);
+                printf(", parameters saved: %s\n", fileName);
+
+                reportCount++;
+            }
+        }
+
+        if (((first + batchCount)/progressStep) > (first/progressStep)) printf("    %i/%i sounds, %i failed\n", first + batchCount, count, failedCount);
+    }
+
+    double totalTime = GetBenchTime() - startTime;
+
+    printf("Stress completed in %.3f s: %.1f sounds/s, %.2f Msample/s, max sample: %.6f\n", totalTime,
+           count/totalTime, totalFrames/totalTime/1e6, maxSample);
+    printf("Generation CPU time per sound: mean %.3f ms, max %.3f ms, %.3f ms per second of audio\n", 1000.0*totalSoundTime/count,
+           1000.0*maxSoundTime, (totalFrames > 0)? 1000.0*totalSoundTime/((double)totalFrames/WAVE_SAMPLE_RATE) : 0.0);
+    printf("Sounds failed: %i/%i\n", failedCount, count);
+
+    for (int f = 0; f < 7; f++) if (failureCount[f] > 0) printf("    %-22s %i\n", failureNames[f], failureCount[f]);
+
+    UnloadWorkerPool(pool);
+    free(tasks);
+
+    return (failedCount == 0);
+}
+
+// Measure corpus deduplication: unique parameters (file data) and unique canonical parameters (waves generated)
+// NOTE: Parameters with same canonical hash generate the same wave, one render is required per canonical hash
+static bool RunDedupe(const char *corpusPath)
+{
+    FilePathList files = LoadDirectoryFilesEx(corpusPath, ".rfx", true);
+
+    if (files.count == 0)
+    {
+        printf("WARNING: [%s] No .rfx files found on corpus directory\n", corpusPath);
+        UnloadDirectoryFiles(files);
+        return false;
+    }
+
+    unsigned long long *rawHashes = (unsigned long long *)calloc(files.count, sizeof(unsigned long long));
+    unsigned long long *canonicalHashes = (unsigned long long *)calloc(files.count, sizeof(unsigned long long));
+    double canonicalTime = 0.0;
+
+    for (unsigned int i = 0; i < files.count; i++)
+    {
+        WaveParams params = LoadWaveParamsRFX(files.paths[i]);
+
+        rawHashes[i] = 0xcbf29ce484222325ULL;
+        for (int b = 0; b < (int)sizeof(WaveParams); b++) rawHashes[i] = (rawHashes[i] ^ ((const unsigned char *)&params)[b])*0x100000001b3ULL;
+
+        double startTime = GetBenchTime();
+        canonicalHashes[i] = GetWaveParamsHash(params);
+        canonicalTime += GetBenchTime() - startTime;
+    }
+
+    qsort(rawHashes, files.count, sizeof(unsigned long long), CompareHash);
+    qsort(canonicalHashes, files.count, sizeof(unsigned long long), CompareHash);
+
+    int rawUnique = 0;
+    int canonicalUnique = 0;
+
+    for (unsigned int i = 0; i < files.count; i++)
+    {
+        if ((i == 0) || (rawHashes[i] != rawHashes[i - 1])) rawUnique++;
+        if ((i == 0) || (canonicalHashes[i] != canonicalHashes[i - 1])) canonicalUnique++;
+    }
+
+    printf("Dedupe: %u files (%s)\n", files.count, corpusPath);
+    printf("    unique parameters:      %i\n", rawUnique);
+    printf("    unique canonical:       %i (%.1f%% renders saved)\n", canonicalUnique, 100.0*(rawUnique - canonicalUnique)/rawUnique);
+    printf("    canonical hash time:    %.2f us/file\n", canonicalTime*1e6/files.count);
+
+    free(rawHashes);
+    free(canonicalHashes);
+    UnloadDirectoryFiles(files);
+
+    return true;
+}
+
+// Compare hash values, used to count unique hashes
+static int CompareHash(const void *a, const void *b)
+{
+    unsigned long long hashA = *(const unsigned long long *)a;
+    unsigned long long hashB = *(const unsigned long long *)b;
+
+    return (hashA > hashB) - (hashA < hashB);
+}
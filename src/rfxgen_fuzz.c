@@ -0,0 +1,155 @@
+/*******************************************************************************************
+*
+*   rFXGen fuzz - .rfx files parser fuzzing harness (libFuzzer/AFL)
+*
+*   Fuzzes LoadWaveParamsFromMemory() with arbitrary data, parameters loaded must be valid
+*   (wave type in range, finite values) and they are used to generate a wave, checking
+*   GenerateWave() invariants (frames count under max length, finite samples within [-1..1])
+*
+*   Invariants failures call abort(), reported as crashes by fuzzers, same as sanitizers errors
+*
+*   USAGE:
+*       libFuzzer:  > rfxgen_fuzz fuzz_corpus -max_total_time=3600
+*       AFL:        > afl-fuzz -i fuzz_corpus -o fuzz_findings -- ./rfxgen_fuzz_afl @@
+*       Replay:     > rfxgen_fuzz_afl <file.rfx> [<file.rfx>...]   (reads stdin if no file provided)
+*
+*   CONFIGURATION:
+*
+*   #define RFXGEN_FUZZ_STANDALONE
+*       Program entry point provided: files (or stdin) data is processed, required for AFL
+*       and to replay crashes without libFuzzer
+*
+*   #define RFXGEN_FUZZ_NO_GENERATION
+*       Only parsing is fuzzed, waves are not generated (faster executions)
+*
+*   DEPENDENCIES:
+*       raylib 4.2              - Wave type and random values (no window required)
+*
+*   COMPILATION:
+*       make fuzz               - libFuzzer build with address and undefined behaviour sanitizers (clang)
+*       make fuzz-afl           - AFL instrumented standalone build with sanitizers (afl-clang-fast)
+*
+*   NOTE: Seed corpus is generated with rfxgen_bench --corpus (make fuzz-corpus)
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2022 raylib technologies (@raylibtech) / Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#include <stdlib.h>                     // Required for: malloc(), realloc(), free(), abort()
+#include <stdio.h>                      // Required for: FILE, fopen(), fread(), fclose(), fprintf()
+#include <stdint.h>                     // Required for: uint8_t
+#include <stddef.h>                     // Required for: size_t
+#include <string.h>                     // Required for: memcmp()
+#include <math.h>                       // Required for: isfinite(), fabsf()
+
+#include "raylib.h"
+
+// Parser messages disabled, invalid data is expected
+#define RFXGEN_LOG(...) do { } while (0)
+
+#define RFXGEN_IMPLEMENTATION
+#include "rfxgen.h"                     // Sound effects generation: wave parameters loading and wave generation
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define FUZZ_MAX_FRAMES     (10*44100)  // Max wave frames: 10 seconds at 44100 Hz
+
+// Check fuzzing invariant, abort on failure
+#define FUZZ_CHECK(condition, message) do { if (!(condition)) { fprintf(stderr, "INVARIANT FAILED: %s\n", message); abort(); } } while (0)
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);  // Fuzzing entry point (libFuzzer interface)
+
+//------------------------------------------------------------------------------------
+// Fuzzing entry point
+//------------------------------------------------------------------------------------
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    WaveParams params = LoadWaveParamsFromMemory(data, (unsigned int)size);
+
+    // Parameters loaded must be valid: wave type in range and finite values
+    // NOTE: Not valid data returns empty parameters, they are also valid
+    FUZZ_CHECK((params.waveTypeValue >= 0) && (params.waveTypeValue <= 3), "wave type out of range");
+
+    const float *values = &params.attackTimeValue;
+    for (int i = 0; i < (RFX_PARAMS_SIZE - 8)/4; i++) FUZZ_CHECK(isfinite(values[i]), "non-finite parameter value");
+
+    // Only exact .rfx file size can be loaded
+    if (size != RFX_FILE_SIZE) FUZZ_CHECK(memcmp(&params, &(WaveParams){ 0 }, sizeof(WaveParams)) == 0, "parameters loaded from data with wrong size");
+
+#if !defined(RFXGEN_FUZZ_NO_GENERATION)
+    Wave wave = GenerateWave(params);
+
+    FUZZ_CHECK((wave.data != NULL) && (wave.frameCount > 0) && (wave.frameCount <= FUZZ_MAX_FRAMES), "wave frames count out of range");
+
+    const float *samples = (const float *)wave.data;
+    for (unsigned int i = 0; i < wave.frameCount; i++) FUZZ_CHECK(isfinite(samples[i]) && (fabsf(samples[i]) <= 1.0f), "wave sample not valid");
+
+    UnloadWave(wave);
+#endif
+
+    return 0;
+}
+
+#if defined(RFXGEN_FUZZ_STANDALONE)
+//------------------------------------------------------------------------------------
+// Program main entry point, files (or stdin) data processed
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    for (int i = (argc > 1)? 1 : 0; i < argc; i++)
+    {
+        FILE *file = (argc > 1)? fopen(argv[i], "rb") : stdin;
+
+        if (file == NULL)
+        {
+            fprintf(stderr, "WARNING: [%s] File could not be opened\n", argv[i]);
+            continue;
+        }
+
+        // Load file data, size is not known in advance (stdin)
+        size_t size = 0;
+        size_t capacity = 4096;
+        unsigned char *data = (unsigned char *)malloc(capacity);
+        size_t bytesRead = 0;
+
+        while ((bytesRead = fread(data + size, 1, capacity - size, file)) > 0)
+        {
+            size += bytesRead;
+
+            if (size == capacity)
+            {
+                capacity *= 2;
+                data = (unsigned char *)realloc(data, capacity);
+            }
+        }
+
+        if (file != stdin) fclose(file);
+
+        LLVMFuzzerTestOneInput(data, size);
+        free(data);
+    }
+
+    return 0;
+}
+#endif
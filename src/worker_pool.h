@@ -0,0 +1,404 @@
+/*******************************************************************************************
+*
+*   Worker Pool - Background tasks processing on worker threads
+*
+*   MODULE USAGE:
+*       #define WORKER_POOL_IMPLEMENTATION
+*       #include "worker_pool.h"
+*
+*       INIT: WorkerPool *pool = LoadWorkerPool(threadCount);
+*       PUSH: WorkerPoolPush(pool, &task);      // Task memory must be valid until task is done
+*       POLL: if (IsWorkerTaskDone(pool, &task)) { ... }
+*       STAT: int pending = GetWorkerPoolPendingCount(pool);   // Tasks waiting in queue
+*       WAIT: WorkerPoolWait(pool);             // Wait for all pushed tasks to be done
+*       FREE: UnloadWorkerPool(pool);
+*
+*   CONFIGURATION:
+*
+*   #define WORKER_POOL_NO_THREADS
+*       Tasks are processed synchronously on WorkerPoolPush(), no threads are created
+*       NOTE: Defined by default on PLATFORM_WEB
+*
+*   NOTE: Tasks are processed in push order, task functions must be thread-safe,
+*   avoid raylib functions using internal static buffers (TextFormat(), IsFileExtension()...)
+*
+*   DEPENDENCIES:
+*       pthreads on non-Windows platforms, kernel32 threads and sync objects on Windows
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2022 raylib technologies (@raylibtech).
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#ifndef WORKER_POOL_H
+#define WORKER_POOL_H
+
+#include <stdbool.h>
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#if defined(PLATFORM_WEB) && !defined(WORKER_POOL_NO_THREADS)
+    #define WORKER_POOL_NO_THREADS
+#endif
+
+#define WORKER_POOL_MAX_THREADS     64          // Max worker threads per pool
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Worker task function, called from a worker thread
+typedef void (*WorkerTaskFunc)(void *data);
+
+// Worker task state
+typedef enum {
+    WORKER_TASK_IDLE = 0,       // Task not pushed or already done and checked
+    WORKER_TASK_PENDING,        // Task waiting in queue
+    WORKER_TASK_RUNNING,        // Task being processed by a worker thread
+    WORKER_TASK_DONE            // Task processed
+} WorkerTaskState;
+
+// Worker task, memory owned by the caller
+// NOTE: Task state must be accessed through IsWorkerTaskDone()
+typedef struct WorkerTask {
+    WorkerTaskFunc func;        // Task function
+    void *data;                 // Task function data
+    int state;                  // Task state (WorkerTaskState)
+    int worker;                 // Worker thread processing the task: [1..threadCount], 0 if processed synchronously
+    struct WorkerTask *next;    // Next task in queue (internal)
+} WorkerTask;
+
+// Worker pool, opaque type
+typedef struct WorkerPool WorkerPool;
+
+#ifdef __cplusplus
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+WorkerPool *LoadWorkerPool(int threadCount);                    // Load worker pool, threadCount <= 0 uses number of processors
+void UnloadWorkerPool(WorkerPool *pool);                        // Unload worker pool, pending tasks are processed first
+void WorkerPoolPush(WorkerPool *pool, WorkerTask *task);        // Push task to be processed, task func/data must be set
+void WorkerPoolWait(WorkerPool *pool);                          // Wait for all pushed tasks to be done
+bool IsWorkerTaskDone(WorkerPool *pool, WorkerTask *task);      // Check if task has been processed
+int GetWorkerPoolThreadCount(WorkerPool *pool);                 // Get worker pool threads count (0 if synchronous)
+int GetWorkerPoolPendingCount(WorkerPool *pool);                // Get worker pool tasks waiting in queue (not running yet)
+int GetProcessorCount(void);                                    // Get number of logical processors available
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // WORKER_POOL_H
+
+/***********************************************************************************
+*
+*   WORKER_POOL IMPLEMENTATION
+*
+************************************************************************************/
+#if defined(WORKER_POOL_IMPLEMENTATION)
+
+#include <stdlib.h>         // Required for: calloc(), free()
+
+#if !defined(WORKER_POOL_NO_THREADS)
+#if defined(_WIN32)
+    // NOTE: Avoid including windows.h, it conflicts with raylib symbols (Rectangle, CloseWindow()...)
+    #if defined(_WINDOWS_)
+        typedef SRWLOCK WorkerMutex;
+        typedef CONDITION_VARIABLE WorkerCond;
+    #else
+        typedef struct { void *ptr; } WorkerMutex;      // SRWLOCK
+        typedef struct { void *ptr; } WorkerCond;       // CONDITION_VARIABLE
+
+        __declspec(dllimport) void __stdcall InitializeSRWLock(WorkerMutex *lock);
+        __declspec(dllimport) void __stdcall AcquireSRWLockExclusive(WorkerMutex *lock);
+        __declspec(dllimport) void __stdcall ReleaseSRWLockExclusive(WorkerMutex *lock);
+        __declspec(dllimport) void __stdcall InitializeConditionVariable(WorkerCond *cond);
+        __declspec(dllimport) int __stdcall SleepConditionVariableSRW(WorkerCond *cond, WorkerMutex *lock, unsigned long ms, unsigned long flags);
+        __declspec(dllimport) void __stdcall WakeConditionVariable(WorkerCond *cond);
+        __declspec(dllimport) void __stdcall WakeAllConditionVariable(WorkerCond *cond);
+        __declspec(dllimport) void *__stdcall CreateThread(void *attributes, size_t stackSize, unsigned long (__stdcall *func)(void *), void *param, unsigned long flags, unsigned long *threadId);
+        __declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *handle, unsigned long ms);
+        __declspec(dllimport) int __stdcall CloseHandle(void *handle);
+        __declspec(dllimport) unsigned long __stdcall GetActiveProcessorCount(unsigned short group);
+    #endif
+    typedef void *WorkerThread;
+
+    #define WORKER_MUTEX_INIT(m)        InitializeSRWLock(m)
+    #define WORKER_MUTEX_FREE(m)
+    #define WORKER_MUTEX_LOCK(m)        AcquireSRWLockExclusive(m)
+    #define WORKER_MUTEX_UNLOCK(m)      ReleaseSRWLockExclusive(m)
+    #define WORKER_COND_INIT(c)         InitializeConditionVariable(c)
+    #define WORKER_COND_FREE(c)
+    #define WORKER_COND_WAIT(c, m)      SleepConditionVariableSRW(c, m, 0xffffffff, 0)
+    #define WORKER_COND_SIGNAL(c)       WakeConditionVariable(c)
+    #define WORKER_COND_BROADCAST(c)    WakeAllConditionVariable(c)
+#else
+    #include <pthread.h>    // Required for: pthread_create(), pthread_join(), pthread_mutex_*(), pthread_cond_*()
+    #include <unistd.h>     // Required for: sysconf()
+
+    typedef pthread_mutex_t WorkerMutex;
+    typedef pthread_cond_t WorkerCond;
+    typedef pthread_t WorkerThread;
+
+    #define WORKER_MUTEX_INIT(m)        pthread_mutex_init(m, NULL)
+    #define WORKER_MUTEX_FREE(m)        pthread_mutex_destroy(m)
+    #define WORKER_MUTEX_LOCK(m)        pthread_mutex_lock(m)
+    #define WORKER_MUTEX_UNLOCK(m)      pthread_mutex_unlock(m)
+    #define WORKER_COND_INIT(c)         pthread_cond_init(c, NULL)
+    #define WORKER_COND_FREE(c)         pthread_cond_destroy(c)
+    #define WORKER_COND_WAIT(c, m)      pthread_cond_wait(c, m)
+    #define WORKER_COND_SIGNAL(c)       pthread_cond_signal(c)
+    #define WORKER_COND_BROADCAST(c)    pthread_cond_broadcast(c)
+#endif
+#else
+    // Synchronous processing, no sync objects required
+    typedef int WorkerMutex;
+    typedef int WorkerCond;
+    typedef int WorkerThread;
+
+    #define WORKER_MUTEX_INIT(m)
+    #define WORKER_MUTEX_FREE(m)
+    #define WORKER_MUTEX_LOCK(m)
+    #define WORKER_MUTEX_UNLOCK(m)
+    #define WORKER_COND_INIT(c)
+    #define WORKER_COND_FREE(c)
+    #define WORKER_COND_WAIT(c, m)
+    #define WORKER_COND_SIGNAL(c)
+    #define WORKER_COND_BROADCAST(c)
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Worker thread data, passed to thread main loop
+typedef struct WorkerThreadData {
+    struct WorkerPool *pool;        // Worker pool
+    int index;                      // Worker thread index [1..threadCount]
+} WorkerThreadData;
+
+struct WorkerPool {
+    WorkerThread threads[WORKER_POOL_MAX_THREADS];  // Worker threads
+    WorkerThreadData threadData[WORKER_POOL_MAX_THREADS];   // Worker threads data
+    int threadCount;                // Number of worker threads
+
+    WorkerMutex mutex;              // Pool mutex, protects queue and tasks state
+    WorkerCond taskCond;            // Signaled when a task is pushed or pool is closing
+    WorkerCond doneCond;            // Signaled when pool becomes idle
+
+    WorkerTask *first;              // Tasks queue first task (next to process)
+    WorkerTask *last;               // Tasks queue last task
+    int busyCount;                  // Tasks pushed and not done yet
+    int pendingCount;               // Tasks waiting in queue
+    bool closing;                   // Pool is being unloaded, threads must exit
+};
+
+//----------------------------------------------------------------------------------
+// Internal Module Functions Definition
+//----------------------------------------------------------------------------------
+#if !defined(WORKER_POOL_NO_THREADS)
+// Worker thread main loop, process queued tasks until pool is closing
+#if defined(_WIN32)
+static unsigned long __stdcall WorkerThreadMain(void *arg)
+#else
+static void *WorkerThreadMain(void *arg)
+#endif
+{
+    WorkerThreadData *thread = (WorkerThreadData *)arg;
+    WorkerPool *pool = thread->pool;
+
+    WORKER_MUTEX_LOCK(&pool->mutex);
+
+    while (true)
+    {
+        while ((pool->first == NULL) && !pool->closing) WORKER_COND_WAIT(&pool->taskCond, &pool->mutex);
+
+        if (pool->first == NULL) break;     // Closing and no more tasks pending
+
+        WorkerTask *task = pool->first;
+        pool->first = task->next;
+        if (pool->first == NULL) pool->last = NULL;
+        pool->pendingCount--;
+        task->state = WORKER_TASK_RUNNING;
+        task->worker = thread->index;
+
+        WORKER_MUTEX_UNLOCK(&pool->mutex);
+        task->func(task->data);
+        WORKER_MUTEX_LOCK(&pool->mutex);
+
+        task->state = WORKER_TASK_DONE;
+        pool->busyCount--;
+
+        if (pool->busyCount == 0) WORKER_COND_BROADCAST(&pool->doneCond);
+    }
+
+    WORKER_MUTEX_UNLOCK(&pool->mutex);
+
+    return 0;
+}
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Load worker pool, threadCount <= 0 uses number of processors
+WorkerPool *LoadWorkerPool(int threadCount)
+{
+    WorkerPool *pool = (WorkerPool *)calloc(1, sizeof(WorkerPool));
+
+    WORKER_MUTEX_INIT(&pool->mutex);
+    WORKER_COND_INIT(&pool->taskCond);
+    WORKER_COND_INIT(&pool->doneCond);
+
+#if !defined(WORKER_POOL_NO_THREADS)
+    if (threadCount <= 0) threadCount = GetProcessorCount();
+    if (threadCount > WORKER_POOL_MAX_THREADS) threadCount = WORKER_POOL_MAX_THREADS;
+
+    for (int i = 0; i < threadCount; i++)
+    {
+        pool->threadData[i].pool = pool;
+        pool->threadData[i].index = i + 1;
+
+    #if defined(_WIN32)
+        pool->threads[i] = CreateThread(NULL, 0, WorkerThreadMain, &pool->threadData[i], 0, NULL);
+        if (pool->threads[i] == NULL) break;
+    #else
+        if (pthread_create(&pool->threads[i], NULL, WorkerThreadMain, &pool->threadData[i]) != 0) break;
+    #endif
+        pool->threadCount++;
+    }
+#else
+    (void)threadCount;
+#endif
+
+    return pool;
+}
+
+// Unload worker pool, pending tasks are processed first
+void UnloadWorkerPool(WorkerPool *pool)
+{
+    if (pool == NULL) return;
+
+    WORKER_MUTEX_LOCK(&pool->mutex);
+    pool->closing = true;
+    WORKER_COND_BROADCAST(&pool->taskCond);
+    WORKER_MUTEX_UNLOCK(&pool->mutex);
+
+#if !defined(WORKER_POOL_NO_THREADS)
+    for (int i = 0; i < pool->threadCount; i++)
+    {
+    #if defined(_WIN32)
+        WaitForSingleObject(pool->threads[i], 0xffffffff);
+        CloseHandle(pool->threads[i]);
+    #else
+        pthread_join(pool->threads[i], NULL);
+    #endif
+    }
+#endif
+
+    WORKER_COND_FREE(&pool->doneCond);
+    WORKER_COND_FREE(&pool->taskCond);
+    WORKER_MUTEX_FREE(&pool->mutex);
+
+    free(pool);
+}
+
+// Push task to be processed, task func/data must be set
+// NOTE: If pool has no threads, task is processed synchronously
+void WorkerPoolPush(WorkerPool *pool, WorkerTask *task)
+{
+    task->next = NULL;
+
+    if (pool->threadCount == 0)
+    {
+        task->state = WORKER_TASK_RUNNING;
+        task->worker = 0;
+        task->func(task->data);
+        task->state = WORKER_TASK_DONE;
+        return;
+    }
+
+    WORKER_MUTEX_LOCK(&pool->mutex);
+
+    task->state = WORKER_TASK_PENDING;
+
+    if (pool->last != NULL) pool->last->next = task;
+    else pool->first = task;
+    pool->last = task;
+    pool->busyCount++;
+    pool->pendingCount++;
+
+    WORKER_COND_SIGNAL(&pool->taskCond);
+    WORKER_MUTEX_UNLOCK(&pool->mutex);
+}
+
+// Wait for all pushed tasks to be done
+void WorkerPoolWait(WorkerPool *pool)
+{
+    WORKER_MUTEX_LOCK(&pool->mutex);
+    while (pool->busyCount > 0) WORKER_COND_WAIT(&pool->doneCond, &pool->mutex);
+    WORKER_MUTEX_UNLOCK(&pool->mutex);
+}
+
+// Check if task has been processed
+bool IsWorkerTaskDone(WorkerPool *pool, WorkerTask *task)
+{
+    WORKER_MUTEX_LOCK(&pool->mutex);
+    bool done = (task->state == WORKER_TASK_DONE);
+    WORKER_MUTEX_UNLOCK(&pool->mutex);
+
+    return done;
+}
+
+// Get worker pool threads count (0 if synchronous)
+int GetWorkerPoolThreadCount(WorkerPool *pool)
+{
+    return pool->threadCount;
+}
+
+// Get worker pool tasks waiting in queue (not running yet)
+int GetWorkerPoolPendingCount(WorkerPool *pool)
+{
+    WORKER_MUTEX_LOCK(&pool->mutex);
+    int count = pool->pendingCount;
+    WORKER_MUTEX_UNLOCK(&pool->mutex);
+
+    return count;
+}
+
+// Get number of logical processors available
+int GetProcessorCount(void)
+{
+    int count = 1;
+
+#if !defined(WORKER_POOL_NO_THREADS)
+#if defined(_WIN32)
+    count = (int)GetActiveProcessorCount(0xffff);   // ALL_PROCESSOR_GROUPS
+#else
+    count = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+#endif
+
+    return (count > 0)? count : 1;
+}
+
+#endif // WORKER_POOL_IMPLEMENTATION